@@ -7,20 +7,31 @@
 #include "ast_decl.h"
 #include <string.h> // strdup
 #include <stdio.h>  // printf
+#include "stats.h"
 
 Node::Node(yyltype loc) {
     location = new yyltype(loc);
     parent = NULL;
     scope = NULL;
+    Stats::Count(Stats::AstNodes);
 }
 
 Node::Node() {
     location = NULL;
     parent = NULL;
     scope = NULL;
+    Stats::Count(Stats::AstNodes);
+}
+
+Node::~Node() {
+    delete location;
 }
 	 
 Identifier::Identifier(yyltype loc, const char *n) : Node(loc) {
     name = strdup(n);
 } 
 
+Identifier::~Identifier() {
+    free(name);
+}
+
@@ -45,7 +45,7 @@ class Node  {
   public:
     Node(yyltype loc);
     Node();
-    virtual ~Node() {}
+    virtual ~Node();
 
     Scope *GetScope()        { return scope; }
     yyltype *GetLocation()   { return location; }
@@ -60,6 +60,7 @@ class Identifier : public Node
 
   public:
     Identifier(yyltype loc, const char *name);
+    ~Identifier();
     friend ostream& operator<<(ostream& out, Identifier *id) { return out << id->name; }
 
     const char* GetName() { return name; }
@@ -6,6 +6,8 @@
 #include "ast_type.h"
 #include "ast_stmt.h"
 #include "codegen.h"
+#include "context.h"
+#include "stats.h"
 
 Decl::Decl(Identifier *n) : Node(*n->GetLocation()) {
     Assert(n != NULL);
@@ -13,9 +15,16 @@ Decl::Decl(Identifier *n) : Node(*n->GetLocation()) {
     scope = new Scope;
 }
 
+Decl::~Decl() {
+    delete id;
+    delete scope;
+}
+
 VarDecl::VarDecl(Identifier *n, Type *t) : Decl(n) {
     Assert(n != NULL && t != NULL);
     (type=t)->SetParent(this);
+    memLoc = NULL;
+    memOffset = 0;
 }
 
 int VarDecl::GetMemBytes() {
@@ -29,11 +38,27 @@ ClassDecl::ClassDecl(Identifier *n, NamedType *ex, List<NamedType*> *imp, List<D
     if (extends) extends->SetParent(this);
     (implements=imp)->SetParentAll(this);
     (members=m)->SetParentAll(this);
+    type = NULL;
+}
 
+ClassDecl::~ClassDecl() {
+    delete extends;
+    for (int i = 0, n = implements->NumElements(); i < n; ++i)
+        delete implements->Nth(i);
+    for (int i = 0, n = members->NumElements(); i < n; ++i)
+        delete members->Nth(i);
+    delete implements;
+    delete members;
+    delete type;
 }
 
 NamedType* ClassDecl::GetType() {
-    return new NamedType(id);
+    // The type is made once (PreEmit makes sure of that before the code
+    // generation can ask for it from several threads), and names the
+    // class with an Identifier of its own so that id is left in place
+    if (type == NULL)
+        type = new NamedType(new Identifier(*id->GetLocation(), GetName()));
+    return type;
 }
 
 void ClassDecl::BuildScope() {
@@ -45,11 +70,13 @@ void ClassDecl::BuildScope() {
 }
 
 void ClassDecl::PreEmit() {
+    GetType();
+
     int memOffset = CodeGenerator::OffsetToFirstField;
     int vtblOffset = CodeGenerator::OffsetToFirstMethod;
 
     if (extends != NULL) {
-        Decl *d = Program::gScope->table->Lookup(extends->GetName());
+        Decl *d = Program::GetGlobalScope()->table->Lookup(extends->GetName());
         Assert(d != NULL);
         memOffset += d->GetMemBytes();
         vtblOffset += d->GetVTblBytes();
@@ -85,21 +112,24 @@ Location* ClassDecl::Emit(CodeGenerator *cg) {
     for (int i = 0, n = members->NumElements(); i < n; ++i)
         members->Nth(i)->Emit(cg);
 
+    EmitVTable(cg);
+    return NULL;
+}
+
+void ClassDecl::EmitVTable(CodeGenerator *cg) {
     List<FnDecl*> *decls = GetMethodDecls();
     List<const char*> *labels = new List<const char*>;
     for (int i = 0, n = decls->NumElements(); i < n; ++i)
         labels->Append(decls->Nth(i)->GetLabel());
 
     cg->GenVTable(GetName(), labels);
-
-    return NULL;
 }
 
 int ClassDecl::GetMemBytes() {
     int memBytes = 0;
 
     if (extends != NULL) {
-        Decl *d = Program::gScope->table->Lookup(extends->GetName());
+        Decl *d = Program::GetGlobalScope()->table->Lookup(extends->GetName());
         Assert(d != NULL);
         memBytes += d->GetMemBytes();
     }
@@ -114,7 +144,7 @@ int ClassDecl::GetVTblBytes() {
     int vtblBytes = 0;
 
     if (extends != NULL) {
-        Decl *d = Program::gScope->table->Lookup(extends->GetName());
+        Decl *d = Program::GetGlobalScope()->table->Lookup(extends->GetName());
         Assert(d != NULL);
         vtblBytes += d->GetVTblBytes();
     }
@@ -129,7 +159,7 @@ List<FnDecl*>* ClassDecl::GetMethodDecls() {
     List<FnDecl*> *decls = new List<FnDecl*>;
 
     if (extends != NULL) {
-        Decl *d = Program::gScope->table->Lookup(extends->GetName());
+        Decl *d = Program::GetGlobalScope()->table->Lookup(extends->GetName());
         ClassDecl *c = dynamic_cast<ClassDecl*>(d);
         Assert(c != NULL);
         List<FnDecl*> *extDecls = c->GetMethodDecls();
@@ -165,6 +195,12 @@ InterfaceDecl::InterfaceDecl(Identifier *n, List<Decl*> *m) : Decl(n) {
     (members=m)->SetParentAll(this);
 }
 
+InterfaceDecl::~InterfaceDecl() {
+    for (int i = 0, n = members->NumElements(); i < n; ++i)
+        delete members->Nth(i);
+    delete members;
+}
+
 void InterfaceDecl::BuildScope() {
     for (int i = 0, n = members->NumElements(); i < n; ++i)
         scope->AddDecl(members->Nth(i));
@@ -181,9 +217,20 @@ FnDecl::FnDecl(Identifier *n, Type *r, List<VarDecl*> *d) : Decl(n) {
     label = new std::string(GetName());
     if (*label != "main")
         label->insert(0, "____"); // Prefix function labels to avoid conflicts
+    tailCallLabel = NULL;
+    vtblOffset = 0;
     isMethod = false;
 }
 
+FnDecl::~FnDecl() {
+    // returnType may be one of the shared built-in types, so it is not freed
+    for (int i = 0, n = formals->NumElements(); i < n; ++i)
+        delete formals->Nth(i);
+    delete formals;
+    delete body;
+    delete label;
+}
+
 void FnDecl::SetFunctionBody(Stmt *b) {
     (body=b)->SetParent(this);
 }
@@ -214,21 +261,59 @@ Location* FnDecl::Emit(CodeGenerator *cg) {
 
     for (int i = 0, n = formals->NumElements(); i < n; ++i) {
         VarDecl *d = formals->Nth(i);
-        Location *loc = new Location(fpRelative, offset, d->GetName());
+        Location *loc = cg->GenParamVar(d->GetName(), offset);
         d->SetMemLoc(loc);
         offset += d->GetMemBytes();
     }
 
     if (body != NULL) {
         cg->GenLabel(GetLabel());
+        if (CompilationContext::Current()->GetOptimize())
+            tailCallLabel = cg->NewLabel();
         cg->GenBeginFunc()->SetFrameSize(body->GetMemBytes());
+        if (tailCallLabel != NULL)   // dropped later if nothing jumps to it
+            cg->GenLabel(tailCallLabel);
         body->Emit(cg);
         cg->GenEndFunc();
+        free(tailCallLabel);
+        tailCallLabel = NULL;
+
+        /* The function is lowered and written out right away, after which
+         * neither its Tac nor its body are needed again.
+         */
+        cg->FlushCode();
+        delete body;
+        body = NULL;
     }
 
     return NULL;
 }
 
+void FnDecl::EmitTailJump(CodeGenerator *cg, List<Location*> *args) {
+    Assert(tailCallLabel != NULL && args->NumElements() == formals->NumElements());
+
+    // The formals are assigned in order, so an argument that is one of
+    // the formals before its own is copied first
+    for (int i = 0, n = args->NumElements(); i < n; ++i) {
+        for (int j = 0; j < i; ++j) {
+            if (args->Nth(i) == formals->Nth(j)->GetMemLoc()) {
+                Location *copy = cg->GenTempVar();
+                cg->GenAssign(copy, args->Nth(i));
+                args->RemoveAt(i);
+                args->InsertAt(copy, i);
+                break;
+            }
+        }
+    }
+    for (int i = 0, n = args->NumElements(); i < n; ++i) {
+        Location *formal = formals->Nth(i)->GetMemLoc();
+        if (args->Nth(i) != formal)
+            cg->GenAssign(formal, args->Nth(i));
+    }
+    cg->GenGoto(tailCallLabel);
+    Stats::Count(Stats::TailCallsEliminated);
+}
+
 int FnDecl::GetVTblBytes() {
     return CodeGenerator::VarSize;
 }
@@ -30,6 +30,7 @@ class Decl : public Node
 
   public:
     Decl(Identifier *name);
+    ~Decl();
     friend ostream& operator<<(ostream& out, Decl *d) { return out << d->id; }
 
     const char* GetName() { return id->GetName(); }
@@ -74,17 +75,21 @@ class ClassDecl : public Decl
     List<Decl*> *members;
     NamedType *extends;
     List<NamedType*> *implements;
+    NamedType *type;
 
   public:
     ClassDecl(Identifier *name, NamedType *extends,
               List<NamedType*> *implements, List<Decl*> *members);
+    ~ClassDecl();
 
     NamedType* GetType();
     NamedType* GetExtends() { return extends; }
+    List<Decl*>* GetMembers() { return members; }
 
     void BuildScope();
     void PreEmit();
     Location* Emit(CodeGenerator *cg);
+    void EmitVTable(CodeGenerator *cg);
     int GetMemBytes();
     int GetVTblBytes();
     void AddLabelPrefix(const char *prefix) { /* Empty */ }
@@ -100,6 +105,7 @@ class InterfaceDecl : public Decl
 
   public:
     InterfaceDecl(Identifier *name, List<Decl*> *members);
+    ~InterfaceDecl();
 
     // XXX: Interfaces are not supported
 
@@ -118,11 +124,13 @@ class FnDecl : public Decl
     Type *returnType;
     Stmt *body;
     std::string *label;
+    char *tailCallLabel;        // just past BeginFunc, while emitting
     int vtblOffset;
     bool isMethod;
 
   public:
     FnDecl(Identifier *name, Type *returnType, List<VarDecl*> *formals);
+    ~FnDecl();
     void SetFunctionBody(Stmt *b);
 
     Type* GetType() { return returnType; }
@@ -140,6 +148,14 @@ class FnDecl : public Decl
     void SetVTblOffset(int v) { vtblOffset = v; }
 
     void SetIsMethod(bool b) { isMethod = b; }
+
+    // When optimizing, a call to the function returned by the function
+    // itself (see Call::IsSelfTailCall) assigns the arguments to the
+    // formals and jumps back to tailCallLabel, so that the recursion runs
+    // in a single frame.
+    // Before the body is emitted the label is NULL.
+    const char* GetTailCallLabel() { return tailCallLabel; }
+    void EmitTailJump(CodeGenerator *cg, List<Location*> *args);
 };
 
 #endif
@@ -9,6 +9,8 @@
 #include "ast_decl.h"
 #include "codegen.h"
 #include "errors.h"
+#include "ast_stmt.h"
+#include "stats.h"
 
 Decl* Expr::GetFieldDecl(Identifier *field, Expr *b) {
 
@@ -40,7 +42,7 @@ Decl* Expr::GetFieldDecl(Identifier *field, Type *t) {
     // It is assumed that t is *not* a primitive type. Results are undefined if
     // this assumption is not met.
     while (t != NULL) {
-        Decl *tDecl = Program::gScope->table->Lookup(t->GetName());
+        Decl *tDecl = Program::GetGlobalScope()->table->Lookup(t->GetName());
         Decl *d = tDecl->GetScope()->table->Lookup(field->GetName());
         if (d != NULL)
             return d;
@@ -63,8 +65,22 @@ ClassDecl* Expr::GetClassDecl() {
     return NULL;
 }
 
+FnDecl* Expr::GetFnDecl() {
+    Node *n = this;
+    while (n != NULL) {
+        if (dynamic_cast<FnDecl*>(n))
+            return static_cast<FnDecl*>(n);
+        n = n->GetParent();
+    }
+    return NULL;
+}
+
 Location* Expr::GetThisLoc() {
-    return new Location(fpRelative, CodeGenerator::OffsetToFirstParam, "this");
+    // The 'this' pointer always lives in the first param slot, so a single
+    // shared Location is used for every reference to it.
+    static Location *thisLoc =
+        new Location(fpRelative, CodeGenerator::OffsetToFirstParam, "this");
+    return thisLoc;
 }
 
 IntConstant::IntConstant(yyltype loc, int val) : Expr(loc) {
@@ -129,6 +145,10 @@ StringConstant::StringConstant(yyltype loc, const char *val) : Expr(loc) {
     value = strdup(val);
 }
 
+StringConstant::~StringConstant() {
+    free(value);
+}
+
 Type* StringConstant::GetType() {
     return Type::stringType;
 }
@@ -174,6 +194,12 @@ CompoundExpr::CompoundExpr(Operator *o, Expr *r)
     (right=r)->SetParent(this);
 }
 
+CompoundExpr::~CompoundExpr() {
+    delete op;
+    delete left;
+    delete right;
+}
+
 Type* ArithmeticExpr::GetType() {
     return right->GetType();
 }
@@ -470,6 +496,11 @@ ArrayAccess::ArrayAccess(yyltype loc, Expr *b, Expr *s) : LValue(loc) {
     (subscript=s)->SetParent(this);
 }
 
+ArrayAccess::~ArrayAccess() {
+    delete base;
+    delete subscript;
+}
+
 Type* ArrayAccess::GetType() {
     return base->GetType();
 }
@@ -496,7 +527,10 @@ Location* ArrayAccess::EmitAddr(CodeGenerator *cg) {
     Location *b = base->Emit(cg);
     Location *s = subscript->Emit(cg);
 
-    EmitRuntimeSubscriptCheck(cg, b, s);
+    if (cg->IsInBounds(b, s))
+        Stats::Count(Stats::BoundsChecksRemoved);
+    else
+        EmitRuntimeSubscriptCheck(cg, b, s);
 
     Location *con = cg->GenLoadConstant(CodeGenerator::VarSize);
 
@@ -547,6 +581,11 @@ FieldAccess::FieldAccess(Expr *b, Identifier *f)
     (field=f)->SetParent(this);
 }
 
+FieldAccess::~FieldAccess() {
+    delete base;
+    delete field;
+}
+
 Type* FieldAccess::GetType() {
     VarDecl *d = GetDecl();
     Assert(d != NULL);
@@ -606,6 +645,14 @@ int FieldAccess::GetMemBytesStore() {
     return 0;
 }
 
+Location* FieldAccess::GetLocalLoc() {
+    VarDecl *d = GetDecl();
+    if (d == NULL || d->GetMemLoc() == NULL ||
+        d->GetMemLoc()->GetSegment() != fpRelative)
+        return NULL;
+    return d->GetMemLoc();
+}
+
 VarDecl* FieldAccess::GetDecl() {
     Decl *d = GetFieldDecl(field, base);
     return dynamic_cast<VarDecl*>(d);
@@ -659,6 +706,14 @@ Call::Call(yyltype loc, Expr *b, Identifier *f, List<Expr*> *a) : Expr(loc)  {
     (actuals=a)->SetParentAll(this);
 }
 
+Call::~Call() {
+    delete base;
+    delete field;
+    for (int i = 0, n = actuals->NumElements(); i < n; ++i)
+        delete actuals->Nth(i);
+    delete actuals;
+}
+
 Type* Call::GetType() {
     if (IsArrayLengthCall())
         return Type::intType;
@@ -679,9 +734,39 @@ int Call::GetMemBytes() {
     if (IsArrayLengthCall())
         return GetMemBytesArrayLength();
 
+    if (IsSelfTailCall())       // a copy of each argument, at most
+        return GetMemBytesLabel() + actuals->NumElements() * CodeGenerator::VarSize;
+
     return GetMemBytesLabel();
 }
 
+bool Call::IsSelfTailCall() {
+    if (dynamic_cast<ReturnStmt*>(GetParent()) == NULL || IsArrayLengthCall())
+        return false;
+
+    // A method only runs on an object whose vtable slot for it holds that
+    // method (there is no call that doesn't dispatch), so calling it again
+    // on this dispatches back to it, even if a subclass overrides it. On
+    // any other receiver it may not.
+    if (base != NULL && dynamic_cast<This*>(base) == NULL)
+        return false;
+
+    FnDecl *d = GetDecl();
+    return d == GetFnDecl() && d->GetTailCallLabel() != NULL;
+}
+
+void Call::EmitSelfTailCall(CodeGenerator *cg) {
+    List<Location*> args;
+    for (int i = 0, n = actuals->NumElements(); i < n; ++i)
+        args.Append(actuals->Nth(i)->Emit(cg));
+
+    GetDecl()->EmitTailJump(cg, &args);
+}
+
+Expr* Call::GetLengthOf() {
+    return IsArrayLengthCall() ? base : NULL;
+}
+
 Location* Call::EmitLabel(CodeGenerator *cg) {
     List<Location*> *params = new List<Location*>;
     for (int i = 0, n = actuals->NumElements(); i < n; ++i)
@@ -788,8 +873,12 @@ NewExpr::NewExpr(yyltype loc, NamedType *c) : Expr(loc) {
   (cType=c)->SetParent(this);
 }
 
+NewExpr::~NewExpr() {
+    delete cType;
+}
+
 Type* NewExpr::GetType() {
-    Decl *d = Program::gScope->table->Lookup(cType->GetName());
+    Decl *d = Program::GetGlobalScope()->table->Lookup(cType->GetName());
     ClassDecl *c = dynamic_cast<ClassDecl*>(d);
     Assert(c != NULL);
     return c->GetType();
@@ -798,7 +887,7 @@ Type* NewExpr::GetType() {
 Location* NewExpr::Emit(CodeGenerator *cg) {
     const char *name = cType->GetName();
 
-    Decl *d = Program::gScope->table->Lookup(name);
+    Decl *d = Program::GetGlobalScope()->table->Lookup(name);
     Assert(d != NULL);
 
     Location *s = cg->GenLoadConstant(d->GetMemBytes());
@@ -820,6 +909,11 @@ NewArrayExpr::NewArrayExpr(yyltype loc, Expr *sz, Type *et) : Expr(loc) {
     (elemType=et)->SetParent(this);
 }
 
+NewArrayExpr::~NewArrayExpr() {
+    // elemType may be one of the shared built-in types, so it is not freed
+    delete size;
+}
+
 Type* NewArrayExpr::GetType() {
     return new ArrayType(elemType);
 }
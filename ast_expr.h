@@ -38,6 +38,7 @@ class Expr : public Stmt
     Decl* GetFieldDecl(Identifier *field, Node *n);
     Decl* GetFieldDecl(Identifier *field, Type *t);
     ClassDecl* GetClassDecl();
+    FnDecl* GetFnDecl();
     Location* GetThisLoc();
 };
 
@@ -60,6 +61,7 @@ class IntConstant : public Expr
   public:
     IntConstant(yyltype loc, int val);
 
+    int GetValue() { return value; }
     Type* GetType();
     Location* Emit(CodeGenerator *cg);
     int GetMemBytes();
@@ -98,6 +100,7 @@ class StringConstant : public Expr
 
   public:
     StringConstant(yyltype loc, const char *val);
+    ~StringConstant();
 
     Type* GetType();
     Location* Emit(CodeGenerator *cg);
@@ -135,6 +138,11 @@ class CompoundExpr : public Expr
   public:
     CompoundExpr(Expr *lhs, Operator *op, Expr *rhs); // for binary
     CompoundExpr(Operator *op, Expr *rhs);             // for unary
+    ~CompoundExpr();
+
+    Expr* GetLeft() { return left; }
+    Expr* GetRight() { return right; }
+    const char* GetOpName() { return op->GetTokenString(); }
 
     virtual Type* GetType() = 0;
     virtual Location* Emit(CodeGenerator *cg) = 0;
@@ -257,6 +265,7 @@ class ArrayAccess : public LValue
 
   public:
     ArrayAccess(yyltype loc, Expr *base, Expr *subscript);
+    ~ArrayAccess();
 
     Type* GetType();
     Location* Emit(CodeGenerator *cg);
@@ -287,6 +296,7 @@ class FieldAccess : public LValue
 
   public:
     FieldAccess(Expr *base, Identifier *field); //ok to pass NULL base
+    ~FieldAccess();
 
     Type* GetType();
     Location* Emit(CodeGenerator *cg);
@@ -295,6 +305,10 @@ class FieldAccess : public LValue
     Location* EmitStore(CodeGenerator *cg, Location *val);
     int GetMemBytesStore();
 
+    // Returns the Location of the local variable (or parameter) named,
+    // or NULL if this is a field or a global
+    Location* GetLocalLoc();
+
   private:
     VarDecl* GetDecl();
 
@@ -319,11 +333,23 @@ class Call : public Expr
 
   public:
     Call(yyltype loc, Expr *base, Identifier *field, List<Expr*> *args);
+    ~Call();
 
     Type* GetType();
     Location* Emit(CodeGenerator *cg);
     int GetMemBytes();
 
+    // A call returned by the function it calls (a method called on
+    // this) is done by jumping back to the start of that function, in
+    // the same frame (see FnDecl). Only this direct self-recursion is
+    // done: other calls in tail position, e.g. mutually recursive ones,
+    // are ordinary calls
+    bool IsSelfTailCall();
+    void EmitSelfTailCall(CodeGenerator *cg);
+
+    // Returns the array for a.length(), or NULL for any other call
+    Expr* GetLengthOf();
+
   private:
     Location* EmitLabel(CodeGenerator *cg);
     int GetMemBytesLabel();
@@ -346,6 +372,7 @@ class NewExpr : public Expr
 
   public:
     NewExpr(yyltype loc, NamedType *clsType);
+    ~NewExpr();
 
     Type* GetType();
     Location* Emit(CodeGenerator *cg);
@@ -360,6 +387,7 @@ class NewArrayExpr : public Expr
 
   public:
     NewArrayExpr(yyltype loc, Expr *sizeExpr, Type *elemType);
+    ~NewArrayExpr();
 
     Type* GetType();
     Location* Emit(CodeGenerator *cg);
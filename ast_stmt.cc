@@ -9,14 +9,21 @@
 #include "ast_expr.h"
 #include "codegen.h"
 #include "hashtable.h"
-
-Scope *Program::gScope = new Scope;
-stack<const char*> *Program::gBreakLabels = new stack<const char*>;
+#include "context.h"
+#include "threadpool.h"
+#include "stats.h"
+#include <limits.h>
+#include <string.h>
+#include <string>
 
 Scope::Scope() : table(new Hashtable<Decl*>) {
     // Empty
 }
 
+Scope::~Scope() {
+    delete table;
+}
+
 /* XXX: Only semantically valid programs will be tested, thus no semantic
  * checking is performed here.
  */
@@ -33,10 +40,23 @@ ostream& operator<<(ostream& out, Scope *s) {
     return out;
 }
 
-Program::Program(List<Decl*> *d) : codeGenerator(new CodeGenerator) {
+Program::Program(List<Decl*> *d) {
     Assert(d != NULL);
     (decls=d)->SetParentAll(this);
-    scope = gScope;
+    scope = GetGlobalScope();
+    codeGenerator = new CodeGenerator(CompilationContext::Current()->GetOutput());
+}
+
+Program::~Program() {
+    // The global scope belongs to the compilation context, not to us
+    for (int i = 0, n = decls->NumElements(); i < n; ++i)
+        delete decls->Nth(i);
+    delete decls;
+    delete codeGenerator;
+}
+
+Scope* Program::GetGlobalScope() {
+    return CompilationContext::Current()->GetGlobalScope();
 }
 
 void Program::Check() {
@@ -44,8 +64,10 @@ void Program::Check() {
      * you want to avoid the clutter.  We won't test pp4 against
      * semantically-invalid programs.
      */
+    PhaseTimer t(Stats::Check);
+
     for (int i = 0, n = decls->NumElements(); i < n; ++i)
-        gScope->AddDecl(decls->Nth(i));
+        scope->AddDecl(decls->Nth(i));
 
     for (int i = 0, n = decls->NumElements(); i < n; ++i)
         decls->Nth(i)->BuildScope();
@@ -55,6 +77,40 @@ void Program::Check() {
      */
 }
 
+/* Struct: CodeUnit
+ * ----------------
+ * A piece of the program that is translated on its own: a function, or
+ * the vtable of a class. Each unit gets a code generator of its own,
+ * which buffers the code until it is the unit's turn to be written out.
+ */
+struct CodeUnit {
+    FnDecl *fn;               // either the function to translate,
+    ClassDecl *vtable;        // or the class whose vtable to lay out
+    CodeGenerator *cg;
+    ThreadPool::Group done;
+};
+
+static void AddCodeUnit(List<CodeUnit*> *units, FnDecl *fn, ClassDecl *c) {
+    CodeUnit *u = new CodeUnit;
+    u->fn = fn;
+    u->vtable = c;
+    // The labels a function makes are qualified by the function's own
+    // label (Class.____method._L3), which no other unit can share
+    std::string prefix = (fn != NULL ? std::string(fn->GetLabel()) + "." : "");
+    u->cg = new CodeGenerator(NULL, prefix.c_str());
+    units->Append(u);
+}
+
+static void EmitCodeUnit(CodeUnit *u) {
+    TraceSpan span(u->fn ? u->fn->GetLabel() : u->vtable->GetName(), "function");
+    if (u->fn != NULL) {
+        u->fn->Emit(u->cg);
+    } else {
+        u->vtable->EmitVTable(u->cg);
+        u->cg->FlushCode();
+    }
+}
+
 void Program::Emit() {
     /* pp4: here is where the code generation is kicked off.
      *      The general idea is perform a tree traversal of the
@@ -63,6 +119,7 @@ void Program::Emit() {
      *      which makes for a great use of inheritance and
      *      polymorphism in the node classes.
      */
+    PhaseTimer *timer = new PhaseTimer(Stats::PreEmit);
     int offset = CodeGenerator::OffsetToFirstGlobal;
 
     for (int i = 0, n = decls->NumElements(); i < n; ++i) {
@@ -78,10 +135,66 @@ void Program::Emit() {
     for (int i = 0, n = decls->NumElements(); i < n; ++i)
         decls->Nth(i)->PreEmit();
 
-    for (int i = 0, n = decls->NumElements(); i < n; ++i)
-        decls->Nth(i)->Emit(codeGenerator);
+    delete timer;
+    timer = new PhaseTimer(Stats::Emit);
+
+    /* Once the layouts and labels are fixed, the functions no longer
+     * depend on one another, so each one is translated as a unit of its
+     * own, in parallel if the context has a thread pool. The units are
+     * written out in declaration order (methods, then the vtable, for
+     * a class), so the output is the same however the work was split.
+     * A unit's code is buffered until it is written out, so only a few
+     * units per thread are handed to the pool ahead of the one being
+     * written, and memory doesn't grow with the size of the program.
+     */
+    List<CodeUnit*> *units = new List<CodeUnit*>;
+    for (int i = 0, n = decls->NumElements(); i < n; ++i) {
+        Decl *d = decls->Nth(i);
+        ClassDecl *c = dynamic_cast<ClassDecl*>(d);
+        if (c != NULL) {
+            List<Decl*> *members = c->GetMembers();
+            for (int j = 0, m = members->NumElements(); j < m; ++j) {
+                FnDecl *f = dynamic_cast<FnDecl*>(members->Nth(j));
+                if (f != NULL)
+                    AddCodeUnit(units, f, NULL);
+            }
+            AddCodeUnit(units, NULL, c);
+        } else if (dynamic_cast<FnDecl*>(d) != NULL) {
+            AddCodeUnit(units, static_cast<FnDecl*>(d), NULL);
+        }
+    }
 
+    CompilationContext *ctx = CompilationContext::Current();
+    ThreadPool *pool = ctx->GetThreadPool();
+    int ahead = (pool != NULL ? 2 * pool->NumThreads() : 0);
+    int numSubmitted = 0;
+
+    codeGenerator->EmitPreamble();
+    for (int i = 0, n = units->NumElements(); i < n; ++i) {
+        for (; pool != NULL && numSubmitted <= i + ahead && numSubmitted < n;
+             ++numSubmitted) {
+            CodeUnit *next = units->Nth(numSubmitted);
+            pool->Submit([next, ctx]() {
+                CompilationContext *prev = CompilationContext::SetCurrent(ctx);
+                EmitCodeUnit(next);
+                CompilationContext::SetCurrent(prev);
+            }, &next->done);
+        }
+        CodeUnit *u = units->Nth(i);
+        if (pool != NULL)
+            pool->Wait(&u->done);
+        else
+            EmitCodeUnit(u);
+        codeGenerator->Append(u->cg);
+        delete u->cg;
+        delete u;
+    }
+    delete units;
+
+    delete timer;
+    timer = new PhaseTimer(Stats::FinalCodeGen);
     codeGenerator->DoFinalCodeGen();
+    delete timer;
 }
 
 Stmt::Stmt() : Node() {
@@ -92,12 +205,25 @@ Stmt::Stmt(yyltype loc) : Node(loc) {
     scope = new Scope;
 }
 
+Stmt::~Stmt() {
+    delete scope;
+}
+
 StmtBlock::StmtBlock(List<VarDecl*> *d, List<Stmt*> *s) {
     Assert(d != NULL && s != NULL);
     (decls=d)->SetParentAll(this);
     (stmts=s)->SetParentAll(this);
 }
 
+StmtBlock::~StmtBlock() {
+    for (int i = 0, n = decls->NumElements(); i < n; ++i)
+        delete decls->Nth(i);
+    for (int i = 0, n = stmts->NumElements(); i < n; ++i)
+        delete stmts->Nth(i);
+    delete decls;
+    delete stmts;
+}
+
 void StmtBlock::BuildScope() {
     for (int i = 0, n = decls->NumElements(); i < n; ++i)
         scope->AddDecl(decls->Nth(i));
@@ -142,6 +268,11 @@ ConditionalStmt::ConditionalStmt(Expr *t, Stmt *b) {
     (body=b)->SetParent(this);
 }
 
+ConditionalStmt::~ConditionalStmt() {
+    delete test;
+    delete body;
+}
+
 void ConditionalStmt::BuildScope() {
     test->BuildScope();
     body->BuildScope();
@@ -151,12 +282,21 @@ void LoopStmt::BuildScope() {
     ConditionalStmt::BuildScope();
 }
 
+bool LoopStmt::IsRotated() {
+    return CompilationContext::Current()->GetOptimize();
+}
+
 ForStmt::ForStmt(Expr *i, Expr *t, Expr *s, Stmt *b): LoopStmt(t, b) {
     Assert(i != NULL && t != NULL && s != NULL && b != NULL);
     (init=i)->SetParent(this);
     (step=s)->SetParent(this);
 }
 
+ForStmt::~ForStmt() {
+    delete init;
+    delete step;
+}
+
 void ForStmt::BuildScope() {
     LoopStmt::BuildScope();
 
@@ -168,26 +308,216 @@ Location* ForStmt::Emit(CodeGenerator *cg) {
     const char* top = cg->NewLabel();
     const char* bot = cg->NewLabel();
 
-    Program::gBreakLabels->push(bot);
+    cg->PushBreakLabel(bot);
 
     init->Emit(cg);
-    cg->GenLabel(top);
-    Location *t = test->Emit(cg);
-    cg->GenIfZ(t, bot);
-    body->Emit(cg);
-    step->Emit(cg);
-    cg->GenGoto(top);
+    if (IsRotated()) {
+        EmitRotated(cg, top, bot);
+    } else {
+        cg->GenLabel(top);
+        Location *t = test->Emit(cg);
+        cg->GenIfZ(t, bot);
+        body->Emit(cg);
+        step->Emit(cg);
+        cg->GenGoto(top);
+    }
     cg->GenLabel(bot);
 
-    Program::gBreakLabels->pop();
+    cg->PopBreakLabel();
 
     return NULL;
 
 }
 
 int ForStmt::GetMemBytes() {
-    return init->GetMemBytes() + test->GetMemBytes() +
-           body->GetMemBytes() + step->GetMemBytes();
+    if (!IsRotated())
+        return init->GetMemBytes() + test->GetMemBytes() +
+               body->GetMemBytes() + step->GetMemBytes();
+
+    // The test three times, the unrolled test (the bound less a constant)
+    // twice, and the body and step as many times as they are unrolled,
+    // plus one for the loop of one copy and one for the first try
+    return init->GetMemBytes() + 5 * test->GetMemBytes() +
+           4 * CodeGenerator::VarSize +
+           (MaxUnroll + 2) * (body->GetMemBytes() + step->GetMemBytes());
+}
+
+// Returns whether e names the local variable at loc
+static bool IsLocal(Expr *e, Location *loc) {
+    FieldAccess *f = dynamic_cast<FieldAccess*>(e);
+    return f != NULL && f->GetLocalLoc() == loc;
+}
+
+// Returns the local variable read by the bound of a counted loop: n for
+// n, a for a.length(), or NULL for anything else
+static Location* GetBoundLoc(Expr *bound) {
+    Call *c = dynamic_cast<Call*>(bound);
+    if (c != NULL && c->GetLengthOf() != NULL)
+        bound = c->GetLengthOf();
+    FieldAccess *f = dynamic_cast<FieldAccess*>(bound);
+    return (f == NULL ? NULL : f->GetLocalLoc());
+}
+
+/* Method: IsCounted
+ * -----------------
+ * A loop is counted if init assigns a local variable (the counter), the
+ * test is counter < bound or counter <= bound, and the step adds a
+ * positive constant (the stride) to the counter. The bound must be a
+ * constant, a.length() for a local a, or a local n (then only if the
+ * counter starts at a constant, which can't be negative, so that n less
+ * a little can't overflow when the loop runs at all).
+ */
+bool ForStmt::IsCounted(Location **counter, int *stride) {
+    AssignExpr *a = dynamic_cast<AssignExpr*>(init);
+    AssignExpr *s = dynamic_cast<AssignExpr*>(step);
+    RelationalExpr *t = dynamic_cast<RelationalExpr*>(test);
+    if (a == NULL || s == NULL || t == NULL ||
+        (strcmp(t->GetOpName(), "<") != 0 && strcmp(t->GetOpName(), "<=") != 0))
+        return false;
+
+    FieldAccess *var = dynamic_cast<FieldAccess*>(a->GetLeft());
+    *counter = (var == NULL ? NULL : var->GetLocalLoc());
+    if (*counter == NULL || !IsLocal(t->GetLeft(), *counter) ||
+        !IsLocal(s->GetLeft(), *counter))
+        return false;
+
+    ArithmeticExpr *add = dynamic_cast<ArithmeticExpr*>(s->GetRight());
+    if (add == NULL || strcmp(add->GetOpName(), "+") != 0 ||
+        !IsLocal(add->GetLeft(), *counter))
+        return false;
+    IntConstant *c = dynamic_cast<IntConstant*>(add->GetRight());
+    if (c == NULL || c->GetValue() <= 0)
+        return false;
+    *stride = c->GetValue();
+
+    Expr *bound = t->GetRight();
+    if (dynamic_cast<IntConstant*>(bound) != NULL)
+        return true;
+    Call *length = dynamic_cast<Call*>(bound);
+    if (length != NULL && length->GetLengthOf() != NULL)
+        return GetBoundLoc(bound) != NULL;
+    return GetBoundLoc(bound) != NULL &&
+           dynamic_cast<IntConstant*>(a->GetRight()) != NULL;
+}
+
+// Returns the number of times a counted loop runs, or -1 if that is not
+// a constant
+int ForStmt::GetTripCount(int stride) {
+    RelationalExpr *t = static_cast<RelationalExpr*>(test);
+    IntConstant *start = dynamic_cast<IntConstant*>(
+        static_cast<AssignExpr*>(init)->GetRight());
+    IntConstant *bound = dynamic_cast<IntConstant*>(t->GetRight());
+    if (start == NULL || bound == NULL)
+        return -1;
+
+    long long span = (long long)bound->GetValue() - start->GetValue();
+    if (strcmp(t->GetOpName(), "<=") == 0)
+        span++;
+    return (span <= 0 ? 0 : (int)((span + stride - 1) / stride));
+}
+
+// Emits the test that the counter will still pass after going up by
+// slack, i.e. counter < bound - slack (counter <= bound - slack for <=)
+Location* ForStmt::EmitUnrolledTest(CodeGenerator *cg, Location *counter,
+                                    int slack) {
+    RelationalExpr *t = static_cast<RelationalExpr*>(test);
+    if (strcmp(t->GetOpName(), "<=") == 0)
+        slack--;
+    Location *bound = t->GetRight()->Emit(cg);
+    Location *last = cg->GenBinaryOp("-", bound, cg->GenLoadConstant(slack));
+    return cg->GenBinaryOp("<", counter, last);
+}
+
+/* Method: EmitRotated
+ * -------------------
+ * Lays the loop out with the test at the bottom (see LoopStmt). A counted
+ * loop whose body leaves the counter and the bound alone is unrolled, if
+ * the copies fit the budget. That can only be told from the Tac of the
+ * body, so the body is generated once to find out (and thrown away if
+ * it is to go elsewhere). If the loop runs a constant number of times,
+ * few enough, the copies of the body simply follow one another with no
+ * tests at all. Otherwise, the copies run one after the other with a
+ * single test (at the bottom) for all of them, for as long as the counter
+ * is far enough below the bound, and a loop of one copy does the rest:
+ *
+ *           IfZ test Goto bot          (left out if it can't fail)
+ *           IfZ counter < bound - (copies - 1) * stride Goto top
+ *     main: body; step; ... body; step
+ *           IfNZ counter < bound - (copies - 1) * stride Goto main
+ *           IfZ test Goto bot
+ *      top: body; step
+ *           IfNZ test Goto top
+ *      bot:
+ *
+ * If the bound is a.length() and the counter starts at a constant (so at
+ * 0 or more), the copies in main don't check the subscript of a[counter]
+ * again: the test in front of them has done that for all of them.
+ */
+void ForStmt::EmitRotated(CodeGenerator *cg, const char *top,
+                          const char *bot) {
+    Location *counter = NULL;
+    int stride = 0;
+    bool counted = IsCounted(&counter, &stride);
+    int trips = (counted ? GetTripCount(stride) : -1);
+    RelationalExpr *t = dynamic_cast<RelationalExpr*>(test);
+    Location *boundLoc = (counted ? GetBoundLoc(t->GetRight()) : NULL);
+
+    if (trips < 1)
+        cg->GenIfZ(test->Emit(cg), bot);
+    int first = cg->GetNumInstructions();
+    cg->GenLabel(top);
+    body->Emit(cg);
+    int size = cg->GetNumInstructions() - first - 1;
+    if (counted && (cg->IsAssignedSince(first, counter) ||
+                    (boundLoc != NULL && cg->IsAssignedSince(first, boundLoc))))
+        counted = false;
+
+    if (counted && trips >= 1 && trips <= MaxUnroll &&
+        trips * size <= UnrollBudget) {
+        step->Emit(cg);
+        for (int i = 1; i < trips; ++i) {
+            body->Emit(cg);
+            step->Emit(cg);
+        }
+        Stats::Count(Stats::LoopsUnrolled);
+        return;
+    }
+
+    int copies = MaxUnroll;
+    while (copies > 1 && copies * size > UnrollBudget)
+        copies /= 2;
+    if (!counted || copies < 2 || stride > INT_MAX / MaxUnroll) {
+        step->Emit(cg);
+        cg->GenIfNZ(test->Emit(cg), top);
+        return;
+    }
+
+    cg->DiscardSince(first);
+    const char *unrolled = cg->NewLabel();
+    Call *length = dynamic_cast<Call*>(t->GetRight());
+    IntConstant *start = dynamic_cast<IntConstant*>(
+        static_cast<AssignExpr*>(init)->GetRight());
+    bool inBounds = (length != NULL && length->GetLengthOf() != NULL &&
+                     strcmp(t->GetOpName(), "<") == 0 &&
+                     start != NULL && start->GetValue() >= 0);
+
+    cg->GenIfZ(EmitUnrolledTest(cg, counter, (copies - 1) * stride), top);
+    cg->GenLabel(unrolled);
+    if (inBounds)
+        cg->PushInBounds(boundLoc, counter);
+    for (int i = 0; i < copies; ++i) {
+        body->Emit(cg);
+        step->Emit(cg);
+    }
+    if (inBounds)
+        cg->PopInBounds();
+    cg->GenIfNZ(EmitUnrolledTest(cg, counter, (copies - 1) * stride), unrolled);
+    cg->GenIfZ(test->Emit(cg), bot);
+    cg->GenLabel(top);
+    body->Emit(cg);
+    step->Emit(cg);
+    cg->GenIfNZ(test->Emit(cg), top);
+    Stats::Count(Stats::LoopsUnrolled);
 }
 
 void WhileStmt::BuildScope() {
@@ -198,22 +528,29 @@ Location* WhileStmt::Emit(CodeGenerator *cg) {
     const char* top = cg->NewLabel();
     const char* bot = cg->NewLabel();
 
-    Program::gBreakLabels->push(bot);
-
-    cg->GenLabel(top);
-    Location *t = test->Emit(cg);
-    cg->GenIfZ(t, bot);
-    body->Emit(cg);
-    cg->GenGoto(top);
+    cg->PushBreakLabel(bot);
+
+    if (IsRotated()) {
+        cg->GenIfZ(test->Emit(cg), bot);
+        cg->GenLabel(top);
+        body->Emit(cg);
+        cg->GenIfNZ(test->Emit(cg), top);
+    } else {
+        cg->GenLabel(top);
+        Location *t = test->Emit(cg);
+        cg->GenIfZ(t, bot);
+        body->Emit(cg);
+        cg->GenGoto(top);
+    }
     cg->GenLabel(bot);
 
-    Program::gBreakLabels->pop();
+    cg->PopBreakLabel();
 
     return NULL;
 }
 
 int WhileStmt::GetMemBytes() {
-    return test->GetMemBytes() + body->GetMemBytes();
+    return (IsRotated() ? 2 : 1) * test->GetMemBytes() + body->GetMemBytes();
 }
 
 IfStmt::IfStmt(Expr *t, Stmt *tb, Stmt *eb): ConditionalStmt(t, tb) {
@@ -222,6 +559,10 @@ IfStmt::IfStmt(Expr *t, Stmt *tb, Stmt *eb): ConditionalStmt(t, tb) {
     if (elseBody) elseBody->SetParent(this);
 }
 
+IfStmt::~IfStmt() {
+    delete elseBody;
+}
+
 void IfStmt::BuildScope() {
     ConditionalStmt::BuildScope();
 
@@ -250,7 +591,7 @@ int IfStmt::GetMemBytes() {
 }
 
 Location* BreakStmt::Emit(CodeGenerator *cg) {
-    cg->GenGoto(Program::gBreakLabels->top());
+    cg->GenGoto(cg->GetBreakLabel());
     return NULL;
 }
 
@@ -263,13 +604,20 @@ ReturnStmt::ReturnStmt(yyltype loc, Expr *e) : Stmt(loc) {
     (expr=e)->SetParent(this);
 }
 
+ReturnStmt::~ReturnStmt() {
+    delete expr;
+}
+
 void ReturnStmt::BuildScope() {
     expr->BuildScope();
 }
 
 Location* ReturnStmt::Emit(CodeGenerator *cg) {
+    Call *call = dynamic_cast<Call*>(expr);
     if (expr == NULL)
         cg->GenReturn();
+    else if (call != NULL && call->IsSelfTailCall())
+        call->EmitSelfTailCall(cg);
     else
         cg->GenReturn(expr->Emit(cg));
 
@@ -288,6 +636,12 @@ PrintStmt::PrintStmt(List<Expr*> *a) {
     (args=a)->SetParentAll(this);
 }
 
+PrintStmt::~PrintStmt() {
+    for (int i = 0, n = args->NumElements(); i < n; ++i)
+        delete args->Nth(i);
+    delete args;
+}
+
 void PrintStmt::BuildScope() {
     for (int i = 0, n = args->NumElements(); i < n; ++i)
         args->Nth(i)->BuildScope();
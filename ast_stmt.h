@@ -15,7 +15,6 @@
 #include "list.h"
 #include "ast.h"
 #include "hashtable.h"
-#include <stack>
 
 class Decl;
 class VarDecl;
@@ -30,6 +29,7 @@ class Scope
 
   public:
     Scope();
+    ~Scope();
 
     void AddDecl(Decl *d);
     friend ostream& operator<<(ostream& out, Scope *s);
@@ -37,19 +37,19 @@ class Scope
 
 class Program : public Node
 {
-  public:
-    static Scope *gScope;
-    static stack<const char*> *gBreakLabels;
-
   protected:
      List<Decl*> *decls;
      CodeGenerator *codeGenerator;
 
   public:
      Program(List<Decl*> *declList);
+     ~Program();
      void Check();
      void Emit();
 
+     // Returns the global scope of the program currently being compiled
+     static Scope* GetGlobalScope();
+
   private:
     void BuildScope();
 };
@@ -59,6 +59,7 @@ class Stmt : public Node
   public:
     Stmt();
     Stmt(yyltype loc);
+    ~Stmt();
 
     virtual void BuildScope() = 0;
     virtual Location* Emit(CodeGenerator *cg) = 0;
@@ -73,6 +74,7 @@ class StmtBlock : public Stmt
 
   public:
     StmtBlock(List<VarDecl*> *variableDeclarations, List<Stmt*> *statements);
+    ~StmtBlock();
 
     void BuildScope();
     Location* Emit(CodeGenerator *cg);
@@ -87,6 +89,7 @@ class ConditionalStmt : public Stmt
 
   public:
     ConditionalStmt(Expr *testExpr, Stmt *body);
+    ~ConditionalStmt();
 
     virtual void BuildScope() = 0;
 };
@@ -98,6 +101,12 @@ class LoopStmt : public ConditionalStmt
             : ConditionalStmt(testExpr, body) {}
 
     virtual void BuildScope() = 0;
+
+  protected:
+    // When optimizing, the test is emitted twice: once ahead of the body,
+    // to skip the loop, and once after it, to branch back to the top, so
+    // that each turn of the loop takes a single branch
+    bool IsRotated();
 };
 
 class ForStmt : public LoopStmt
@@ -105,12 +114,25 @@ class ForStmt : public LoopStmt
   protected:
     Expr *init, *step;
 
+    // A counted loop (for (i = ...; i < n; i = i + c)) is unrolled, when
+    // optimizing, into at most MaxUnroll copies of the body, which may
+    // come to no more than UnrollBudget Tac instructions (see Emit)
+    static const int MaxUnroll = 8, UnrollBudget = 200;
+
   public:
     ForStmt(Expr *init, Expr *test, Expr *step, Stmt *body);
+    ~ForStmt();
 
     void BuildScope();
     Location* Emit(CodeGenerator *cg);
     int GetMemBytes();
+
+  private:
+    bool IsCounted(Location **counter, int *stride);
+    int GetTripCount(int stride);
+    Location* EmitUnrolledTest(CodeGenerator *cg, Location *counter,
+                               int slack);
+    void EmitRotated(CodeGenerator *cg, const char *top, const char *bot);
 };
 
 class WhileStmt : public LoopStmt
@@ -130,6 +152,7 @@ class IfStmt : public ConditionalStmt
 
   public:
     IfStmt(Expr *test, Stmt *thenBody, Stmt *elseBody);
+    ~IfStmt();
 
     void BuildScope();
     Location* Emit(CodeGenerator *cg);
@@ -153,6 +176,7 @@ class ReturnStmt : public Stmt
 
   public:
     ReturnStmt(yyltype loc, Expr *expr);
+    ~ReturnStmt();
 
     void BuildScope();
     Location* Emit(CodeGenerator *cg);
@@ -166,6 +190,7 @@ class PrintStmt : public Stmt
 
   public:
     PrintStmt(List<Expr*> *arguments);
+    ~PrintStmt();
 
     void BuildScope();
     Location* Emit(CodeGenerator *cg);
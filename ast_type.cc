@@ -44,6 +44,10 @@ NamedType::NamedType(Identifier *i) : Type(*i->GetLocation()) {
     (id=i)->SetParent(this);
 }
 
+NamedType::~NamedType() {
+    delete id;
+}
+
 BuiltIn NamedType::GetPrint() {
     return NumBuiltIns;
 }
@@ -27,9 +27,13 @@ class Type : public Node
     static Type *intType, *doubleType, *boolType, *voidType,
                 *nullType, *stringType, *errorType;
 
-    Type(yyltype loc) : Node(loc) {}
+    Type(yyltype loc) : Node(loc), typeName(NULL) {}
     Type(const char *str);
-    Type() : Node() {}
+    Type() : Node(), typeName(NULL) {}
+
+    // The built-in types are shared by every compilation in the process
+    // (possibly running on several threads), so they don't track a parent.
+    void SetParent(Node *p) { if (typeName == NULL) Node::SetParent(p); }
 
     virtual const char* GetName() { return typeName; }
 
@@ -46,6 +50,7 @@ class NamedType : public Type
 
   public:
     NamedType(Identifier *i);
+    ~NamedType();
 
     const char* GetName() { return id->GetName(); }
 
@@ -0,0 +1,74 @@
+#! /bin/sh
+#
+# Measures how dcc scales with the size of its input. For each shape of
+# program decafgen knows how to make (or just the ones named on the
+# command line), it compiles a generated program at each of a series of
+# sizes and reports the wall time, peak RSS and size of the output. The
+# exponent k in time ~ n^k is estimated between each pair of neighbouring
+# sizes; a size point where k exceeds $SUPERLINEAR (1.3 by default) is
+# flagged. Each shape's sizes can be overridden through the environment,
+# e.g. SIZES_classes="25 50 100" sh bench.sh classes
+
+[ -x dcc ] || { echo "Error: dcc not executable"; exit 1; }
+[ -x decafgen ] || { echo "Error: decafgen not executable"; exit 1; }
+
+SUPERLINEAR=${SUPERLINEAR:-"1.3"}
+
+# The class chain is by far the most expensive shape (every class looks
+# through all of its ancestors' members), so it gets much smaller sizes
+SIZES_classes=${SIZES_classes:-"50 100 200 400"}
+SIZES_methods=${SIZES_methods:-"500 1000 2000 4000"}
+SIZES_expr=${SIZES_expr:-"500 1000 2000 4000"}
+SIZES_nesting=${SIZES_nesting:-"250 500 1000 2000"}
+SIZES_globals=${SIZES_globals:-"500 1000 2000 4000"}
+
+SHAPES="$@"
+if [ "$#" = "0" ]; then
+	SHAPES="classes methods expr nesting globals"
+fi
+
+tmp=${TMP:-"/tmp"}/bench
+status=0
+
+printf "%-8s %6s %10s %10s %10s %6s\n" shape n "time (ms)" "rss (KB)" "out (B)" k
+for shape in $SHAPES; do
+	sizes=`eval echo \\$SIZES_$shape`
+	prevn=
+	prevms=
+	for n in $sizes; do
+		./decafgen $shape $n > $tmp.decaf || exit 2
+
+		start=`date +%s%N`
+		./dcc -d timing < $tmp.decaf > $tmp.s 2> $tmp.err
+		rc=$?
+		end=`date +%s%N`
+
+		ms=`expr \( $end - $start \) / 1000000`
+		rss=`sed -n 's/^ *peak rss *\([0-9]*\) KB$/\1/p' $tmp.err`
+		size=`wc -c < $tmp.s`
+
+		k=
+		note=
+		if [ $rc != 0 ]; then
+			note="dcc failed ($rc)"
+			status=1
+		elif [ -n "$prevn" ]; then
+			# Times under a few milliseconds are mostly noise, so the
+			# exponent is only estimated once both of them exceed 10ms
+			k=`awk -v n0=$prevn -v n1=$n -v t0=$prevms -v t1=$ms 'BEGIN {
+				if (t0 < 10 || t1 < 10) print "-";
+				else printf "%.2f", log(t1 / t0) / log(n1 / n0) }'`
+			if [ "$k" != "-" ] && awk -v k=$k -v max=$SUPERLINEAR 'BEGIN { exit !(k > max) }'; then
+				note="superlinear <--"
+				status=1
+			fi
+		fi
+
+		printf "%-8s %6d %10d %10s %10d %6s  %s\n" $shape $n $ms "$rss" $size "$k" "$note"
+		prevn=$n
+		prevms=$ms
+	done
+done
+
+rm -f $tmp.decaf $tmp.s $tmp.err
+exit $status
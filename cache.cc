@@ -0,0 +1,79 @@
+/* File: cache.cc
+ * --------------
+ * Implementation of the CompileCache class.
+ */
+
+#include "cache.h"
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <thread>
+#include <functional>
+
+// Changing what code is generated for a given input means older cache
+// entries are no longer valid, so this must be bumped along with it.
+static const char *const CompilerVersion = "dcc 20";
+
+CompileCache::CompileCache(const char *d, const char *f) : dir(d), flags(f) {
+    mkdir(d, 0777); // fails harmlessly if it already exists
+}
+
+/* Method: KeyFor
+ * --------------
+ * The key is the 128-bit FNV-1a hash of the compiler version, the flags,
+ * the kind, and the data (with a separator between each, so that
+ * different splits of the same bytes can't collide), written in hex.
+ */
+std::string CompileCache::KeyFor(const char *kind, const char *data, size_t size) {
+    const unsigned __int128 prime =
+        ((unsigned __int128)0x1000000ULL << 64) | 0x13BULL;
+    unsigned __int128 hash =
+        ((unsigned __int128)0x6c62272e07bb0142ULL << 64) | 0x62b821756295c58dULL;
+
+    const char *parts[] = { CompilerVersion, flags.c_str(), kind };
+    for (int i = 0; i < 3; i++) {
+        for (const char *p = parts[i]; ; p++) {
+            hash = (hash ^ (unsigned char)*p) * prime;
+            if (*p == '\0')
+                break;
+        }
+    }
+    for (size_t i = 0; i < size; i++)
+        hash = (hash ^ (unsigned char)data[i]) * prime;
+
+    char hex[33];
+    sprintf(hex, "%016llx%016llx", (unsigned long long)(hash >> 64),
+            (unsigned long long)hash);
+    return std::string(kind) + "-" + hex;
+}
+
+bool CompileCache::Lookup(const std::string &key, std::string *contents) {
+    FILE *f = fopen((dir + "/" + key).c_str(), "rb");
+    if (f == NULL)
+        return false;
+
+    contents->clear();
+    char buf[8192];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+        contents->append(buf, n);
+    bool ok = !ferror(f);
+    fclose(f);
+    return ok;
+}
+
+void CompileCache::Store(const std::string &key, const std::string &contents) {
+    char unique[64];
+    sprintf(unique, ".tmp.%d.%zx", (int)getpid(),
+            std::hash<std::thread::id>()(std::this_thread::get_id()));
+    std::string path = dir + "/" + key, tmp = path + unique;
+
+    FILE *f = fopen(tmp.c_str(), "wb");
+    if (f == NULL)
+        return;
+    bool ok = (fwrite(contents.data(), 1, contents.size(), f) == contents.size());
+    if (fclose(f) != 0 || !ok || rename(tmp.c_str(), path.c_str()) != 0)
+        remove(tmp.c_str());
+}
@@ -0,0 +1,48 @@
+/* File: cache.h
+ * -------------
+ * The CompileCache class keeps the results of earlier compilations in a
+ * directory on disk, so that they do not have to be done again. It is
+ * content-addressed: each entry is stored under a hash of everything
+ * that went into making it (the compiler version, the flags that affect
+ * the output, and the input itself), so an entry never needs to be
+ * invalidated, a changed input simply gets a different key.
+ *
+ * Two kinds of entries are kept: the assembly for a whole source file
+ * (see CompilationContext::Compile), and the mips translation of a single
+ * function, keyed by its Tac (see CodeGenerator::FlushCode), so that
+ * after editing one method only that method has to be lowered again.
+ *
+ * Entries are written to a temporary file and then renamed into place,
+ * so any number of threads and dcc processes can share one cache.
+ */
+
+#ifndef _H_cache
+#define _H_cache
+
+#include <stddef.h>
+#include <string>
+
+class CompileCache
+{
+  private:
+    std::string dir, flags;
+
+  public:
+         // The directory is created if it does not exist yet. The flags
+         // should hold every option that changes the code generated.
+    CompileCache(const char *dir, const char *flags);
+
+         // Returns the key for an entry of the given kind made from the
+         // size bytes of data
+    std::string KeyFor(const char *kind, const char *data, size_t size);
+
+         // Fills in contents and returns true if there is an entry for
+         // key, else returns false
+    bool Lookup(const std::string &key, std::string *contents);
+
+         // Adds an entry for key. Failures are silently ignored (the
+         // cache is only an optimization).
+    void Store(const std::string &key, const std::string &contents);
+};
+
+#endif
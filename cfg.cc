@@ -0,0 +1,391 @@
+/* File: cfg.cc
+ * ------------
+ * Implementation of the FlowGraph and BasicBlock classes.
+ */
+
+#include "cfg.h"
+#include <algorithm>
+#include <set>
+#include <string.h>
+
+BasicBlock::BasicBlock(int i) {
+  id = i;
+  idom = NULL;
+  rpoNumber = -1;
+}
+
+Instruction *BasicBlock::GetBranch() {
+  if (code.empty())
+    return NULL;
+  Instruction *last = code.back();
+  if (dynamic_cast<Goto*>(last) || dynamic_cast<IfZ*>(last) ||
+      dynamic_cast<Return*>(last))
+    return last;
+  LCall *call = dynamic_cast<LCall*>(last);
+  if (call != NULL && strcmp(call->GetLabel(), "_Halt") == 0)
+    return last;
+  return NULL;
+}
+
+int BasicBlock::PredIndex(BasicBlock *pred) {
+  for (size_t i = 0; i < preds.size(); i++)
+    if (preds[i] == pred)
+      return i;
+  return -1;
+}
+
+bool BasicBlock::Dominates(BasicBlock *b) {
+  for (; b != NULL; b = b->idom)
+    if (b == this)
+      return true;
+  return false;
+}
+
+
+/* Constructor: FlowGraph
+ * ----------------------
+ * A new block starts at each Label and after each branch. The header is
+ * everything up to and including the BeginFunc.
+ */
+FlowGraph::FlowGraph(List<Instruction*> *code) {
+  int n = code->NumElements();
+  int i = 0;
+  for (; i < n; i++) {
+    header.push_back(code->Nth(i));
+    if (dynamic_cast<BeginFunc*>(code->Nth(i)) != NULL)
+      break;
+  }
+  Assert(i < n && dynamic_cast<EndFunc*>(code->Nth(n - 1)) != NULL);
+  footer.push_back(code->Nth(n - 1));
+
+  NewBlock();                         // the entry block
+  BasicBlock *current = NewBlock();
+  for (i++; i < n - 1; i++) {
+    Instruction *instr = code->Nth(i);
+    Label *label = dynamic_cast<Label*>(instr);
+    if (label != NULL) {
+      if (!current->code.empty())
+        current = NewBlock();
+      labels[label->GetLabel()] = current;
+    }
+    current->code.push_back(instr);
+    if (current->GetBranch() != NULL)
+      current = NewBlock();
+  }
+  while (code->NumElements() > 0)
+    code->RemoveAt(code->NumElements() - 1);
+  Rebuild();
+}
+
+FlowGraph::~FlowGraph() {
+  for (size_t b = 0; b < blocks.size(); b++)
+    delete blocks[b];
+}
+
+BasicBlock *FlowGraph::NewBlock() {
+  BasicBlock *b = new BasicBlock(blocks.size());
+  blocks.push_back(b);
+  return b;
+}
+
+BasicBlock *FlowGraph::BlockForLabel(const char *label) {
+  std::map<std::string, BasicBlock*>::iterator i = labels.find(label);
+  return (i == labels.end() ? NULL : i->second);
+}
+
+void FlowGraph::AddEdge(BasicBlock *from, BasicBlock *to) {
+  // an IfZ to the label just after it has only the one successor
+  if (std::find(from->succs.begin(), from->succs.end(), to) != from->succs.end())
+    return;
+  from->succs.push_back(to);
+  to->preds.push_back(from);
+}
+
+// Inner loops have fewer blocks than the loops around them
+static bool IsSmaller(const Loop &a, const Loop &b) {
+  return a.blocks.size() < b.blocks.size();
+}
+
+std::vector<Loop> FlowGraph::FindLoops() {
+  std::vector<Loop> loops;
+  for (size_t i = 0; i < rpo.size(); i++) {
+    BasicBlock *h = rpo[i];
+    Loop loop;
+    loop.header = h;
+    loop.inLoop.assign(blocks.size(), false);
+    loop.inLoop[h->id] = true;
+    std::vector<BasicBlock*> work;
+    bool isHeader = false;          // a branch back to itself makes it one
+    for (size_t p = 0; p < h->preds.size(); p++) {
+      if (h->Dominates(h->preds[p])) {
+        isHeader = true;
+        if (!loop.inLoop[h->preds[p]->id]) {
+          loop.inLoop[h->preds[p]->id] = true;
+          work.push_back(h->preds[p]);
+        }
+      }
+    }
+    if (!isHeader)
+      continue;
+    while (!work.empty()) {
+      BasicBlock *b = work.back();
+      work.pop_back();
+      for (size_t p = 0; p < b->preds.size(); p++) {
+        BasicBlock *pred = b->preds[p];
+        if (pred->rpoNumber >= 0 && !loop.inLoop[pred->id]) {
+          loop.inLoop[pred->id] = true;
+          work.push_back(pred);
+        }
+      }
+    }
+    for (size_t j = i; j < rpo.size(); j++)
+      if (loop.inLoop[rpo[j]->id])
+        loop.blocks.push_back(rpo[j]);
+    loops.push_back(loop);
+  }
+  std::stable_sort(loops.begin(), loops.end(), IsSmaller);
+  return loops;
+}
+
+/* Method: Rebuild
+ * ---------------
+ * Follows the branches out from the entry, so that only reachable
+ * blocks get edges. A block that is not reached has its code deleted.
+ */
+void FlowGraph::Rebuild() {
+  for (size_t b = 0; b < blocks.size(); b++) {
+    blocks[b]->succs.clear();
+    blocks[b]->preds.clear();
+  }
+
+  std::vector<bool> reached(blocks.size(), false);
+  std::vector<BasicBlock*> work(1, GetEntry());
+  reached[0] = true;
+  while (!work.empty()) {
+    BasicBlock *b = work.back();
+    work.pop_back();
+    Instruction *branch = b->GetBranch();
+    std::vector<BasicBlock*> targets;
+    if (Goto *g = dynamic_cast<Goto*>(branch))
+      targets.push_back(BlockForLabel(g->GetLabel()));
+    else if (IfZ *ifz = dynamic_cast<IfZ*>(branch))
+      targets.push_back(BlockForLabel(ifz->GetLabel()));
+    if (branch == NULL || dynamic_cast<IfZ*>(branch) != NULL) {
+      if (b->id + 1 < (int)blocks.size())  // else it falls off the end
+        targets.push_back(blocks[b->id + 1]);
+    }
+    for (size_t t = 0; t < targets.size(); t++) {
+      Assert(targets[t] != NULL);
+      AddEdge(b, targets[t]);
+      if (!reached[targets[t]->id]) {
+        reached[targets[t]->id] = true;
+        work.push_back(targets[t]);
+      }
+    }
+  }
+
+  for (size_t b = 0; b < blocks.size(); b++) {
+    if (reached[b])
+      continue;
+    for (size_t i = 0; i < blocks[b]->code.size(); i++) {
+      if (Label *l = dynamic_cast<Label*>(blocks[b]->code[i]))
+        labels.erase(l->GetLabel());
+      delete blocks[b]->code[i];
+    }
+    blocks[b]->code.clear();
+  }
+  ComputeOrder();
+}
+
+// Numbers the reachable blocks in reverse postorder
+void FlowGraph::ComputeOrder() {
+  std::vector<BasicBlock*> post;
+  std::vector<bool> visited(blocks.size(), false);
+  std::vector<std::pair<BasicBlock*, size_t> > stack;
+  stack.push_back(std::make_pair(GetEntry(), 0));
+  visited[0] = true;
+  while (!stack.empty()) {
+    BasicBlock *b = stack.back().first;
+    size_t next = stack.back().second;
+    if (next < b->succs.size()) {
+      stack.back().second++;
+      BasicBlock *s = b->succs[next];
+      if (!visited[s->id]) {
+        visited[s->id] = true;
+        stack.push_back(std::make_pair(s, 0));
+      }
+    } else {
+      post.push_back(b);
+      stack.pop_back();
+    }
+  }
+  rpo.assign(post.rbegin(), post.rend());
+  for (size_t b = 0; b < blocks.size(); b++)
+    blocks[b]->rpoNumber = -1;
+  for (size_t i = 0; i < rpo.size(); i++)
+    rpo[i]->rpoNumber = i;
+}
+
+BasicBlock *FlowGraph::Intersect(BasicBlock *a, BasicBlock *b) {
+  while (a != b) {
+    while (a->rpoNumber > b->rpoNumber)
+      a = a->idom;
+    while (b->rpoNumber > a->rpoNumber)
+      b = b->idom;
+  }
+  return a;
+}
+
+void FlowGraph::ComputeDominators() {
+  for (size_t b = 0; b < blocks.size(); b++) {
+    blocks[b]->idom = NULL;
+    blocks[b]->children.clear();
+    blocks[b]->frontier.clear();
+  }
+  BasicBlock *entry = GetEntry();
+  entry->idom = entry;
+  for (bool changed = true; changed; ) {
+    changed = false;
+    for (size_t i = 1; i < rpo.size(); i++) {
+      BasicBlock *b = rpo[i], *idom = NULL;
+      for (size_t p = 0; p < b->preds.size(); p++) {
+        BasicBlock *pred = b->preds[p];
+        if (pred->idom == NULL)
+          continue;
+        idom = (idom == NULL ? pred : Intersect(pred, idom));
+      }
+      if (b->idom != idom) {
+        b->idom = idom;
+        changed = true;
+      }
+    }
+  }
+
+  for (size_t i = 1; i < rpo.size(); i++)
+    rpo[i]->idom->children.push_back(rpo[i]);
+
+  // A join point is in the frontier of each block from its preds up to
+  // (but not including) its idom
+  for (size_t i = 0; i < rpo.size(); i++) {
+    BasicBlock *b = rpo[i];
+    if (b->preds.size() < 2)
+      continue;
+    for (size_t p = 0; p < b->preds.size(); p++) {
+      for (BasicBlock *runner = b->preds[p]; runner != b->idom;
+           runner = runner->idom) {
+        if (std::find(runner->frontier.begin(), runner->frontier.end(), b) ==
+            runner->frontier.end())
+          runner->frontier.push_back(b);
+      }
+    }
+  }
+  entry->idom = NULL;
+}
+
+BasicBlock *FlowGraph::InsertPreheader(BasicBlock *header,
+                                       const std::vector<bool> &inLoop,
+                                       const char *label) {
+  std::vector<BasicBlock*> latches;
+  for (size_t p = 0; p < header->preds.size(); p++) {
+    BasicBlock *pred = header->preds[p];
+    if (!inLoop[pred->id])
+      continue;
+    Instruction *branch = pred->GetBranch();
+    Goto *g = dynamic_cast<Goto*>(branch);
+    IfZ *ifz = dynamic_cast<IfZ*>(branch);
+    if ((g == NULL || BlockForLabel(g->GetLabel()) != header) &&
+        (ifz == NULL || BlockForLabel(ifz->GetLabel()) != header))
+      return NULL;
+    if (ifz != NULL && pred->id + 1 == header->id)
+      return NULL;                        // both ways go to header
+    latches.push_back(pred);
+  }
+
+  BasicBlock *pre = new BasicBlock(header->id);
+  blocks.insert(blocks.begin() + header->id, pre);
+  for (size_t b = pre->id + 1; b < blocks.size(); b++)
+    blocks[b]->id = b;
+  while (!header->code.empty() && dynamic_cast<Label*>(header->code[0])) {
+    Label *l = dynamic_cast<Label*>(header->code[0]);
+    pre->code.push_back(l);
+    labels[l->GetLabel()] = pre;
+    header->code.erase(header->code.begin());
+  }
+  header->code.insert(header->code.begin(), new Label(label));
+  labels[label] = header;
+
+  for (size_t i = 0; i < latches.size(); i++) {
+    Instruction *branch = latches[i]->code.back();
+    if (IfZ *ifz = dynamic_cast<IfZ*>(branch))
+      latches[i]->code.back() = new IfZ(ifz->GetTest(), label, ifz->IfNonZero());
+    else
+      latches[i]->code.back() = new Goto(label);
+    delete branch;
+  }
+  return pre;
+}
+
+void FlowGraph::AddLabel(BasicBlock *b, const char *label) {
+  b->code.insert(b->code.begin(), new Label(label));
+  labels[label] = b;
+}
+
+void FlowGraph::MoveToEnd(BasicBlock *b) {
+  BasicBlock *last = blocks.back();
+  Instruction *branch = last->GetBranch();
+  if (branch == NULL || dynamic_cast<IfZ*>(branch) != NULL)
+    NewBlock()->code.push_back(new Return(NULL));
+  blocks.erase(blocks.begin() + b->id);
+  blocks.push_back(b);
+  for (size_t i = 0; i < blocks.size(); i++)
+    blocks[i]->id = i;
+}
+
+/* Method: Linearize
+ * -----------------
+ * A Goto to the block that comes right after (e.g. one a branch on a
+ * constant was turned into) is dropped on the way, and then so are the
+ * Labels nothing branches to any more, which lets the target carry on
+ * from one block to the next as if they were one.
+ */
+void FlowGraph::Linearize(List<Instruction*> *code) {
+  std::set<std::string> targets;
+  for (size_t b = 0; b < blocks.size(); b++) {
+    size_t next = b + 1;
+    while (next < blocks.size() && blocks[next]->code.empty())
+      next++;
+    Instruction *branch = blocks[b]->GetBranch();
+    if (Goto *g = dynamic_cast<Goto*>(branch)) {
+      if (next < blocks.size() && BlockForLabel(g->GetLabel()) == blocks[next]) {
+        blocks[b]->code.pop_back();
+        delete g;
+      } else {
+        targets.insert(g->GetLabel());
+      }
+    } else if (IfZ *ifz = dynamic_cast<IfZ*>(branch)) {
+      targets.insert(ifz->GetLabel());
+    }
+  }
+
+  for (size_t i = 0; i < header.size(); i++)
+    code->Append(header[i]);
+  for (size_t b = 0; b < blocks.size(); b++) {
+    for (size_t i = 0; i < blocks[b]->code.size(); i++) {
+      Label *l = dynamic_cast<Label*>(blocks[b]->code[i]);
+      if (l != NULL && targets.count(l->GetLabel()) == 0)
+        delete l;
+      else
+        code->Append(blocks[b]->code[i]);
+    }
+  }
+  for (size_t i = 0; i < footer.size(); i++)
+    code->Append(footer[i]);
+  header.clear();
+  footer.clear();
+  for (size_t b = 0; b < blocks.size(); b++)
+    blocks[b]->code.clear();
+}
+
+BeginFunc *FlowGraph::GetBeginFunc() {
+  return dynamic_cast<BeginFunc*>(header.back());
+}
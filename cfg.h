@@ -0,0 +1,132 @@
+/* File: cfg.h
+ * -----------
+ * The FlowGraph class splits the Tac of a function into basic blocks
+ * and links them up by the control flow between them, so that the code
+ * can be analyzed and rewritten (see optimizer.h) before it is handed to
+ * a Target.
+ *
+ * A block starts at a Label (or after a branch) and ends at a Goto, IfZ
+ * or Return, or a call to _Halt, which does not return (or just before
+ * the next Label). The function's own Label
+ * and BeginFunc are kept aside as its header, and its EndFunc as its
+ * footer; the first block is always an empty entry block that nothing
+ * branches to. Blocks that fall off the end of the function go to the
+ * EndFunc, i.e. return.
+ *
+ * The graph takes over the instructions of the function, and hands them
+ * back (less any that were removed, in the order of the blocks that are
+ * left) with Linearize.
+ */
+
+#ifndef _H_cfg
+#define _H_cfg
+
+#include <map>
+#include <string>
+#include <vector>
+#include "list.h"
+#include "tac.h"
+
+class BasicBlock {
+  public:
+    int id;                               // index in the graph's blocks
+    std::vector<Instruction*> code;
+    std::vector<BasicBlock*> succs, preds;
+
+    BasicBlock *idom;                     // immediate dominator
+    std::vector<BasicBlock*> children;    // in the dominator tree
+    std::vector<BasicBlock*> frontier;    // dominance frontier
+    int rpoNumber;                        // -1 if unreachable
+
+    BasicBlock(int id);
+
+         // The last instruction, if it is a Goto, IfZ, Return or LCall
+         // _Halt, or NULL if the block falls through to the next one
+    Instruction *GetBranch();
+
+         // Returns the index of pred in preds (the order in which phi
+         // arguments are kept, see ssa.h)
+    int PredIndex(BasicBlock *pred);
+
+         // Returns whether every way from the entry to b goes through
+         // this block (the dominators must be computed)
+    bool Dominates(BasicBlock *b);
+};
+
+     // A natural loop: a back edge is one into a block that dominates
+     // where it comes from (the loop's header), and the loop is the header
+     // plus the blocks that can get to a back edge into it without going
+     // through it
+struct Loop {
+  BasicBlock *header;
+  std::vector<bool> inLoop;               // by block id
+  std::vector<BasicBlock*> blocks;        // in reverse postorder
+};
+
+class FlowGraph {
+  private:
+    std::vector<Instruction*> header, footer;
+    std::map<std::string, BasicBlock*> labels;
+
+    BasicBlock *NewBlock();
+    void AddEdge(BasicBlock *from, BasicBlock *to);
+    void ComputeOrder();
+    BasicBlock *Intersect(BasicBlock *a, BasicBlock *b);
+
+  public:
+    std::vector<BasicBlock*> blocks;      // in the order of the code
+    std::vector<BasicBlock*> rpo;         // reachable blocks, reverse postorder
+
+         // Takes the instructions of the function out of code, which must
+         // hold exactly one function, from its Label through its EndFunc
+    FlowGraph(List<Instruction*> *code);
+    ~FlowGraph();
+
+    BasicBlock *GetEntry()      { return blocks[0]; }
+
+         // Returns the block that starts with label, or NULL
+    BasicBlock *BlockForLabel(const char *label);
+
+         // Fills in the idom, children and frontier of each reachable
+         // block (Cooper, Harvey and Kennedy's iterative algorithm)
+    void ComputeDominators();
+
+         // Returns the natural loops, one for each header, from the
+         // innermost out (the dominators must be computed)
+    std::vector<Loop> FindLoops();
+
+         // Recomputes the edges from the code, e.g. after branches were
+         // rewritten, and deletes the code of blocks that can no longer
+         // be reached (they are left empty). Dominators must be computed
+         // again after this.
+    void Rebuild();
+
+         // Inserts an empty block ahead of header (a loop's preheader,
+         // see opt_licm.cc) that takes over the edges into header from
+         // outside the loop (the blocks not marked in inLoop, by id):
+         // header's labels move to it, and the branches from inside the
+         // loop go to header by a new label, label, instead. Returns NULL,
+         // changing nothing, if a block in the loop falls through to
+         // header. Rebuild must be called after this.
+    BasicBlock *InsertPreheader(BasicBlock *header,
+                                const std::vector<bool> &inLoop,
+                                const char *label);
+
+         // Puts a Label at the start of b, so that it can be branched to
+    void AddLabel(BasicBlock *b, const char *label);
+
+         // Moves b to the end of the function (see opt_layout.cc). If the
+         // block that was last could fall off the end, a block with a
+         // Return is put in between. Rebuild must be called after this.
+    void MoveToEnd(BasicBlock *b);
+
+         // Puts the code back into code, block by block, less the Gotos
+         // that would only go on to the next block and the Labels that
+         // nothing branches to
+    void Linearize(List<Instruction*> *code);
+
+         // Returns the BeginFunc of the function
+    BeginFunc *GetBeginFunc();
+};
+
+#endif
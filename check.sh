@@ -26,11 +26,14 @@ for file in $LIST; do
 		continue
 	fi
 
+	flags=
+	[ -r $base.flags ] && flags=`cat $base.flags`
+
 	tmp=${TMP:-"/tmp"}/check.tmp
 	if [ -r $base.in ]; then
-		sh run $base.$ext 1>$tmp 2>&1 < $base.in
+		DCCFLAGS="$flags" sh run $base.$ext 1>$tmp 2>&1 < $base.in
 	else
-		sh run $base.$ext 1>$tmp 2>&1
+		DCCFLAGS="$flags" sh run $base.$ext 1>$tmp 2>&1
 	fi
 
 	printf "Checking %-27s: " $file
@@ -9,34 +9,66 @@
 #include <string.h>
 #include "tac.h"
 #include "mips.h"
+#include "x86.h"
+#include "csource.h"
 #include "errors.h"
+#include "context.h"
+#include "cache.h"
+#include "stats.h"
+#include "interp.h"
+#include "optimizer.h"
+#include <string>
 
-CodeGenerator::CodeGenerator()
+CodeGenerator::CodeGenerator(FILE *o, const char *prefix)
 {
   code = new List<Instruction*>();
+  frameLocs = new List<Location*>();
+  breakLabels = new List<const char*>();
+  target = NULL;
+  buffer = NULL;
+  bufferSize = 0;
+  isBuffered = (o == NULL);
+  out = (isBuffered ? open_memstream(&buffer, &bufferSize) : o);
+  labelPrefix = strdup(prefix != NULL ? prefix : "");
   localOffset = OffsetToFirstLocal;
+  nextLabelNum = nextTempNum = 0;
+  nextStringNum = 1;
   mainDefined = false;
 }
 
+CodeGenerator::~CodeGenerator()
+{
+  delete code;
+  delete frameLocs;
+  delete breakLabels;
+  delete target;
+  if (isBuffered) {
+    fclose(out);
+    free(buffer);
+  }
+  free(labelPrefix);
+}
+
 char *CodeGenerator::NewLabel()
 {
-  static int nextLabelNum = 0;
-  char temp[10];
-  sprintf(temp, "_L%d", nextLabelNum++);
-  return strdup(temp);
+  char *label = (char *)malloc(strlen(labelPrefix) + 16);
+  sprintf(label, "%s_L%d", labelPrefix, nextLabelNum++);
+  Stats::Count(Stats::Labels);
+  return label;
 }
 
 Location *CodeGenerator::GenTempVar()
 {
-  static int nextTempNum;
   char temp[10];
   Location *result = NULL;
   sprintf(temp, "_tmp%d", nextTempNum++);
+  Stats::Count(Stats::Temps);
   /* pp4: need to create variable in proper location
      in stack frame for use as temporary. Until you
      do that, the assert below will always fail to remind
      you this needs to be implemented  */
   result = new Location(fpRelative, localOffset, temp);
+  frameLocs->Append(result);
   localOffset -= VarSize;
 
   Assert(result != NULL);
@@ -46,21 +78,33 @@ Location *CodeGenerator::GenTempVar()
 Location *CodeGenerator::GenLocalVar(const char *name, int size)
 {
     Location *result = new Location(fpRelative, localOffset, name);
+    frameLocs->Append(result);
     localOffset -= size;
     return result;
 }
 
+Location *CodeGenerator::GenParamVar(const char *name, int offset)
+{
+    Location *result = new Location(fpRelative, offset, name);
+    frameLocs->Append(result);
+    return result;
+}
+
 Location *CodeGenerator::GenLoadConstant(int value)
 {
   Location *result = GenTempVar();
   code->Append(new LoadConstant(result, value));
+  constants[result] = value;
   return result;
 }
 
 Location *CodeGenerator::GenLoadConstant(const char *s)
 {
   Location *result = GenTempVar();
-  code->Append(new LoadStringConstant(result, s));
+  char *label = (char *)malloc(strlen(labelPrefix) + 16);
+  sprintf(label, "%s_string%d", labelPrefix, nextStringNum++);
+  code->Append(new LoadStringConstant(result, s, label));
+  free(label);
   return result;
 }
 
@@ -73,6 +117,7 @@ Location *CodeGenerator::GenLoadLabel(const char *label)
 
 void CodeGenerator::GenAssign(Location *dst, Location *src)
 {
+  constants.erase(dst);
   code->Append(new Assign(dst, src));
 }
 
@@ -91,8 +136,83 @@ void CodeGenerator::GenStore(Location *dst,Location *src, int offset)
 Location *CodeGenerator::GenBinaryOp(const char *opName, Location *op1,
 						     Location *op2)
 {
+  BinaryOp::OpCode opCode = BinaryOp::OpCodeForName(opName);
+  if (CompilationContext::Current()->GetOptimize()) {
+    Location *folded = FoldBinaryOp(opCode, op1, op2);
+    if (folded != NULL) {
+      Stats::Count(Stats::ExpressionsFolded);
+      return folded;
+    }
+  }
+  Location *result = GenTempVar();
+  code->Append(new BinaryOp(opCode, result, op1, op2));
+  return result;
+}
+
+/* Method: FoldBinaryOp
+ * --------------------
+ * Returns where the result of op1 opCode op2 can be had without a BinaryOp,
+ * or NULL if it can't. The operands are already computed, so dropping
+ * one (as in x * 0) loses nothing but the op; what would trap at run
+ * time (see BinaryOp::Fold) is left alone. Bools are 0 or 1.
+ */
+Location *CodeGenerator::FoldBinaryOp(BinaryOp::OpCode opCode, Location *op1,
+				      Location *op2)
+{
+  int a, b, result;
+  bool isConst1 = (constants.count(op1) != 0);
+  bool isConst2 = (constants.count(op2) != 0);
+  if (isConst1)
+    a = constants[op1];
+  if (isConst2)
+    b = constants[op2];
+  if (isConst1 && isConst2)
+    return BinaryOp::Fold(opCode, a, b, &result) ? GenLoadConstant(result) : NULL;
+
+  switch (opCode) {
+    case BinaryOp::Add:
+      if (isConst1 && a == 0) return Same(op2);
+      // fall through
+    case BinaryOp::Sub:
+      if (isConst2 && b == 0) return Same(op1);
+      return NULL;
+    case BinaryOp::Mul:
+    case BinaryOp::And:
+      if (isConst1 && (a == 0 || a == 1))
+	return a == 0 ? op1 : Same(op2);
+      if (isConst2 && (b == 0 || b == 1))
+	return b == 0 ? op2 : Same(op1);
+      return NULL;
+    case BinaryOp::Or:
+      if (isConst1 && (a == 0 || a == 1))
+	return a == 1 ? op1 : Same(op2);
+      if (isConst2 && (b == 0 || b == 1))
+	return b == 1 ? op2 : Same(op1);
+      return NULL;
+    case BinaryOp::Div:
+      if (isConst2 && b == 1) return Same(op1);
+      return NULL;
+    case BinaryOp::Mod:
+      if (isConst2 && b == 1) return GenLoadConstant(0);
+      return NULL;
+    default:
+      return NULL;
+  }
+}
+
+/* Method: Same
+ * ------------
+ * Returns a Location holding the value loc has now. A temp is never
+ * assigned again once its expression is done, so it can stand for itself,
+ * but a variable is copied, as it may be assigned before the value is
+ * used (as in f(x * 1, x = 2)).
+ */
+Location *CodeGenerator::Same(Location *loc)
+{
+  if (strncmp(loc->GetName(), "_tmp", 4) == 0)
+    return loc;
   Location *result = GenTempVar();
-  code->Append(new BinaryOp(BinaryOp::OpCodeForName(opName), result, op1, op2));
+  code->Append(new Assign(result, loc));
   return result;
 }
 
@@ -100,15 +220,79 @@ void CodeGenerator::GenLabel(const char *label)
 {
   if (strcmp(label, "main") == 0)
     mainDefined = true;
+  constants.clear();                // it may be reached from elsewhere
 
   code->Append(new Label(label));
 }
 
+void CodeGenerator::PushBreakLabel(const char *label)
+{
+  breakLabels->Append(label);
+}
+
+void CodeGenerator::PopBreakLabel()
+{
+  Assert(breakLabels->NumElements() > 0);
+  breakLabels->RemoveAt(breakLabels->NumElements() - 1);
+}
+
+const char *CodeGenerator::GetBreakLabel()
+{
+  Assert(breakLabels->NumElements() > 0);
+  return breakLabels->Nth(breakLabels->NumElements() - 1);
+}
+
+void CodeGenerator::PushInBounds(Location *array, Location *subscript)
+{
+  inBounds.push_back(std::make_pair(array, subscript));
+}
+
+void CodeGenerator::PopInBounds()
+{
+  Assert(!inBounds.empty());
+  inBounds.pop_back();
+}
+
+bool CodeGenerator::IsInBounds(Location *array, Location *subscript)
+{
+  for (size_t i = 0; i < inBounds.size(); i++)
+    if (inBounds[i].first == array && inBounds[i].second == subscript)
+      return true;
+  return false;
+}
+
+int CodeGenerator::GetNumInstructions()
+{
+  return code->NumElements();
+}
+
+bool CodeGenerator::IsAssignedSince(int first, Location *var)
+{
+  for (int i = first; i < code->NumElements(); i++)
+    if (code->Nth(i)->GetDst() == var)
+      return true;
+  return false;
+}
+
+void CodeGenerator::DiscardSince(int first)
+{
+  while (code->NumElements() > first) {
+    delete code->Nth(code->NumElements() - 1);
+    code->RemoveAt(code->NumElements() - 1);
+  }
+  constants.clear();
+}
+
 void CodeGenerator::GenIfZ(Location *test, const char *label)
 {
   code->Append(new IfZ(test, label));
 }
 
+void CodeGenerator::GenIfNZ(Location *test, const char *label)
+{
+  code->Append(new IfZ(test, label, true));
+}
+
 void CodeGenerator::GenGoto(const char *label)
 {
   code->Append(new Goto(label));
@@ -195,18 +379,120 @@ void CodeGenerator::GenVTable(const char *className, List<const char *> *methodL
   code->Append(new VTable(className, methodLabels));
 }
 
-void CodeGenerator::DoFinalCodeGen()
+// Makes the Target for the architecture being compiled for
+static Target *NewTarget(FILE *out)
 {
-  if (!mainDefined)
-    ReportError::NoMainFound();
+  switch (CompilationContext::Current()->GetArch()) {
+    case X86Arch: return new X86(out);
+    case CArch: return new CSource(out);
+    default: {
+      bool optimize = CompilationContext::Current()->GetOptimize();
+      return new Mips(out, optimize, optimize);
+    }
+  }
+}
+
+void CodeGenerator::EmitPreamble()
+{
+  if (!IsDebugOn("tac") && CompilationContext::Current()->GetInterpreter() == NULL) {
+    if (target == NULL)
+      target = NewTarget(out);
+    target->EmitPreamble();
+  }
+}
+
+void CodeGenerator::Append(CodeGenerator *other)
+{
+  Assert(other->isBuffered);
+  fflush(other->out);
+  fwrite(other->buffer, 1, other->bufferSize, out);
+  if (other->mainDefined)
+    mainDefined = true;
+}
+
+void CodeGenerator::FlushCode()
+{
+  if (CompilationContext::Current()->GetOptimize() && Optimizer::IsFunction(code))
+    Optimizer(this, code).Run();
+
+  Stats *stats = CompilationContext::CurrentStats();
+  for (int i = 0; stats != NULL && i < code->NumElements(); i++)
+    stats->CountTac(code->Nth(i)->GetOpName());
+
+  // The code goes to the interpreter instead of out, if there is one
+  // (with -d tac, the Tac is still printed to out as well)
+  Interpreter *interp = CompilationContext::Current()->GetInterpreter();
+  if (interp != NULL) {
+    for (int i = 0; i < code->NumElements(); i++)
+      code->Nth(i)->Emit(interp);
+  }
 
   if (IsDebugOn("tac")) { // if debug don't translate to mips, just print Tac
     for (int i = 0; i < code->NumElements(); i++)
-	code->Nth(i)->Print();
-   }  else {
-     Mips mips;
-     mips.EmitPreamble();
-     for (int i = 0; i < code->NumElements(); i++)
-	 code->Nth(i)->Emit(&mips);
+	code->Nth(i)->Print(out);
+   }  else if (interp == NULL) {
+     CompileCache *cache = CompilationContext::Current()->GetCache();
+     if (cache != NULL) {
+       EmitCached(cache);
+     } else {
+       if (target == NULL)
+         target = NewTarget(out);
+       for (int i = 0; i < code->NumElements(); i++)
+	 code->Nth(i)->Emit(target);
+     }
+  }
+
+  for (int i = 0; i < code->NumElements(); i++)
+    delete code->Nth(i);
+  for (int i = 0; i < frameLocs->NumElements(); i++)
+    delete frameLocs->Nth(i);
+  delete code;
+  delete frameLocs;
+  constants.clear();
+  code = new List<Instruction*>();
+  frameLocs = new List<Location*>();
+}
+
+/* Method: EmitCached
+ * ------------------
+ * Writes out the mips translation of the code, taking it from the cache
+ * if the same Tac was translated before, else translating it and adding
+ * it to the cache. Each translation starts from a fresh Target, so that
+ * the result only depends on the Tac (and where its operands live, which
+ * PrintKey includes).
+ */
+void CodeGenerator::EmitCached(CompileCache *cache)
+{
+  char *text = NULL;
+  size_t size = 0;
+  FILE *f = open_memstream(&text, &size);
+  for (int i = 0; i < code->NumElements(); i++)
+    code->Nth(i)->PrintKey(f);
+  fclose(f);
+  std::string key = cache->KeyFor("tac", text, size);
+  free(text);
+
+  std::string mipsText;
+  if (cache->Lookup(key, &mipsText)) {
+    PrintDebug("cache", "Reusing code for %s", *labelPrefix ? labelPrefix : "vtable");
+  } else {
+    f = open_memstream(&text, &size);
+    Target *t = NewTarget(f);
+    for (int i = 0; i < code->NumElements(); i++)
+      code->Nth(i)->Emit(t);
+    delete t;
+    fclose(f);
+    mipsText.assign(text, size);
+    free(text);
+    cache->Store(key, mipsText);
   }
+  fwrite(mipsText.data(), 1, mipsText.size(), out);
+}
+
+void CodeGenerator::DoFinalCodeGen()
+{
+  FlushCode();
+
+  if (!mainDefined)
+    ReportError::NoMainFound();
 }
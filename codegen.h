@@ -15,8 +15,14 @@
 #define _H_codegen
 
 #include <stdlib.h>
+#include <stdio.h>
 #include "list.h"
 #include "tac.h"
+#include <map>
+#include <utility>
+#include <vector>
+class Target;
+class CompileCache;
 
               // These codes are used to identify the built-in functions
 typedef enum { Alloc, ReadLine, ReadInteger, StringEqual,
@@ -25,9 +31,25 @@ typedef enum { Alloc, ReadLine, ReadInteger, StringEqual,
 class CodeGenerator {
   private:
     List<Instruction*> *code;
+    List<Location*> *frameLocs;
+    List<const char*> *breakLabels;
+    Target *target;           // writes out the code, made on first use
+    FILE *out;
+    char *buffer;             // holds the code written to out, if
+    size_t bufferSize;        // no output was given
+    bool isBuffered;
+    char *labelPrefix;
 
     int localOffset;
+    int nextLabelNum, nextTempNum, nextStringNum;
     bool mainDefined;
+    std::map<Location*, int> constants;  // temps loaded with a constant,
+                                         // since the last label
+    std::vector<std::pair<Location*, Location*> > inBounds;
+
+    void EmitCached(CompileCache *cache);
+    Location *FoldBinaryOp(BinaryOp::OpCode opCode, Location *op1, Location *op2);
+    Location *Same(Location *loc);
 
   public:
            // Here are some class constants to remind you of the offsets
@@ -47,7 +69,13 @@ class CodeGenerator {
                      OffsetToFirstGlobal = 0;
     static const int VarSize = 4;
 
-    CodeGenerator();
+         // The generated code is written to out or, if out is NULL, kept
+         // in memory until it is added to another generator's output with
+         // Append. All the labels made by NewLabel (and the labels of
+         // string constants) start with labelPrefix, if given, so that
+         // separate generators never pick the same label.
+    CodeGenerator(FILE *out, const char *labelPrefix = NULL);
+    ~CodeGenerator();
 
          // Assigns a new unique label name and returns it. Does not
          // generate any Tac instructions (see GenLabel below if needed)
@@ -57,6 +85,7 @@ class CodeGenerator {
          // temp variable. Does not generate any Tac instructions
     Location *GenTempVar();
     Location *GenLocalVar(const char *name, int size);
+    Location *GenParamVar(const char *name, int offset);
 
          // Generates Tac instructions to load a constant value. Creates
          // a new temp var to hold the result. The constant
@@ -93,7 +122,10 @@ class CodeGenerator {
          // Generates Tac instructions to perform one of the binary ops
          // identified by string name, such as "+" or "==".  Returns a
          // Location object for the new temporary where the result
-         // was stored.
+         // was stored. When optimizing, an op on two constants is
+         // replaced by a load of its result, and an op whose result is
+         // one of its operands (x + 0, x * 1, x * 0, b && true, b || true)
+         // by that operand, with no Tac at all.
     Location *GenBinaryOp(const char *opName, Location *op1, Location *op2);
 
          // Generates the Tac instruction for pushing a single
@@ -139,10 +171,34 @@ class CodeGenerator {
          // (or omit arg) to GenReturn for a return that does not
          // return a value
     void GenIfZ(Location *test, const char *label);
+    void GenIfNZ(Location *test, const char *label);
     void GenGoto(const char *label);
     void GenReturn(Location *val = NULL);
     void GenLabel(const char *label);
 
+         // These methods maintain the stack of labels that a break
+         // statement jumps to, i.e. the label just past the end of
+         // each enclosing loop, innermost on top.
+    void PushBreakLabel(const char *label);
+    void PopBreakLabel();
+    const char *GetBreakLabel();
+
+         // These methods maintain the stack of array accesses (the array
+         // and subscript variables) known to be in bounds, for which
+         // ArrayAccess leaves out the subscript check: e.g. a[i] in a loop
+         // that keeps i below a.length() (see ForStmt::Emit).
+    void PushInBounds(Location *array, Location *subscript);
+    void PopInBounds();
+    bool IsInBounds(Location *array, Location *subscript);
+
+         // Returns the number of Tac instructions generated so far for
+         // the function, and whether any of them from the first-th on
+         // assigns var. DiscardSince deletes those instructions, so that
+         // code can be generated to see what it does, then thrown away.
+    int GetNumInstructions();
+    bool IsAssignedSince(int first, Location *var);
+    void DiscardSince(int first);
+
          // These methods generate the Tac instructions that mark the start
          // and end of a function/method definition.
     BeginFunc *GenBeginFunc();
@@ -155,12 +211,29 @@ class CodeGenerator {
          // need access to the vtable, you use LoadLabel of class name.
     void GenVTable(const char *className, List<const char*> *methodLabels);
 
-         // Emits the final "object code" for the program by
-         // translating the sequence of Tac instructions into their mips
-         // equivalent and printing them out to stdout. If the debug
-         // flag tac is on (-d tac), it will not translate to MIPS,
-         // but instead just print the untranslated Tac. It may be
-         // useful in debugging to first make sure your Tac is correct.
+         // Translates the Tac instructions generated since the last flush
+         // (after optimizing them, see optimizer.h, unless that is turned
+         // off) into assembly for the target and prints them out, then frees
+         // those instructions along with the temps, locals and params
+         // they referenced. Called after each function so that memory use
+         // is bounded by the largest function rather than the whole
+         // program. If the debug flag tac is on (-d tac), it will not
+         // translate to MIPS, but instead just print the untranslated Tac.
+         // If the compilation has a cache, the translation is looked up
+         // there first, keyed by the Tac (see Instruction::PrintKey).
+    void FlushCode();
+
+         // Writes out the directives that must come first in the
+         // assembly (nothing, if printing Tac with -d tac).
+    void EmitPreamble();
+
+         // Writes out all of the code flushed by other, which must have
+         // been created without an output of its own.
+    void Append(CodeGenerator *other);
+
+         // Emits the final "object code" for the program by flushing
+         // whatever Tac instructions remain (vtables, etc.) and verifying
+         // that a main function was generated along the way.
     void DoFinalCodeGen();
 };
 
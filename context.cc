@@ -0,0 +1,105 @@
+/* File: context.cc
+ * ----------------
+ * Implementation of the CompilationContext class.
+ */
+
+#include "context.h"
+#include "utility.h"
+#include "scanner.h"
+#include "parser.h"
+#include "ast_stmt.h"
+#include "cache.h"
+#include "stats.h"
+#include <stdlib.h>
+#include <string>
+
+static thread_local CompilationContext *current = NULL;
+
+CompilationContext::CompilationContext(const char *s, FILE *i, FILE *o)
+  : srcName(s), in(i), out(o), scanner(NULL), globalScope(new Scope),
+    pool(NULL), cache(NULL), stats(NULL), interp(NULL), arch(MipsArch),
+    optimize(true), numErrors(0) {
+    // Empty
+}
+
+CompilationContext::~CompilationContext() {
+    if (scanner != NULL)
+        FreeScanner(scanner);
+    delete globalScope;
+    delete stats;
+}
+
+int CompilationContext::Compile() {
+    CompilationContext *prev = SetCurrent(this);
+    if (IsDebugOn("timing"))
+        stats = new Stats;
+    TraceSpan span(srcName ? srcName : "stdin", "file");
+
+    if (cache == NULL) {
+        Parse();
+    } else {
+        // The whole input is needed up front to look it up, and the whole
+        // output to store it, so both are read/written through memory
+        std::string input;
+        char buf[8192];
+        size_t n;
+        while ((n = fread(buf, 1, sizeof(buf), in)) > 0)
+            input.append(buf, n);
+
+        std::string key = cache->KeyFor("file", input.data(), input.size());
+        std::string code;
+        if (cache->Lookup(key, &code)) {
+            PrintDebug("cache", "Reusing code for %s", srcName ? srcName : "stdin");
+        } else {
+            FILE *realIn = in, *realOut = out;
+            char *text = NULL;
+            size_t size = 0;
+            in = fmemopen((void *)input.data(), input.size(), "r");
+            out = open_memstream(&text, &size);
+            Parse();
+            fclose(in);
+            fclose(out);
+            in = realIn;
+            out = realOut;
+
+            code.assign(text, size);
+            free(text);
+            if (numErrors == 0)
+                cache->Store(key, code);
+        }
+        fwrite(code.data(), 1, code.size(), out);
+    }
+    fflush(out);
+
+    if (stats != NULL)
+        stats->Report(stderr, srcName);
+    SetCurrent(prev);
+    return numErrors;
+}
+
+void CompilationContext::Parse() {
+    scanner = InitScanner(in);
+    PhaseTimer t(Stats::Parse);
+    yyparse(scanner);
+}
+
+CompilationContext *CompilationContext::Current() {
+    Assert(current != NULL);
+    return current;
+}
+
+CompilationContext *CompilationContext::SetCurrent(CompilationContext *c) {
+    CompilationContext *prev = current;
+    current = c;
+    return prev;
+}
+
+Stats *CompilationContext::CurrentStats() {
+    return (current != NULL ? current->stats : NULL);
+}
+
+const char *CompilationContext::GetLineNumbered(int n) {
+    if (scanner == NULL)
+        return NULL;
+    return ::GetLineNumbered(scanner, n);
+}
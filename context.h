@@ -0,0 +1,107 @@
+/* File: context.h
+ * ---------------
+ * The CompilationContext class gathers up all of the state needed to
+ * compile a single Decaf source file: the input and output streams, the
+ * global scope, the scanner and the count of errors reported so far.
+ * Nothing about a compilation is kept in process globals, so a single
+ * dcc process can compile any number of files, one after another or
+ * concurrently on different threads (see main.cc for the batch mode).
+ *
+ * Code deep in the tree (the ast nodes, the error reporter, etc.) finds
+ * the context it is working for through Current(), which returns the
+ * context being compiled by the calling thread.
+ *
+ * If the context is given a thread pool, parts of the compilation (the
+ * translation of each function, see Program::Emit) are farmed out to it.
+ * If it is given a cache, the results of compiling the same source (or
+ * translating the same function) before are reused, see cache.h. If it
+ * is given an interpreter, the code is handed to that to be run instead
+ * of being written out as assembly, see interp.h.
+ */
+
+#ifndef _H_context
+#define _H_context
+
+#include <stdio.h>
+#include "target.h"
+
+class Scope;
+class ThreadPool;
+class CompileCache;
+class Stats;
+class Interpreter;
+
+class CompilationContext
+{
+  private:
+    const char *srcName;
+    FILE *in, *out;
+    void *scanner;
+    Scope *globalScope;
+    ThreadPool *pool;
+    CompileCache *cache;
+    Stats *stats;
+    Interpreter *interp;
+    Arch arch;
+    bool optimize;
+    int numErrors;
+
+    void Parse();
+
+  public:
+         // The srcName is only used in error messages, it can be NULL
+         // if the input does not come from a named file (i.e. stdin).
+    CompilationContext(const char *srcName, FILE *in, FILE *out);
+    ~CompilationContext();
+
+         // Scans, parses, and generates code for the input, writing the
+         // assembly to the output. Returns the number of errors reported.
+    int Compile();
+
+         // Returns the context being compiled by the calling thread. If
+         // work for a context is handed off to another thread, that
+         // thread must SetCurrent() the context before using it (and
+         // should put back the previous one, which is returned, after).
+    static CompilationContext *Current();
+    static CompilationContext *SetCurrent(CompilationContext *c);
+
+         // Returns the stats kept by the calling thread's compilation, or
+         // NULL if there is none or it is not keeping stats (see stats.h)
+    static Stats *CurrentStats();
+
+    const char *GetSourceName()     { return srcName; }
+    FILE *GetOutput()               { return out; }
+    Scope *GetGlobalScope()         { return globalScope; }
+
+         // The pool is NULL if everything is to be done on the calling
+         // thread, which is the default
+    ThreadPool *GetThreadPool()     { return pool; }
+    void SetThreadPool(ThreadPool *p) { pool = p; }
+
+         // The cache is NULL (the default) if nothing is to be reused
+    CompileCache *GetCache()        { return cache; }
+    void SetCache(CompileCache *c)  { cache = c; }
+
+         // The architecture is MipsArch unless set otherwise
+    Arch GetArch()                  { return arch; }
+    void SetArch(Arch a)            { arch = a; }
+
+         // Whether the Tac is optimized before it is written out or run
+         // (see optimizer.h), which is the default
+    bool GetOptimize()              { return optimize; }
+    void SetOptimize(bool o)        { optimize = o; }
+
+         // The interpreter is NULL (the default) if the code is to be
+         // written to the output
+    Interpreter *GetInterpreter()   { return interp; }
+    void SetInterpreter(Interpreter *i) { interp = i; }
+
+         // Returns the contents of line n of the input, or NULL if the
+         // contents of that line are not available.
+    const char *GetLineNumbered(int n);
+
+    void CountError()               { numErrors++; }
+    int NumErrors()                 { return numErrors; }
+};
+
+#endif
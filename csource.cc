@@ -0,0 +1,355 @@
+/* File: csource.cc
+ * ----------------
+ * Implementation of the CSource class, which translates Tac into C, see
+ * csource.h. The code for a function is kept until its EndFunc, since
+ * only then is it known which params and locals it uses and what has to
+ * be declared ahead of it.
+ */
+
+#include "csource.h"
+#include <limits.h>
+#include <stdarg.h>
+#include <string.h>
+#include "utility.h"
+
+// The runtime routines, which are C functions in runtime.c
+static const char * const builtinLabels[] =
+  {"_Alloc", "_ReadLine", "_ReadInteger", "_StringEqual",
+   "_PrintInt", "_PrintString", "_PrintBool", "_Halt", NULL};
+
+// The C operators for each BinaryOp::OpCode, in the order of the enum.
+// Add, Sub and Mul are done unsigned, so that they wrap as on MIPS.
+static const char * const cOperator[BinaryOp::NumOps] =
+  {"+", "-", "*", "/", "%", "==", "<", "&", "|"};
+
+CSource::CSource(FILE *o) {
+  out = o;
+  inFunction = false;
+  maxParamOffset = 0;
+  callLine = -1;
+}
+
+/* Method: Emit
+ * ------------
+ * Adds a line to the body of the function being emitted. Takes
+ * printf-style formatting strings and variable arguments.
+ */
+void CSource::Emit(const char *fmt, ...)
+{
+  va_list args;
+  char buf[1024];
+
+  va_start(args, fmt);
+  vsnprintf(buf, sizeof(buf), fmt, args);
+  va_end(args);
+  if (buf[strlen(buf) - 1] != ':') // don't indent labels
+    body.push_back(std::string("  ") + buf);
+  else
+    body.push_back(buf);
+}
+
+// Adds a declaration the function needs ahead of it
+void CSource::Declare(const char *fmt, const std::string &name)
+{
+  char buf[1024];
+  snprintf(buf, sizeof(buf), fmt, name.c_str());
+  declarations.insert(buf);
+}
+
+/* Method: Operand
+ * ---------------
+ * Returns the C variable that holds var, a local or param of the
+ * function (named for its offset from fp), or a global, which is
+ * declared.
+ */
+std::string CSource::Operand(Location *var)
+{
+  char buf[32];
+  int offset = var->GetOffset();
+  if (var->GetSegment() == gpRelative) {
+    sprintf(buf, "g%d", offset);
+    Declare("static int %s;", buf);
+  } else if (offset > 0) {
+    sprintf(buf, "p%d", offset);
+    if (offset > maxParamOffset)
+      maxParamOffset = offset;
+  } else {
+    sprintf(buf, "l%d", -offset);
+    locals.insert(-offset);
+  }
+  return buf;
+}
+
+/* Method: BeginCall
+ * -----------------
+ * Leaves a placeholder in the body for a call to fn (the name of a
+ * function or, if indirect, a variable holding its address), which is
+ * filled in by FinishCall once the number of params it takes is known.
+ */
+void CSource::BeginCall(Location *result, const std::string &fn, bool indirect)
+{
+  FinishCall(0); // the last call had no PopParams, so it took none
+  callResult = (result != NULL ? Operand(result) + " = " : "");
+  callee = fn;
+  callIndirect = indirect;
+  callLine = body.size();
+  body.push_back("");
+}
+
+// Fills in the pending call, passing it the last numArgs params pushed
+// (the first of them is pushed last)
+void CSource::FinishCall(int numArgs)
+{
+  if (callLine < 0)
+    return;
+  Assert(numArgs <= (int)params.size());
+  std::string args, type;
+  for (int i = 0; i < numArgs; i++) {
+    args += (i > 0 ? ", " : "") + params[params.size() - 1 - i];
+    type += (i > 0 ? ", int" : "int");
+  }
+  params.resize(params.size() - numArgs);
+
+  std::string fn = callee;
+  if (callIndirect)
+    fn = "((int (*)(" + (numArgs > 0 ? type : "void") +
+      "))(unsigned long)(unsigned)" + callee + ")";
+  else if (numArgs > 0 && !IsBuiltIn(callee.c_str()))
+    fn = "((int (*)(" + type + "))" + callee + ")";
+  body[callLine] = "  " + callResult + fn + "(" + args + ");";
+  callLine = -1;
+}
+
+std::string CSource::Symbol(const char *label)
+{
+  std::string name = "d_";
+  for (const char *s = label; *s != '\0'; s++)
+    name += (*s == '.' ? std::string("_0") : std::string(1, *s));
+  return name;
+}
+
+bool CSource::IsBuiltIn(const char *label)
+{
+  for (int i = 0; builtinLabels[i] != NULL; i++)
+    if (strcmp(label, builtinLabels[i]) == 0)
+      return true;
+  return false;
+}
+
+
+// The Tac goes in as comments, which mustn't end early
+void CSource::EmitComment(const char *text)
+{
+  std::string s(text);
+  for (size_t i; (i = s.find("*/")) != std::string::npos; )
+    s.insert(i + 1, " ");
+  Emit("/* %s */", s.c_str());
+}
+
+void CSource::EmitLoadConstant(Location *dst, int val)
+{
+  if (val == INT_MIN)
+    Emit("%s = -2147483647 - 1;", Operand(dst).c_str());
+  else
+    Emit("%s = %d;", Operand(dst).c_str(), val);
+}
+
+void CSource::EmitLoadStringConstant(Location *dst, const char *label, const char *str)
+{
+  std::string name = Symbol(label);
+  declarations.insert("static char " + name + "[] = " + str + ";");
+  Emit("%s = (int)(unsigned long)%s;", Operand(dst).c_str(), name.c_str());
+}
+
+// The labels loaded are those of vtables
+void CSource::EmitLoadLabel(Location *dst, const char *label)
+{
+  std::string name = Symbol(label);
+  Declare("extern int %s[];", name);
+  Emit("%s = (int)(unsigned long)%s;", Operand(dst).c_str(), name.c_str());
+}
+
+void CSource::EmitLoad(Location *dst, Location *reference, int offset)
+{
+  Emit("%s = MEM(%s, %d);", Operand(dst).c_str(), Operand(reference).c_str(),
+       offset);
+}
+
+void CSource::EmitStore(Location *reference, Location *value, int offset)
+{
+  Emit("MEM(%s, %d) = %s;", Operand(reference).c_str(), offset,
+       Operand(value).c_str());
+}
+
+void CSource::EmitCopy(Location *dst, Location *src)
+{
+  Emit("%s = %s;", Operand(dst).c_str(), Operand(src).c_str());
+}
+
+void CSource::EmitBinaryOp(BinaryOp::OpCode code, Location *dst,
+                           Location *op1, Location *op2)
+{
+  std::string d = Operand(dst), a = Operand(op1), b = Operand(op2);
+  if (code == BinaryOp::Add || code == BinaryOp::Sub || code == BinaryOp::Mul)
+    Emit("%s = (int)((unsigned)%s %s (unsigned)%s);", d.c_str(), a.c_str(),
+         cOperator[code], b.c_str());
+  else if (code == BinaryOp::Div || code == BinaryOp::Mod)
+    Emit("%s = %s(%s, %s);", d.c_str(), code == BinaryOp::Div ? "DIV" : "MOD",
+         a.c_str(), b.c_str());
+  else
+    Emit("%s = %s %s %s;", d.c_str(), a.c_str(), cOperator[code], b.c_str());
+}
+
+
+// The label ahead of a BeginFunc names the function, the rest are
+// labels within it
+void CSource::EmitLabel(const char *label)
+{
+  if (!inFunction)
+    functionName = Symbol(label);
+  else
+    Emit("%s: ;", Symbol(label).c_str());
+}
+
+void CSource::EmitGoto(const char *label)
+{
+  Emit("goto %s;", Symbol(label).c_str());
+}
+
+void CSource::EmitIfZ(Location *test, const char *label)
+{
+  Emit("if (%s == 0) goto %s;", Operand(test).c_str(), Symbol(label).c_str());
+}
+
+void CSource::EmitIfNZ(Location *test, const char *label)
+{
+  Emit("if (%s != 0) goto %s;", Operand(test).c_str(), Symbol(label).c_str());
+}
+
+void CSource::EmitReturn(Location *returnVal)
+{
+  if (returnVal != NULL)
+    Emit("return %s;", Operand(returnVal).c_str());
+  else
+    Emit("return 0;");
+}
+
+void CSource::EmitBeginFunction(int frameSize)
+{
+  Assert(!functionName.empty());
+  inFunction = true;
+  maxParamOffset = 0;
+}
+
+/* Method: EmitEndFunction
+ * -----------------------
+ * Writes out the function: what it needs declared, then its header,
+ * with a param for each word up to the last one it uses, then the
+ * locals and temps it uses, then its body.
+ */
+void CSource::EmitEndFunction()
+{
+  FinishCall(0);
+  Assert(params.empty());
+  Emit("return 0;");
+  std::set<std::string>::iterator i;
+  for (i = declarations.begin(); i != declarations.end(); ++i)
+    fprintf(out, "%s\n", i->c_str());
+
+  fprintf(out, "\nstatic int %s(", functionName.c_str());
+  for (int offset = 4; offset <= maxParamOffset; offset += 4)
+    fprintf(out, "%sint p%d", offset > 4 ? ", " : "", offset);
+  fprintf(out, "%s)\n{\n", maxParamOffset == 0 ? "void" : "");
+  std::set<int>::iterator l;
+  for (l = locals.begin(); l != locals.end(); ++l)
+    fprintf(out, "  int l%d = 0;\n", *l);
+  for (size_t b = 0; b < body.size(); b++)
+    fprintf(out, "%s\n", body[b].c_str());
+  fprintf(out, "}\n\n");
+
+  body.clear();
+  declarations.clear();
+  locals.clear();
+  functionName.clear();
+  inFunction = false;
+}
+
+void CSource::EmitParam(Location *arg)
+{
+  params.push_back(Operand(arg));
+}
+
+void CSource::EmitLCall(Location *result, const char *label)
+{
+  std::string fn = (IsBuiltIn(label) ? label : Symbol(label));
+  if (!IsBuiltIn(label))
+    Declare("static int %s();", fn);
+  BeginCall(result, fn, false);
+}
+
+void CSource::EmitACall(Location *result, Location *fnAddr)
+{
+  BeginCall(result, Operand(fnAddr), true);
+}
+
+// The params popped are those passed to the call just made
+void CSource::EmitPopParams(int bytes)
+{
+  FinishCall(bytes / 4);
+}
+
+/* Method: EmitVTable
+ * ------------------
+ * Writes out the vtable as an array of ints, along with the constructor
+ * that fills it in (see csource.h).
+ */
+void CSource::EmitVTable(const char *label, List<const char*> *methodLabels)
+{
+  std::string name = Symbol(label);
+  int n = methodLabels->NumElements();
+  for (int i = 0; i < n; i++)
+    fprintf(out, "static int %s();\n", Symbol(methodLabels->Nth(i)).c_str());
+  for (size_t b = 0; b < body.size(); b++)
+    fprintf(out, "%s\n", body[b].c_str());
+  body.clear();
+
+  fprintf(out, "int %s[%d];\n\n", name.c_str(), n > 0 ? n : 1);
+  fprintf(out, "static void __attribute__((constructor)) %s_0init(void)\n{\n",
+          name.c_str());
+  for (int i = 0; i < n; i++)
+    fprintf(out, "  %s[%d] = (int)(unsigned long)%s;\n", name.c_str(), i,
+            Symbol(methodLabels->Nth(i)).c_str());
+  fprintf(out, "}\n\n");
+}
+
+
+/* Method: EmitPreamble
+ * --------------------
+ * Declares the runtime routines and defines _DecafStart, through which
+ * the runtime's main() enters the program. MEM is the word at an
+ * address plus an offset. DIV and MOD divide as MIPS does, where C
+ * would trap on a zero divisor or INT_MIN / -1.
+ */
+void CSource::EmitPreamble()
+{
+  fprintf(out, "/* standard Decaf preamble */\n"
+          "#define MEM(a, offset) "
+          "(*(int *)(unsigned long)((unsigned)(a) + (offset)))\n\n"
+          "int _Alloc(int size);\n"
+          "int _ReadLine(void);\n"
+          "int _ReadInteger(void);\n"
+          "int _StringEqual(int s1, int s2);\n"
+          "void _PrintInt(int n);\n"
+          "void _PrintString(int s);\n"
+          "void _PrintBool(int b);\n"
+          "void _Halt(void);\n"
+          "void _DivideByZero(void);\n\n"
+          "static int DIV(int a, int b)\n{\n"
+          "  if (b == 0) _DivideByZero();\n"
+          "  return b == -1 ? (int)(0u - (unsigned)a) : a / b;\n}\n\n"
+          "static int MOD(int a, int b)\n{\n"
+          "  if (b == 0) _DivideByZero();\n"
+          "  return b == -1 ? 0 : a %% b;\n}\n\n"
+          "static int d_main();\n\n"
+          "void _DecafStart(void)\n{\n  d_main();\n}\n\n");
+}
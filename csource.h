@@ -0,0 +1,105 @@
+/* File: csource.h
+ * ---------------
+ * The CSource class is a Target (see target.h) that translates the Tac
+ * into C, so that the host's C compiler can do the register allocation,
+ * scheduling and the rest of the optimizing. dcc -target c writes the
+ * whole program as one C translation unit, which is linked with the same
+ * runtime as the x86 code:
+ *
+ *     dcc -target c < prog.decaf > prog.c
+ *     gcc -O2 -no-pie -o prog prog.c runtime.c
+ *
+ * Each Decaf function becomes a C function returning int, with a param
+ * for each of its params (named for their offset from fp, p4, p8, ...)
+ * and a local for each of its locals and temps that is used (l8, l12,
+ * ...); the globals are static ints (g0, g4, ...). Every label is given a "d_"
+ * prefix and has its dots turned into "_0", so that it is a C name that
+ * can't clash with the runtime's.
+ *
+ * The data keeps the layout of the MIPS code, 32-bit words throughout,
+ * with addresses stored as ints, which is why the program is linked
+ * below 4GB (-no-pie). A vtable is an array of ints, filled in with the
+ * addresses of its methods by a constructor function before main runs
+ * (the address of a function isn't a constant int in C). A dynamic call
+ * casts the address back to a function taking as many ints as it is
+ * passed. So does a call to a Decaf function by name, since the function
+ * only has params up to the last one it uses, which can be fewer.
+ *
+ * The params of a call can be pushed well ahead of it, with other calls
+ * in between (e.g. those reporting a bad array subscript), so a call
+ * only knows how many of the params pushed are its own once the
+ * PopParams after it is seen. Until then it is left as a placeholder in
+ * the body.
+ */
+
+#ifndef _H_csource
+#define _H_csource
+
+#include <stdio.h>
+#include <set>
+#include <string>
+#include <vector>
+#include "tac.h"
+#include "list.h"
+#include "target.h"
+class Location;
+
+
+class CSource : public Target {
+  private:
+    FILE *out;
+    std::vector<std::string> body;      // of the function being emitted
+    std::string functionName;
+    bool inFunction;                    // between BeginFunc and EndFunc
+    int maxParamOffset;
+    std::set<int> locals;               // offsets of those used
+    std::set<std::string> declarations; // needed ahead of the function
+    std::vector<std::string> params;    // pushed and not yet passed
+    int callLine;                       // in body, of the pending call
+    std::string callResult, callee;
+    bool callIndirect;
+
+    void Emit(const char *fmt, ...);
+    void Declare(const char *fmt, const std::string &name);
+    std::string Operand(Location *var);
+    void BeginCall(Location *result, const std::string &fn, bool indirect);
+    void FinishCall(int numArgs);
+    static std::string Symbol(const char *label);
+    static bool IsBuiltIn(const char *label);
+
+  public:
+    CSource(FILE *out);
+
+    void EmitComment(const char *text);
+
+    void EmitLoadConstant(Location *dst, int val);
+    void EmitLoadStringConstant(Location *dst, const char *label, const char *str);
+    void EmitLoadLabel(Location *dst, const char *label);
+
+    void EmitLoad(Location *dst, Location *reference, int offset);
+    void EmitStore(Location *reference, Location *value, int offset);
+    void EmitCopy(Location *dst, Location *src);
+
+    void EmitBinaryOp(BinaryOp::OpCode code, Location *dst,
+                      Location *op1, Location *op2);
+
+    void EmitLabel(const char *label);
+    void EmitGoto(const char *label);
+    void EmitIfZ(Location *test, const char *label);
+    void EmitIfNZ(Location *test, const char *label);
+    void EmitReturn(Location *returnVal);
+
+    void EmitBeginFunction(int frameSize);
+    void EmitEndFunction();
+
+    void EmitParam(Location *arg);
+    void EmitLCall(Location *result, const char *label);
+    void EmitACall(Location *result, Location *fnAddr);
+    void EmitPopParams(int bytes);
+
+    void EmitVTable(const char *label, List<const char*> *methodLabels);
+
+    void EmitPreamble();
+};
+
+#endif
@@ -0,0 +1,152 @@
+/* File: decafgen.cc
+ * -----------------
+ * Generates synthetic Decaf programs for measuring how dcc scales with
+ * the size of its input (see bench.sh). Each program stresses one kind
+ * of growth, selected by its shape:
+ *
+ *      classes     a chain of n classes, each extending the one before,
+ *                  with a field and a method of its own plus an override
+ *      methods     a class with n methods, each called from main
+ *      expr        an expression with n operators
+ *      nesting     n nested blocks, each declaring a local variable
+ *      globals     n global variables, each assigned and read in main
+ *
+ * Usage: decafgen <shape> <n>
+ *
+ * The program is written to stdout. It is valid Decaf, which, when run,
+ * prints a single number.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void GenClasses(int n)
+{
+    for (int i = 0; i < n; i++) {
+        if (i == 0)
+            printf("class C0 {\n");
+        else
+            printf("class C%d extends C%d {\n", i, i - 1);
+        printf("  int f%d;\n", i);
+        printf("  void Set%d(int x) { f%d = x; }\n", i, i);
+        if (i == 0)
+            printf("  int Sum0() { return f0; }\n");
+        else
+            printf("  int Sum%d() { return f%d + Sum%d(); }\n", i, i, i - 1);
+        printf("  int Id() { return %d; }\n", i);
+        printf("}\n\n");
+    }
+
+    printf("void main() {\n");
+    printf("  C%d c;\n", n - 1);
+    printf("  c = new C%d;\n", n - 1);
+    for (int i = 0; i < n; i++)
+        printf("  c.Set%d(%d);\n", i, i % 7);
+    printf("  Print(c.Sum%d() + c.Id());\n", n - 1);
+    printf("}\n");
+}
+
+static void GenMethods(int n)
+{
+    printf("class K {\n");
+    printf("  int f;\n");
+    for (int i = 0; i < n; i++)
+        printf("  int M%d(int x) { f = f + %d; return x + f; }\n", i, i % 3);
+    printf("}\n\n");
+
+    printf("void main() {\n");
+    printf("  K k;\n");
+    printf("  int s;\n");
+    printf("  k = new K;\n");
+    printf("  s = 0;\n");
+    for (int i = 0; i < n; i++)
+        printf("  s = k.M%d(s) - s;\n", i);
+    printf("  Print(s);\n");
+    printf("}\n");
+}
+
+static void GenExpr(int n)
+{
+    // The terms cancel out (and stay small, since MIPS add traps on
+    // overflow), so the result is always x
+    static const char *terms[] = { " + 1", " - 1", " * 1", " + x", " - x" };
+
+    printf("void main() {\n");
+    printf("  int x;\n");
+    printf("  x = ReadInteger();\n");
+    printf("  x = x");
+    for (int i = 0; i < n; i++) {
+        if (i % 8 == 0)
+            printf("\n     ");
+        printf("%s", terms[i % 5]);
+    }
+    printf(";\n");
+    printf("  Print(x);\n");
+    printf("}\n");
+}
+
+static void GenNesting(int n)
+{
+    printf("void main() {\n");
+    printf("  int x;\n");
+    printf("  x = 0;\n");
+    for (int i = 0; i < n; i++) {
+        printf("%*s{\n", 2 * (i % 20) + 2, "");
+        printf("%*s  int v%d;\n", 2 * (i % 20) + 2, "", i);
+        printf("%*s  v%d = x + 1;\n", 2 * (i % 20) + 2, "", i);
+        printf("%*s  if (v%d > x) x = v%d;\n", 2 * (i % 20) + 2, "", i, i);
+    }
+    for (int i = n - 1; i >= 0; i--)
+        printf("%*s}\n", 2 * (i % 20) + 2, "");
+    printf("  Print(x);\n");
+    printf("}\n");
+}
+
+static void GenGlobals(int n)
+{
+    for (int i = 0; i < n; i++)
+        printf("int g%d;\n", i);
+    printf("\n");
+
+    printf("void main() {\n");
+    printf("  int s;\n");
+    printf("  s = 0;\n");
+    for (int i = 0; i < n; i++)
+        printf("  g%d = %d;\n", i, i % 5);
+    for (int i = 0; i < n; i++)
+        printf("  s = s + g%d;\n", i);
+    printf("  Print(s);\n");
+    printf("}\n");
+}
+
+static struct {
+    const char *name;
+    void (*gen)(int n);
+} shapes[] = {
+    {"classes", GenClasses},
+    {"methods", GenMethods},
+    {"expr", GenExpr},
+    {"nesting", GenNesting},
+    {"globals", GenGlobals},
+};
+
+int main(int argc, char *argv[])
+{
+    int numShapes = sizeof(shapes) / sizeof(shapes[0]);
+
+    if (argc == 3 && atoi(argv[2]) > 0) {
+        for (int i = 0; i < numShapes; i++) {
+            if (strcmp(argv[1], shapes[i].name) == 0) {
+                shapes[i].gen(atoi(argv[2]));
+                return 0;
+            }
+        }
+    }
+
+    fprintf(stderr, "Usage: decafgen <shape> <n>, where shape is one of:");
+    for (int i = 0; i < numShapes; i++)
+        fprintf(stderr, " %s", shapes[i].name);
+    fprintf(stderr, "\n");
+    return 2;
+}
@@ -10,34 +10,50 @@
 #include <stdarg.h>
 #include <stdio.h>
 using namespace std;
-#include "scanner.h" // for GetLineNumbered
+#include "context.h" // for GetLineNumbered
 #include "ast_type.h"
 #include "ast_expr.h"
 #include "ast_stmt.h"
 #include "ast_decl.h"
 
 
-int ReportError::numErrors = 0;
+int ReportError::NumErrors() {
+    return CompilationContext::Current()->NumErrors();
+}
 
-void ReportError::UnderlineErrorInLine(const char *line, yyltype *pos) {
+void ReportError::UnderlineErrorInLine(ostream& out, const char *line, yyltype *pos) {
     if (!line) return;
-    cerr << line << endl;
+    out << line << endl;
     for (int i = 1; i <= pos->last_column; i++)
-        cerr << (i >= pos->first_column ? '^' : ' ');
-    cerr << endl;
+        out << (i >= pos->first_column ? '^' : ' ');
+    out << endl;
 }
 
  
  
+/* The whole message is built up first and then written in one go, so that
+ * the messages from files being compiled concurrently are not interleaved.
+ * When compiling a named file, the name is included to tell them apart.
+ */
 void ReportError::OutputError(yyltype *loc, string msg) {
-    numErrors++;
-    fflush(stdout); // make sure any buffered text has been output
+    CompilationContext *ctx = CompilationContext::Current();
+    const char *file = ctx->GetSourceName();
+    ostringstream s;
+
+    ctx->CountError();
+    fflush(ctx->GetOutput()); // make sure any buffered text has been output
     if (loc) {
-        cerr << endl << "*** Error line " << loc->first_line << "." << endl;
-        UnderlineErrorInLine(GetLineNumbered(loc->first_line), loc);
-    } else
-        cerr << endl << "*** Error." << endl;
-    cerr << "*** " << msg << endl << endl;
+        s << endl << "*** Error line " << loc->first_line;
+        if (file) s << " of " << file;
+        s << "." << endl;
+        UnderlineErrorInLine(s, ctx->GetLineNumbered(loc->first_line), loc);
+    } else {
+        s << endl << "*** Error";
+        if (file) s << " in " << file;
+        s << "." << endl;
+    }
+    s << "*** " << msg << endl << endl;
+    cerr << s.str() << flush;
 }
 
 
@@ -184,12 +200,13 @@ void ReportError::NoMainFound() {
  * -------------------
  * Standard error-reporting function expected by yacc. Our version merely
  * just calls into the error reporter above, passing the location of
- * the last token read. If you want to suppress the ordinary "parse error"
+ * the last token read (the parser also passes along the scanner, which
+ * we don't need here). If you want to suppress the ordinary "parse error"
  * message from yacc, you can implement yyerror to do nothing and
  * then call ReportError::Formatted yourself with a more descriptive 
  * message.
  */
 
-void yyerror(const char *msg) {
-    ReportError::Formatted(&yylloc, "%s", msg);
+void yyerror(yyltype *loc, void *scanner, const char *msg) {
+    ReportError::Formatted(loc, "%s", msg);
 }
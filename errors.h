@@ -36,7 +36,7 @@ class Operator;
  * the class name, e.g.
  *
  *    if (missingEnd) { 
- *       ReportError::UntermString(&yylloc, str);
+ *       ReportError::UntermString(yylloc, str);
  *    }
  *
  * For some methods, the first argument is the pointer to the location
@@ -105,13 +105,12 @@ class ReportError {
   static void Formatted(yyltype *loc, const char *format, ...);
 
 
-  // Returns number of error messages printed
-  static int NumErrors() { return numErrors; }
+  // Returns number of error messages printed for the file being compiled
+  static int NumErrors();
   
  private:
-  static void UnderlineErrorInLine(const char *line, yyltype *pos);
+  static void UnderlineErrorInLine(ostream& out, const char *line, yyltype *pos);
   static void OutputError(yyltype *loc, string msg);
-  static int numErrors;
 };
   
 // Wording to use for runtime error messages
@@ -2,6 +2,8 @@
  * ------------------
  * Implementation of Hashtable class.
  */
+
+#include "stats.h"
    
 
 /* Hashtable::Enter
@@ -21,6 +23,20 @@ void Hashtable<Value>::Enter(const char *key, Value val, bool overwrite)
 }
 
  
+/* Hashtable::~Hashtable
+ * ---------------------
+ * Frees the keys copied by Enter. The values are left alone, it is up
+ * to the client to free them if needed.
+ */
+template <class Value>
+Hashtable<Value>::~Hashtable()
+{
+  typename multimap<const char *, Value, ltstr>::iterator itr;
+  for (itr = mmap.begin(); itr != mmap.end(); ++itr)
+    free((char *)itr->first);
+}
+
+
 /* Hashtable::Remove
  * -----------------
  * Removes a given key-value pair from table. If no such pair, no
@@ -35,7 +51,9 @@ template <class Value> void Hashtable<Value>::Remove(const char *key, Value val)
   itr = mmap.find(key); // start at first occurrence
   while (itr != mmap.upper_bound(key)) {
     if (itr->second == val) { // iterate to find matching pair
+	const char *k = itr->first;
 	mmap.erase(itr);
+	free((char *)k);
 	break;
     }
     ++itr;
@@ -51,6 +69,7 @@ template <class Value>
 Value Hashtable<Value>::Lookup(const char *key) 
 {
   Value found = NULL;
+  Stats::Count(Stats::HashtableLookups);
   
   if (mmap.count(key) > 0) {
     typename multimap<const char *, Value>::iterator cur, last, prev;
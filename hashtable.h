@@ -54,6 +54,9 @@ template<class Value> class Hashtable {
             // ctor creates a new empty hashtable
      Hashtable() {}
 
+           // dtor frees the copies of the keys (but not the values)
+     ~Hashtable();
+
            // Returns number of entries currently in table
      int NumEntries() const;
 
@@ -0,0 +1,559 @@
+/* File: interp.cc
+ * ---------------
+ * Implementation of the Tac interpreter, see interp.h.
+ */
+
+#include "interp.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "utility.h"
+
+// Indexed by BuiltIn (see codegen.h)
+const char * const Interpreter::builtinNames[] =
+  {"_Alloc", "_ReadLine", "_ReadInteger", "_StringEqual",
+   "_PrintInt", "_PrintString", "_PrintBool", "_Halt", NULL};
+
+Interpreter::Interpreter() {
+    numErrors = 0;
+    failed = false;
+}
+
+
+/* Method: Decode
+ * --------------
+ * Turns a Location into an Operand. The globals are sized here to hold
+ * every one that is used.
+ */
+Interpreter::Operand Interpreter::Decode(Location *loc) {
+    Operand o;
+    o.seg = loc->GetSegment();
+    o.off = loc->GetOffset();
+    if (o.seg == gpRelative && o.off + 4 > (int)globals.size())
+        globals.resize(o.off + 4, 0);
+    return o;
+}
+
+Interpreter::Op *Interpreter::Append(OpCode code) {
+    Op op;
+    memset(&op, 0, sizeof(op));
+    op.code = code;
+    ops.push_back(op);
+    return &ops.back();
+}
+
+// A call leaves its result in v0, from which the Result op copies it
+void Interpreter::AppendResult(Location *result) {
+    if (result != NULL)
+        Append(Result)->dst = Decode(result);
+}
+
+
+void Interpreter::EmitLoadConstant(Location *dst, int val) {
+    Op *op = Append(LoadConst);
+    op->dst = Decode(dst);
+    op->imm = val;
+}
+
+/* Method: EmitLoadStringConstant
+ * ------------------------------
+ * Lays out the string in the data, as SPIM would for the .asciiz the
+ * Mips class emits: str is in quotes and may contain \n, \t and \"
+ * escapes.
+ */
+void Interpreter::EmitLoadStringConstant(Location *dst, const char *label,
+                                         const char *str) {
+    unsigned address = DataBase + data.size();
+    dataLabels[label] = address;
+    for (const char *s = str + 1; *s != '\0' && *s != '"'; s++) {
+        char c = *s;
+        if (c == '\\' && s[1] != '\0') {
+            switch (*++s) {
+              case 'n': c = '\n'; break;
+              case 't': c = '\t'; break;
+              case '0': c = '\0'; break;
+              default: c = *s; break;
+            }
+        }
+        data.push_back(c);
+    }
+    data.push_back('\0');
+    data.resize((data.size() + 3) & ~3, 0);
+    EmitLoadConstant(dst, address);
+}
+
+void Interpreter::EmitLoadLabel(Location *dst, const char *label) {
+    Fixup f = { label, false, (int)ops.size() };
+    fixups.push_back(f);
+    EmitLoadConstant(dst, 0);
+}
+
+void Interpreter::EmitLoad(Location *dst, Location *reference, int offset) {
+    Op *op = Append(LoadWord);
+    op->dst = Decode(dst);
+    op->a = Decode(reference);
+    op->imm = offset;
+}
+
+void Interpreter::EmitStore(Location *reference, Location *value, int offset) {
+    Op *op = Append(StoreWord);
+    op->a = Decode(reference);
+    op->b = Decode(value);
+    op->imm = offset;
+}
+
+void Interpreter::EmitCopy(Location *dst, Location *src) {
+    Op *op = Append(Copy);
+    op->dst = Decode(dst);
+    op->a = Decode(src);
+}
+
+void Interpreter::EmitBinaryOp(BinaryOp::OpCode code, Location *dst,
+                               Location *op1, Location *op2) {
+    Op *op = Append((OpCode)(Add + code));
+    op->dst = Decode(dst);
+    op->a = Decode(op1);
+    op->b = Decode(op2);
+}
+
+void Interpreter::EmitLabel(const char *label) {
+    codeLabels[label] = ops.size();
+}
+
+void Interpreter::EmitGoto(const char *label) {
+    Fixup f = { label, false, (int)ops.size() };
+    fixups.push_back(f);
+    Append(Goto);
+}
+
+void Interpreter::EmitIfZ(Location *test, const char *label) {
+    Fixup f = { label, false, (int)ops.size() };
+    fixups.push_back(f);
+    Append(IfZ)->a = Decode(test);
+}
+
+void Interpreter::EmitIfNZ(Location *test, const char *label) {
+    Fixup f = { label, false, (int)ops.size() };
+    fixups.push_back(f);
+    Append(IfNZ)->a = Decode(test);
+}
+
+void Interpreter::EmitReturn(Location *returnVal) {
+    if (returnVal == NULL)
+        Append(Return);
+    else
+        Append(ReturnValue)->a = Decode(returnVal);
+}
+
+void Interpreter::EmitBeginFunction(int frameSize) {
+    Append(BeginFunc)->imm = frameSize;
+}
+
+void Interpreter::EmitEndFunction() {
+    Append(Return);
+}
+
+void Interpreter::EmitParam(Location *arg) {
+    Append(Param)->a = Decode(arg);
+}
+
+void Interpreter::EmitLCall(Location *result, const char *label) {
+    for (int i = 0; builtinNames[i] != NULL; i++) {
+        if (strcmp(label, builtinNames[i]) == 0) {
+            Append(CallBuiltin)->imm = i;
+            AppendResult(result);
+            return;
+        }
+    }
+    Fixup f = { label, false, (int)ops.size() };
+    fixups.push_back(f);
+    Append(Call);
+    AppendResult(result);
+}
+
+void Interpreter::EmitACall(Location *result, Location *fnAddr) {
+    Append(CallAddr)->a = Decode(fnAddr);
+    AppendResult(result);
+}
+
+void Interpreter::EmitPopParams(int bytes) {
+    if (bytes != 0)
+        Append(PopParams)->imm = bytes;
+}
+
+void Interpreter::EmitVTable(const char *label, List<const char*> *methodLabels) {
+    dataLabels[label] = DataBase + data.size();
+    for (int i = 0; i < methodLabels->NumElements(); i++) {
+        Fixup f = { methodLabels->Nth(i), true, (int)data.size() };
+        fixups.push_back(f);
+        data.resize(data.size() + 4, 0);
+    }
+}
+
+
+/* Method: ResolveFixups
+ * ---------------------
+ * Fills in the labels used now that all of the code is in: jumps and
+ * calls are given the index of the op they go to, and the address of a
+ * label loaded or put in a vtable is its address in the text or data.
+ * Returns false if some label was never defined.
+ */
+bool Interpreter::ResolveFixups() {
+    for (size_t i = 0; i < fixups.size(); i++) {
+        Fixup *f = &fixups[i];
+        std::map<std::string, int>::iterator code = codeLabels.find(f->label);
+        std::map<std::string, unsigned>::iterator d = dataLabels.find(f->label);
+        unsigned address;
+        if (code != codeLabels.end())
+            address = TextBase + 4 * code->second;
+        else if (d != dataLabels.end())
+            address = d->second;
+        else {
+            fprintf(stderr, "*** Undefined label %s\n", f->label.c_str());
+            numErrors++;
+            continue;
+        }
+
+        if (f->inData)
+            memcpy(&data[f->index], &address, 4);
+        else if (ops[f->index].code == LoadConst)
+            ops[f->index].imm = address;
+        else if (code != codeLabels.end())
+            ops[f->index].imm = code->second;
+        else {
+            fprintf(stderr, "*** Cannot jump to %s\n", f->label.c_str());
+            numErrors++;
+        }
+    }
+    fixups.clear();
+    return numErrors == 0;
+}
+
+
+/* Method: RuntimeError
+ * --------------------
+ * Reports an error that stops the program. The messages go to stdout,
+ * where SPIM's console would show them, so that they come out in order
+ * with the program's own output.
+ */
+void Interpreter::RuntimeError(const char *fmt, ...) {
+    va_list args;
+    printf("*** Runtime error: ");
+    va_start(args, fmt);
+    vprintf(fmt, args);
+    va_end(args);
+    printf("\n");
+    failed = true;
+}
+
+/* Method: StackOverflow
+ * ---------------------
+ * Reports a store to addr, below the lowest address SPIM would grow the
+ * stack to, in the words SPIM uses. SPIM doubles the stack each time it
+ * grows, so the failed attempt is always the one that would take it to
+ * twice the limit.
+ */
+void Interpreter::StackOverflow(unsigned addr) {
+    int extra = (StackTop - StackSize) - addr + 4;
+    int newSize = StackSize + (extra > StackSize ? extra : StackSize);
+    printf("Can't expand stack segment by %d bytes to %d bytes\n"
+           "Use -lstack # with # > %d\n", extra, newSize, newSize);
+    failed = true;
+}
+
+/* Method: Address
+ * ---------------
+ * Maps an address in the globals, the data, the heap or the stack to
+ * where its bytes are kept. On an error, returns NULL.
+ */
+char *Interpreter::Address(unsigned addr, int size) {
+    if (addr % size != 0) {
+        RuntimeError("unaligned address 0x%08x", addr);
+        return NULL;
+    }
+    if (addr - DataBase < data.size())
+        return &data[addr - DataBase];
+    if (addr - (StackTop - StackSize) < (unsigned)StackSize)
+        return &stack[addr - (StackTop - StackSize)];
+    if (addr - GlobalBase < globals.size())
+        return &globals[addr - GlobalBase];
+    RuntimeError("bad address 0x%08x", addr);
+    return NULL;
+}
+
+// The heap grows up from the end of the data, a word at a time
+unsigned Interpreter::Sbrk(int bytes) {
+    unsigned old = DataBase + data.size();
+    if (bytes < 0 || data.size() + (long)bytes > (unsigned)HeapLimit) {
+        RuntimeError("cannot allocate %d bytes, the heap is full", bytes);
+        return 0;
+    }
+    data.resize(data.size() + ((bytes + 3) & ~3), 0);
+    return old;
+}
+
+std::string Interpreter::StringAt(unsigned addr) {
+    std::string s;
+    char *p;
+    while ((p = Address(addr++, 1)) != NULL && *p != '\0')
+        s += *p;
+    return s;
+}
+
+/* Method: DoBuiltin
+ * -----------------
+ * Runs the runtime routine numbered which (see builtinNames), with its
+ * arguments on the stack at sp + 4 on, and sets *result to what it
+ * returns. Returns whether the program should go on.
+ */
+bool Interpreter::DoBuiltin(int which, unsigned sp, int *result) {
+    int arg0 = 0, arg1 = 0;
+    char *p;
+    if (which == 0 || which >= 3) {
+        if ((p = Address(sp + 4, 4)) == NULL)
+            return false;
+        memcpy(&arg0, p, 4);
+    }
+    if (which == 3) {
+        if ((p = Address(sp + 8, 4)) == NULL)
+            return false;
+        memcpy(&arg1, p, 4);
+    }
+
+    switch (which) {
+      case 0:                                   // _Alloc
+        *result = Sbrk(arg0);
+        break;
+      case 1: {                                 // _ReadLine
+        char line[ReadLineSize];
+        fflush(stdout);
+        if (fgets(line, sizeof(line), stdin) == NULL)
+            line[0] = '\0';
+        line[strcspn(line, "\n")] = '\0';
+        unsigned buffer = Sbrk(ReadLineSize);
+        if (buffer != 0)
+            strcpy(&data[buffer - DataBase], line);
+        *result = buffer;
+        break;
+      }
+      case 2: {                                 // _ReadInteger
+        char line[256];
+        fflush(stdout);
+        if (fgets(line, sizeof(line), stdin) == NULL)
+            line[0] = '\0';
+        *result = atoi(line);
+        break;
+      }
+      case 3: {                                 // _StringEqual
+        std::string s1 = StringAt(arg0);
+        *result = (s1 == StringAt(arg1));
+        break;
+      }
+      case 4:                                   // _PrintInt
+        printf("%d", arg0);
+        break;
+      case 5:                                   // _PrintString
+        fputs(StringAt(arg0).c_str(), stdout);
+        break;
+      case 6:                                   // _PrintBool
+        fputs(arg0 ? "true" : "false", stdout);
+        break;
+      case 7:                                   // _Halt
+        return false;
+    }
+    return !failed;
+}
+
+
+/* Method: Run
+ * -----------
+ * Runs the program. It is entered through a Call to main followed by an
+ * Exit, which main returns to. The registers of the machine are locals
+ * here: ip is the op to run next, fp and sp are the frame and stack
+ * pointers (addresses, as the program sees them), ra is the index of
+ * the op a call returns to and v0 holds the result of the last call. base caches where the words at fp and gp are
+ * kept, which is all an operand needs.
+ */
+#define STACK(addr)     (&stack[(addr) - (StackTop - StackSize)])
+#define VALUE(o)        (*(int *)(base[(o).seg] + (o).off))
+#define NEXT()          do { op = ip++; goto *op->handler; } while (0)
+
+int Interpreter::Run() {
+    static const void * const handlers[NumOpCodes] = {
+        &&do_LoadConst, &&do_Copy, &&do_LoadWord, &&do_StoreWord,
+        &&do_Add, &&do_Sub, &&do_Mul, &&do_Div, &&do_Mod, &&do_Eq,
+        &&do_Less, &&do_And, &&do_Or, &&do_Goto, &&do_IfZ, &&do_IfNZ,
+        &&do_BeginFunc, &&do_Return, &&do_ReturnValue, &&do_Param, &&do_PopParams,
+        &&do_Call, &&do_CallAddr, &&do_CallBuiltin, &&do_Result, &&do_Exit };
+
+    if (codeLabels.find("main") == codeLabels.end()) {
+        fprintf(stderr, "*** No main to run\n");
+        return 1;
+    }
+    int start = ops.size();
+    Fixup f = { "main", false, start };
+    fixups.push_back(f);
+    Append(Call);
+    Append(Exit);
+    if (!ResolveFixups())
+        return 1;
+    for (size_t i = 0; i < ops.size(); i++)
+        ops[i].handler = handlers[ops[i].code];
+
+    stack.assign(StackSize, 0);
+    const unsigned stackLow = StackTop - StackSize;
+    Op *code = &ops[0], *ip = code + start, *op;
+    unsigned sp = StackStart, fp = sp;
+    int ra = 0, v0 = 0;
+    char *base[2];
+    base[fpRelative] = STACK(fp);
+    base[gpRelative] = (globals.empty() ? NULL : &globals[0]);
+    failed = false;
+
+    NEXT();
+
+  do_LoadConst:
+    VALUE(op->dst) = op->imm;
+    NEXT();
+  do_Copy:
+    VALUE(op->dst) = VALUE(op->a);
+    NEXT();
+  do_LoadWord: {
+    char *p = Address(VALUE(op->a) + op->imm, 4);
+    if (p == NULL)
+        goto done;
+    memcpy(&VALUE(op->dst), p, 4);
+    NEXT();
+  }
+  do_StoreWord: {
+    char *p = Address(VALUE(op->a) + op->imm, 4);
+    if (p == NULL)
+        goto done;
+    memcpy(p, &VALUE(op->b), 4);
+    NEXT();
+  }
+
+    // An Add or Sub that overflows traps, as MIPS add and sub do, and
+    // leaves dst as it was; a Mul wraps around, as mul does
+  do_Add: {
+    int result;
+    if (__builtin_add_overflow(VALUE(op->a), VALUE(op->b), &result)) {
+        RuntimeError("arithmetic overflow");
+        goto done;
+    }
+    VALUE(op->dst) = result;
+    NEXT();
+  }
+  do_Sub: {
+    int result;
+    if (__builtin_sub_overflow(VALUE(op->a), VALUE(op->b), &result)) {
+        RuntimeError("arithmetic overflow");
+        goto done;
+    }
+    VALUE(op->dst) = result;
+    NEXT();
+  }
+  do_Mul:
+    VALUE(op->dst) = (unsigned)VALUE(op->a) * (unsigned)VALUE(op->b);
+    NEXT();
+  do_Div:
+  do_Mod: {
+    int a = VALUE(op->a), b = VALUE(op->b);
+    if (b == 0) {
+        RuntimeError("division by zero");
+        goto done;
+    }
+    if (b == -1)
+        VALUE(op->dst) = (op->code == Div ? 0u - (unsigned)a : 0);
+    else
+        VALUE(op->dst) = (op->code == Div ? a / b : a % b);
+    NEXT();
+  }
+  do_Eq:
+    VALUE(op->dst) = (VALUE(op->a) == VALUE(op->b));
+    NEXT();
+  do_Less:
+    VALUE(op->dst) = (VALUE(op->a) < VALUE(op->b));
+    NEXT();
+  do_And:
+    VALUE(op->dst) = VALUE(op->a) & VALUE(op->b);
+    NEXT();
+  do_Or:
+    VALUE(op->dst) = VALUE(op->a) | VALUE(op->b);
+    NEXT();
+
+  do_Goto:
+    ip = code + op->imm;
+    NEXT();
+  do_IfZ:
+    if (VALUE(op->a) == 0)
+        ip = code + op->imm;
+    NEXT();
+  do_IfNZ:
+    if (VALUE(op->a) != 0)
+        ip = code + op->imm;
+    NEXT();
+
+    // The frame is set up and torn down as the Mips code does it: the
+    // caller's fp is saved at fp and the return address at fp - 4
+  do_BeginFunc:
+    if (sp - 8 - op->imm < stackLow) {
+        StackOverflow(sp < stackLow ? sp : stackLow - 4);
+        goto done;
+    }
+    memcpy(STACK(sp), &fp, 4);
+    memcpy(STACK(sp - 4), &ra, 4);
+    fp = sp;
+    sp -= 8 + op->imm;
+    base[fpRelative] = STACK(fp);
+    NEXT();
+  do_ReturnValue:
+    v0 = VALUE(op->a);
+  do_Return:
+    sp = fp;
+    memcpy(&ra, STACK(fp - 4), 4);
+    memcpy(&fp, STACK(fp), 4);
+    base[fpRelative] = STACK(fp);
+    ip = code + ra;
+    NEXT();
+
+  do_Param:
+    if (sp < stackLow) {
+        StackOverflow(sp);
+        goto done;
+    }
+    memcpy(STACK(sp), &VALUE(op->a), 4);
+    sp -= 4;
+    NEXT();
+  do_PopParams:
+    sp += op->imm;
+    NEXT();
+
+  do_Call:
+    ra = ip - code;
+    ip = code + op->imm;
+    NEXT();
+  do_CallAddr: {
+    unsigned index = ((unsigned)VALUE(op->a) - TextBase) / 4;
+    if ((VALUE(op->a) & 3) != 0 || index >= ops.size()) {
+        RuntimeError("bad function address 0x%08x", VALUE(op->a));
+        goto done;
+    }
+    ra = ip - code;
+    ip = code + index;
+    NEXT();
+  }
+  do_CallBuiltin:
+    if (!DoBuiltin(op->imm, sp, &v0))
+        goto done;
+    NEXT();
+  do_Result:
+    VALUE(op->dst) = v0;
+    NEXT();
+
+  do_Exit:
+  done:
+    fflush(stdout);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,156 @@
+/* File: interp.h
+ * --------------
+ * The Interpreter class runs a program straight from its Tac, which is
+ * what dcc -run does, so that a Decaf program can be tried out without
+ * going through SPIM. It is a Target (see target.h): as the code for
+ * each function is flushed, the instructions are decoded into a compact
+ * form of their own, and once the whole program is in, Run() executes
+ * it, starting from main.
+ *
+ * The decoded operations are direct threaded: each holds the address of
+ * the code that carries it out (a GNU C "labels as values" address), so
+ * dispatching the next one is a single indirect jump. Operands are
+ * decoded to a segment and an offset, which is all a Location is at run
+ * time.
+ *
+ * The machine it models is the one the Mips class targets on SPIM, so
+ * that a program behaves the same both ways. Memory is made of 32-bit
+ * words addressed by byte: the globals are at 0x10000000, the string
+ * constants and vtables at 0x10010000 with the heap right after them,
+ * and the stack grows down from 0x80000000. Stack frames are laid out by
+ * the same offsets the CodeGenerator assigns (see codegen.h), with the
+ * caller's fp and the return address saved where the Mips code saves
+ * them. The address of a function is an address in the text segment,
+ * 0x00400000 up, one word per operation.
+ *
+ * The stack starts where SPIM starts it and may grow as far as SPIM lets
+ * it, so a program that recurses too deeply stops at the same point, with
+ * the same message. (SPIM stops when the first word below the limit is
+ * stored to; this checks each frame as it is made, and takes the words
+ * in it to be stored to from the top down, which is how they usually
+ * are.)
+ *
+ * The Decaf runtime routines (_Alloc, _PrintInt, etc.) are built in. A
+ * runtime error (a bad address, a division by zero, an add or subtract
+ * that overflows, running out of stack) stops the program where SPIM
+ * would stop it, and is reported on stdout. Only running out of stack
+ * is reported in SPIM's words; the others have no MIPS pc to report.
+ *
+ * Most of the time dcc -run takes goes to compiling: on the kernels in
+ * samples/perf.baseline, Run() itself takes from 1 ms (perf_fib) to
+ * 18 ms (perf_matrix), 5 to 18 times less than mipssim takes to run the
+ * MIPS code, but the whole of dcc -run takes from 0.4 to 5 times as long
+ * as mipssim.
+ */
+
+#ifndef _H_interp
+#define _H_interp
+
+#include <map>
+#include <string>
+#include <vector>
+#include "target.h"
+
+
+class Interpreter : public Target
+{
+  public:
+    Interpreter();
+
+    void EmitLoadConstant(Location *dst, int val);
+    void EmitLoadStringConstant(Location *dst, const char *label, const char *str);
+    void EmitLoadLabel(Location *dst, const char *label);
+
+    void EmitLoad(Location *dst, Location *reference, int offset);
+    void EmitStore(Location *reference, Location *value, int offset);
+    void EmitCopy(Location *dst, Location *src);
+
+    void EmitBinaryOp(BinaryOp::OpCode code, Location *dst,
+                      Location *op1, Location *op2);
+
+    void EmitLabel(const char *label);
+    void EmitGoto(const char *label);
+    void EmitIfZ(Location *test, const char *label);
+    void EmitIfNZ(Location *test, const char *label);
+    void EmitReturn(Location *returnVal);
+
+    void EmitBeginFunction(int frameSize);
+    void EmitEndFunction();
+
+    void EmitParam(Location *arg);
+    void EmitLCall(Location *result, const char *label);
+    void EmitACall(Location *result, Location *fnAddr);
+    void EmitPopParams(int bytes);
+
+    void EmitVTable(const char *label, List<const char*> *methodLabels);
+
+         // Runs the program from main, with stdin and stdout as its
+         // console. Returns its exit status: 0 when the program finishes
+         // normally, 1 when it was stopped by a runtime error.
+    int Run();
+
+  private:
+    typedef enum { LoadConst, Copy, LoadWord, StoreWord,
+                   Add, Sub, Mul, Div, Mod, Eq, Less, And, Or,
+                   Goto, IfZ, IfNZ, BeginFunc, Return, ReturnValue,
+                   Param, PopParams, Call, CallAddr, CallBuiltin, Result,
+                   Exit, NumOpCodes } OpCode;
+
+         // A decoded operand: its value is the word at base[seg] + off,
+         // where base[fpRelative] is the current frame and base[gpRelative]
+         // the globals
+    struct Operand {
+        int seg;
+        int off;
+    };
+
+    struct Op {
+        const void *handler;    // the code for it, filled in by Run
+        OpCode code;
+        Operand dst, a, b;
+        int imm;                // the constant, offset, frame size, etc.,
+    };                          // or the index of the op to jump to
+
+         // A use of a label, which can only be filled in once all of the
+         // code is in
+    struct Fixup {
+        std::string label;
+        bool inData;
+        int index;              // of the op, or of the data word
+    };
+
+    static const unsigned TextBase = 0x00400000u;
+    static const unsigned GlobalBase = 0x10000000u;
+    static const unsigned DataBase = 0x10010000u;
+    static const unsigned StackTop = 0x80000000u;
+    static const unsigned StackStart = StackTop - 4112;
+    static const int StackSize = 256 * 1024;   // as far as SPIM grows it
+    static const int HeapLimit = 64 * 1024 * 1024;
+    static const int ReadLineSize = 128;
+
+    static const char * const builtinNames[];
+
+    std::vector<Op> ops;
+    std::vector<char> data;             // the constants, then the heap
+    std::vector<char> globals;
+    std::vector<char> stack;            // indexed from StackTop - StackSize
+    std::map<std::string, int> codeLabels;
+    std::map<std::string, unsigned> dataLabels;
+    std::vector<Fixup> fixups;
+    int numErrors;
+    bool failed;                        // set by a runtime error
+
+    Operand Decode(Location *loc);
+    Op *Append(OpCode code);
+    void AppendResult(Location *result);
+    bool ResolveFixups();
+
+    char *Address(unsigned addr, int size);
+    unsigned Sbrk(int bytes);
+    std::string StringAt(unsigned addr);
+    void RuntimeError(const char *fmt, ...);
+    void StackOverflow(unsigned addr);
+    bool DoBuiltin(int which, unsigned sp, int *result);
+};
+
+#endif
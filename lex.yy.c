@@ -0,0 +1,81 @@
+// Throwaway hand-written stand-in for the flex scanner (sandbox has no flex).
+#include <string.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <string>
+#include <vector>
+#include "scanner.h"
+#include "errors.h"
+#include "parser.h"
+struct HS { std::string text; size_t pos; int line, col; std::vector<const char*> lines; };
+void *InitScanner(FILE *in) {
+  HS *s = new HS; s->pos = 0; s->line = 1; s->col = 1;
+  int c; while ((c = fgetc(in)) != EOF) s->text.push_back(c);
+  std::string cur;
+  for (size_t i = 0; i < s->text.size(); i++) {
+    if (s->text[i] == '\n') { s->lines.push_back(strdup(cur.c_str())); cur.clear(); }
+    else cur.push_back(s->text[i]);
+  }
+  s->lines.push_back(strdup(cur.c_str()));
+  return s;
+}
+void FreeScanner(void *p) { HS *s = (HS*)p; for (size_t i = 0; i < s->lines.size(); i++) free((char*)s->lines[i]); delete s; }
+const char *GetLineNumbered(void *p, int n) { HS *s = (HS*)p; if (n <= 0 || n > (int)s->lines.size()) return NULL; return s->lines[n-1]; }
+static const struct { const char *w; int t; } kw[] = {
+ {"void",T_Void},{"int",T_Int},{"double",T_Double},{"bool",T_Bool},{"string",T_String},{"null",T_Null},
+ {"class",T_Class},{"extends",T_Extends},{"this",T_This},{"interface",T_Interface},{"implements",T_Implements},
+ {"while",T_While},{"for",T_For},{"if",T_If},{"else",T_Else},{"return",T_Return},{"break",T_Break},
+ {"new",T_New},{"NewArray",T_NewArray},{"Print",T_Print},{"ReadInteger",T_ReadInteger},{"ReadLine",T_ReadLine},{0,0}};
+int yylex(YYSTYPE *yylval, yyltype *yylloc, void *p) {
+  HS *s = (HS*)p; const std::string &t = s->text;
+  for (;;) {
+    if (s->pos >= t.size()) return 0;
+    char c = t[s->pos];
+    if (c == '\n') { s->line++; s->col = 1; s->pos++; continue; }
+    if (c == ' ' || c == '\r') { s->col++; s->pos++; continue; }
+    if (c == '\t') { s->col += 8 - s->col % 8 + 1; s->pos++; continue; }
+    if (t.compare(s->pos, 2, "//") == 0) { while (s->pos < t.size() && t[s->pos] != '\n') s->pos++; continue; }
+    if (t.compare(s->pos, 2, "/*") == 0) {
+      s->pos += 2; s->col += 2;
+      while (s->pos < t.size() && t.compare(s->pos, 2, "*/") != 0) { if (t[s->pos] == '\n') { s->line++; s->col = 1; } else s->col++; s->pos++; }
+      if (s->pos >= t.size()) { ReportError::UntermComment(); return 0; }
+      s->pos += 2; s->col += 2; continue;
+    }
+    break;
+  }
+  size_t st = s->pos; char c = t[st]; int tok;
+  if (isalpha(c)) {
+    while (s->pos < t.size() && (isalnum(t[s->pos]) || t[s->pos] == '_')) s->pos++;
+    std::string w = t.substr(st, s->pos - st); tok = T_Identifier;
+    for (int i = 0; kw[i].w; i++) if (w == kw[i].w) tok = kw[i].t;
+    if (w == "true" || w == "false") { tok = T_BoolConstant; yylval->boolConstant = w[0] == 't'; }
+    if (tok == T_Identifier) { strncpy(yylval->identifier, w.c_str(), MaxIdentLen); yylval->identifier[MaxIdentLen] = 0; }
+  } else if (isdigit(c)) {
+    if (c == '0' && s->pos + 2 < t.size() + 1 && (t[st+1] == 'x' || t[st+1] == 'X') && isxdigit(t[st+2])) {
+      s->pos += 2; while (s->pos < t.size() && isxdigit(t[s->pos])) s->pos++;
+      yylval->integerConstant = strtol(t.substr(st).c_str(), NULL, 16); tok = T_IntConstant;
+    } else {
+      while (s->pos < t.size() && isdigit(t[s->pos])) s->pos++;
+      if (s->pos < t.size() && t[s->pos] == '.') {
+        s->pos++; while (s->pos < t.size() && isdigit(t[s->pos])) s->pos++;
+        if (s->pos < t.size() && (t[s->pos]=='e'||t[s->pos]=='E')) { size_t q = s->pos+1; if (q<t.size()&&(t[q]=='+'||t[q]=='-')) q++; if (q<t.size()&&isdigit(t[q])) { s->pos=q; while (s->pos<t.size()&&isdigit(t[s->pos])) s->pos++; } }
+        yylval->doubleConstant = atof(t.substr(st, s->pos-st).c_str()); tok = T_DoubleConstant;
+      } else { yylval->integerConstant = strtol(t.substr(st, s->pos-st).c_str(), NULL, 10); tok = T_IntConstant; }
+    }
+  } else if (c == '"') {
+    s->pos++; while (s->pos < t.size() && t[s->pos] != '"' && t[s->pos] != '\n') s->pos++;
+    if (s->pos < t.size() && t[s->pos] == '"') { s->pos++; yylval->stringConstant = strdup(t.substr(st, s->pos-st).c_str()); tok = T_StringConstant; }
+    else { yylloc->first_line = s->line; yylloc->first_column = s->col; yylloc->last_column = s->col + (s->pos-st) - 1; s->col += s->pos-st; ReportError::UntermString(yylloc, t.substr(st, s->pos-st).c_str()); return yylex(yylval, yylloc, p); }
+  } else {
+    static const struct { const char *o; int t; } ops[] = {{"<=",T_LessEqual},{">=",T_GreaterEqual},{"==",T_Equal},{"!=",T_NotEqual},{"&&",T_And},{"||",T_Or},{"[]",T_Dims},{0,0}};
+    tok = -1;
+    for (int i = 0; ops[i].o; i++) if (t.compare(st, 2, ops[i].o) == 0) { tok = ops[i].t; s->pos += 2; break; }
+    if (tok < 0) {
+      s->pos++;
+      if (strchr("-+/*%=.,;!<>()[]{}", c)) tok = c;
+      else { yylloc->first_line = s->line; yylloc->first_column = s->col; yylloc->last_column = s->col; s->col++; ReportError::UnrecogChar(yylloc, c); return yylex(yylval, yylloc, p); }
+    }
+  }
+  yylloc->first_line = s->line; yylloc->first_column = s->col; yylloc->last_column = s->col + (s->pos - st) - 1; s->col += s->pos - st;
+  return tok;
+}
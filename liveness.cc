@@ -0,0 +1,85 @@
+/* File: liveness.cc
+ * -----------------
+ * Implementation of the Liveness class, by the usual backward dataflow
+ * iteration. The blocks waiting to be looked at are taken in postorder,
+ * so that each comes after its successors (but for back edges), and a
+ * block is only looked at again once what is live into one of its
+ * successors has changed.
+ */
+
+#include "liveness.h"
+#include "cfg.h"
+#include "ssa.h"
+#include <set>
+
+Liveness::Liveness(FlowGraph *g) {
+  graph = g;
+  for (size_t i = 0; i < graph->rpo.size(); i++) {
+    BasicBlock *b = graph->rpo[i];
+    for (size_t j = 0; j < b->code.size(); j++) {
+      List<Location*> srcs;
+      b->code[j]->GetSrcs(&srcs);
+      for (int s = 0; s < srcs.NumElements(); s++)
+        VarFor(srcs.Nth(s));
+      if (b->code[j]->GetDst() != NULL)
+        VarFor(b->code[j]->GetDst());
+    }
+  }
+
+  int numVars = NumVars();
+  liveIn.assign(graph->blocks.size(), std::vector<bool>(numVars, false));
+  liveOut.assign(graph->blocks.size(), std::vector<bool>(numVars, false));
+  std::set<int> work;                           // by rpo number
+  for (size_t i = 0; i < graph->rpo.size(); i++)
+    work.insert(i);
+  while (!work.empty()) {
+    BasicBlock *b = graph->rpo[*work.rbegin()];
+    work.erase(b->rpoNumber);
+    std::vector<bool> live(numVars, false);
+    if (b->succs.empty()) {
+      for (size_t g = 0; g < globalVars.size(); g++)
+        live[globalVars[g]] = true;
+    } else {
+      live = liveIn[b->succs[0]->id];
+    }
+    for (size_t s = 1; s < b->succs.size(); s++) {
+      std::vector<bool> &in = liveIn[b->succs[s]->id];
+      for (int v = 0; v < numVars; v++)
+        if (in[v])
+          live[v] = true;
+    }
+    liveOut[b->id] = live;
+    for (size_t j = b->code.size(); j-- > 0; )
+      Step(b->code[j], &live);
+    if (live != liveIn[b->id]) {
+      liveIn[b->id] = live;
+      for (size_t p = 0; p < b->preds.size(); p++)
+        if (b->preds[p]->rpoNumber >= 0)
+          work.insert(b->preds[p]->rpoNumber);
+    }
+  }
+}
+
+int Liveness::VarFor(Location *loc) {
+  std::pair<int,int> key(loc->GetSegment(), loc->GetOffset());
+  std::map<std::pair<int,int>, int>::iterator i = varIndex.find(key);
+  if (i != varIndex.end())
+    return i->second;
+  int var = varIndex.size();
+  varIndex[key] = var;
+  if (loc->GetSegment() == gpRelative)
+    globalVars.push_back(var);
+  return var;
+}
+
+void Liveness::Step(Instruction *instr, std::vector<bool> *live) {
+  if (instr->GetDst() != NULL)
+    (*live)[VarFor(instr->GetDst())] = false;
+  List<Location*> srcs;
+  instr->GetSrcs(&srcs);
+  for (int s = 0; s < srcs.NumElements(); s++)
+    (*live)[VarFor(srcs.Nth(s))] = true;
+  if (SSAForm::IsCall(instr))
+    for (size_t g = 0; g < globalVars.size(); g++)
+      (*live)[globalVars[g]] = true;
+}
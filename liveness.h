@@ -0,0 +1,44 @@
+/* File: liveness.h
+ * ----------------
+ * The Liveness class finds which variables of a function are live (may
+ * still be read before being assigned again) at the start and end of
+ * each block of its flow graph (see cfg.h), for the passes that remove
+ * or move code (see optimizer.h).
+ *
+ * The variables are the Locations the code uses, told apart by segment
+ * and offset. Globals are taken to be read by every call, and to be live
+ * when the function returns; the locals, temps and params are not.
+ */
+
+#ifndef _H_liveness
+#define _H_liveness
+
+#include <map>
+#include <utility>
+#include <vector>
+#include "tac.h"
+class FlowGraph;
+
+class Liveness {
+  private:
+    FlowGraph *graph;
+    std::map<std::pair<int,int>, int> varIndex;   // by segment and offset
+    std::vector<int> globalVars;
+
+  public:
+    std::vector<std::vector<bool> > liveIn, liveOut;  // by block id, var
+
+         // The graph must not change while this is in use (the Optimizer
+         // keeps one until a pass changes the code, see optimizer.h)
+    Liveness(FlowGraph *graph);
+
+         // Returns the index of the variable at loc
+    int VarFor(Location *loc);
+    int NumVars()                   { return varIndex.size(); }
+
+         // Changes live from the variables live after instr to those
+         // live before it
+    void Step(Instruction *instr, std::vector<bool> *live);
+};
+
+#endif
@@ -2,9 +2,10 @@
  * ----------------
  * This file just contains features relative to the location structure
  * used to record the lexical position of a token or symbol.  This file
- * establishes the cmoon definition for the yyltype structure, the global
- * variable yylloc, and a utility function to join locations you might
- * find handy at times.
+ * establishes the cmoon definition for the yyltype structure and a
+ * utility function to join locations you might find handy at times.
+ * (The parser is reentrant, so there is no global yylloc, the location
+ * of the lexeme just scanned is passed from the scanner to the parser.)
  */
 
 #ifndef YYLTYPE
@@ -24,13 +25,10 @@ typedef struct yyltype
 
 #define YYLTYPE yyltype
 
-
-/* Global variable: yylloc
- * ------------------------
- * The global variable holding the position information about the
- * lexeme just scanned.
- */
-extern struct yyltype yylloc;
+// yyltype is plain old data, which lets the parser grow its stacks by
+// copying them (without this, a C++ parser is stuck at its initial depth
+// of 200, which a few hundred statements in one block exhaust)
+#define YYLTYPE_IS_TRIVIAL 1
 
 
 /* Function: Join
@@ -1,30 +1,242 @@
 /* File: main.cc
  * -------------
  * This file defines the main() routine for the program and not much else.
- * You should not need to modify this file.
+ * It sorts out the command line and hands each input off to its own
+ * CompilationContext.
  */
  
 #include <string.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string>
 #include "utility.h"
+#include "list.h"
 #include "errors.h"
 #include "parser.h"
+#include "context.h"
+#include "threadpool.h"
+#include "cache.h"
+#include "stats.h"
+#include "interp.h"
 
+static void PrintUsage()
+{
+    printf("Correct Usage:   dcc [-outdir <dir>] [-j <jobs>] [-cache <dir>]"
+           " [-target mips|x86|c] [-O0] [<file> ...] [-d <debug-key-1> <debug-key-2> ...]\n"
+           "                 dcc -run [-O0] [<file>] [-d <debug-key-1> ...]\n");
+}
+
+static void IncorrectUse(int argc, char *argv[])
+{
+    printf("Incorrect Use:   ");
+    for (int i = 1; i < argc; i++) printf("%s ", argv[i]);
+    printf("\n");
+    PrintUsage();
+    exit(2);
+}
+
+/* Function: OutputPathFor()
+ * -------------------------
+ * Returns the path of the assembly file for the source file at path, which
+ * is the base name of the source with its extension swapped for .asm (or
+ * .s for x86, or .c for C), placed in outDir.
+ */
+static std::string OutputPathFor(const char *path, const char *outDir, Arch arch)
+{
+    const char *base = strrchr(path, '/');
+    base = (base ? base + 1 : path);
+    const char *dot = strrchr(base, '.');
+    std::string name(base, dot && dot != base ? dot - base : strlen(base));
+    static const char * const extension[] = { ".asm", ".s", ".c" };
+    return std::string(outDir) + "/" + name + extension[arch];
+}
+
+/* Function: CompileFile()
+ * -----------------------
+ * Compiles the source file at path into its assembly file. Returns the
+ * number of errors, counting a file we cannot open as one error. The
+ * assembly file is removed again if there were any errors so that a
+ * failed compile never leaves behind output that looks usable.
+ */
+static int CompileFile(const char *path, const char *outDir, ThreadPool *pool,
+                       CompileCache *cache, Arch arch, bool optimize)
+{
+    std::string outPath = OutputPathFor(path, outDir, arch);
+    FILE *in = fopen(path, "r");
+    if (!in) {
+        fprintf(stderr, "*** Cannot open input file %s\n", path);
+        return 1;
+    }
+    FILE *out = fopen(outPath.c_str(), "w");
+    if (!out) {
+        fprintf(stderr, "*** Cannot open output file %s\n", outPath.c_str());
+        fclose(in);
+        return 1;
+    }
+
+    CompilationContext context(path, in, out);
+    context.SetThreadPool(pool);
+    context.SetCache(cache);
+    context.SetArch(arch);
+    context.SetOptimize(optimize);
+    int numErrors = context.Compile();
+    fclose(in);
+    fclose(out);
+    if (numErrors > 0)
+        remove(outPath.c_str());
+    return numErrors;
+}
+
+/* Function: RunFile()
+ * --------------------
+ * Compiles the source file at path (or stdin, if path is NULL) and, if
+ * it has no errors, runs it on the interpreter rather than writing out
+ * any assembly. Returns the exit status of the program, or -1 if it
+ * could not be compiled. Everything is done on the calling thread, the
+ * interpreter takes the code in the order it is generated.
+ */
+static int RunFile(const char *path, bool optimize)
+{
+    FILE *in = (path != NULL ? fopen(path, "r") : stdin);
+    if (!in) {
+        fprintf(stderr, "*** Cannot open input file %s\n", path);
+        return -1;
+    }
+
+    Interpreter interp;
+    CompilationContext context(path, in, stdout);
+    context.SetInterpreter(&interp);
+    context.SetOptimize(optimize);
+    int numErrors = context.Compile();
+    if (path != NULL)
+        fclose(in);
+    if (numErrors > 0)
+        return -1;
+    return interp.Run();
+}
 
 /* Function: main()
  * ----------------
  * Entry point to the entire program.  We parse the command line and turn
  * on any debugging flags requested by the user when invoking the program.
- * InitScanner() is used to set up the scanner.
- * InitParser() is used to set up the parser. The call to yyparse() will
- * attempt to parse a complete program from the input. 
+ * InitParser() is used to set up the parser (once, for all inputs).
+ *
+ * With no file arguments, the program is read from stdin and the code is
+ * written to stdout. Otherwise this is a batch compile: each file named is
+ * compiled to <outdir>/<name>.asm. Every file is compiled even if some of
+ * them have errors.
+ *
+ * Up to -j threads (by default, one per processor) work on the files and
+ * on the functions within them at the same time. With -j 1, everything
+ * is done in order on the main thread.
+ *
+ * With -cache, the code for files and functions that were compiled before
+ * is taken from the given cache directory. The cache is not used if any
+ * debug flag (other than cache) is on, since those change what is printed.
+ *
+ * With -d timing and -d trace, the time taken by each part of the compile
+ * is reported, see stats.h.
+ *
+ * With -target x86, x86-64 assembly is written instead of MIPS, and with
+ * -target c, C source (see x86.h and csource.h for how to build an
+ * executable from them).
+ *
+ * With -run, the one file named (or stdin) is compiled and run right
+ * away on the Tac interpreter (see interp.h), and dcc exits with the
+ * program's status.
+ *
+ * With -O0, the Tac is not optimized (see optimizer.h).
  */
 int main(int argc, char *argv[])
 {
-    ParseCommandLine(argc, argv);
-    InitScanner();
+    int numArgs = ParseCommandLine(argc, argv);
+    const char *outDir = ".";
+    const char *cacheDir = NULL;
+    int numJobs = ThreadPool::DefaultNumThreads();
+    bool run = false;
+    bool optimize = true;
+    Arch arch = MipsArch;
+    List<const char*> files;
+
+    for (int i = 1; i < numArgs; i++) {
+        if (strcmp(argv[i], "-outdir") == 0 && i + 1 < numArgs)
+            outDir = argv[++i];
+        else if (strcmp(argv[i], "-j") == 0 && i + 1 < numArgs)
+            numJobs = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-cache") == 0 && i + 1 < numArgs)
+            cacheDir = argv[++i];
+        else if (strcmp(argv[i], "-target") == 0 && i + 1 < numArgs) {
+            const char *name = argv[++i];
+            if (strcmp(name, "x86") == 0)
+                arch = X86Arch;
+            else if (strcmp(name, "c") == 0)
+                arch = CArch;
+            else if (strcmp(name, "mips") != 0)
+                IncorrectUse(argc, argv);
+        } else if (strcmp(argv[i], "-run") == 0)
+            run = true;
+        else if (strcmp(argv[i], "-O0") == 0)
+            optimize = false;
+        else if (argv[i][0] == '-')
+            IncorrectUse(argc, argv);
+        else
+            files.Append(argv[i]);
+    }
+
+    for (int i = numArgs + 1; i < argc; i++)
+        if (strcmp(argv[i], "cache") != 0)
+            cacheDir = NULL;
+
+    // The options that change the code generated (-target and -O0) must
+    // be added to the cache flags, so that they are part of the keys
+    static const char * const flagsFor[] = { "", "-target x86", "-target c" };
+    std::string flags = std::string(flagsFor[arch]) + (optimize ? "" : " -O0");
+    CompileCache *cache = (cacheDir != NULL ? new CompileCache(cacheDir, flags.c_str()) : NULL);
+
     InitParser();
-    yyparse();
-    return (ReportError::NumErrors() == 0? 0 : -1);
-}
 
+    if (run) {
+        if (files.NumElements() > 1)
+            IncorrectUse(argc, argv);
+        int status = RunFile(files.NumElements() > 0 ? files.Nth(0) : NULL, optimize);
+        delete cache;
+        if (IsDebugOn("trace"))
+            TraceSpan::WriteTrace("dcc.trace.json");
+        return status;
+    }
+
+    // The main thread joins in whenever it waits on the pool, so the pool
+    // itself needs one thread less than we are allowed
+    ThreadPool *pool = (numJobs > 1 ? new ThreadPool(numJobs - 1) : NULL);
+    int numFailed = 0;
+
+    if (files.NumElements() == 0) {
+        CompilationContext context(NULL, stdin, stdout);
+        context.SetThreadPool(pool);
+        context.SetCache(cache);
+        context.SetArch(arch);
+        context.SetOptimize(optimize);
+        numFailed = (context.Compile() == 0? 0 : 1);
+    } else if (pool == NULL) {
+        for (int i = 0; i < files.NumElements(); i++)
+            if (CompileFile(files.Nth(i), outDir, NULL, cache, arch, optimize) > 0)
+                numFailed++;
+    } else {
+        std::atomic<int> failed(0);
+        for (int i = 0; i < files.NumElements(); i++) {
+            const char *path = files.Nth(i);
+            pool->Submit([path, outDir, pool, cache, arch, optimize, &failed]() {
+                if (CompileFile(path, outDir, pool, cache, arch, optimize) > 0)
+                    failed++;
+            });
+        }
+        pool->Wait();
+        numFailed = failed;
+    }
+
+    delete pool;
+    delete cache;
+    if (IsDebugOn("trace"))
+        TraceSpan::WriteTrace("dcc.trace.json");
+    return (numFailed == 0? 0 : -1);
+}
@@ -15,6 +15,21 @@
 #include "mips.h"
 #include <stdarg.h>
 #include <string.h>
+#include <algorithm>
+#include "stats.h"
+
+// The runtime routines, which take their arguments on the stack
+static const char * const builtinLabels[] =
+  {"_Alloc", "_ReadLine", "_ReadInteger", "_StringEqual",
+   "_PrintInt", "_PrintString", "_PrintBool", "_Halt", NULL};
+
+static bool IsBuiltin(const char *label)
+{
+  for (int i = 0; builtinLabels[i] != NULL; i++)
+    if (strcmp(label, builtinLabels[i]) == 0)
+      return true;
+  return false;
+}
 
 /* Method: GetRegister
  * -------------------
@@ -54,10 +69,14 @@ Mips::Register Mips::GetRegister(Location *var, Reason reason,
 	     var->GetOffset(), offsetFromWhere, var->GetName(),
 	     offsetFromWhere, var->GetOffset(), regs[reg].name);
 	regs[reg].isDirty = false;
+	regs[reg].isConstant = false;
     }
   }
-  if (reason == ForWrite)
-    regs[reg].isDirty = true;
+  if (reason == ForWrite) {
+    regs[reg].isDirty = !regs[reg].isSaved;  // it has no other home
+    regs[reg].isConstant = false;
+  }
+  regs[reg].lastUse = ++useClock;
   return reg;
 }
 
@@ -88,15 +107,52 @@ static bool LocationsAreSame(Location *var1, Location *var2)
 }
 
 
+/* Method: ArgIndex
+ * ----------------
+ * Returns k if var is the parameter passed in $ak, else -1.
+ */
+int Mips::ArgIndex(Location *var)
+{
+  if (var == NULL || var->GetSegment() != fpRelative)
+    return -1;
+  int k = (var->GetOffset() - 4) / 4;      // the first param is at fp+4
+  return var->GetOffset() >= 4 && k < NumArgRegs ? k : -1;
+}
+
+
 /* Method: FindRegisterWithContents
  * --------------------------------
  * Searches the descriptors for one with contents var. Assigns
  * register by reference, and returns true/false on whether match found.
+ * A parameter still held in the $a register it was passed in is slaved
+ * to that register from then on, like any other variable (and the
+ * register is used like any other once the parameter leaves it). The
+ * variables kept in $s registers are always found in them. An empty
+ * register (var NULL) is looked for among the $s registers the function
+ * would have to save last, since it saves each one it uses.
  */
 bool Mips::FindRegisterWithContents(Location *var, Register& reg)
 {
+  int k = ArgIndex(var);
+  if (k >= 0) {
+    args[k].isUsed = true;
+    if (args[k].isHeld) {
+      reg = Register(a0 + k);
+      regs[reg].var = var;
+      regs[reg].isDirty = args[k].isDirty;
+      regs[reg].isGeneralPurpose = true;
+      regs[reg].isConstant = false;
+      args[k].isHeld = false;
+      return true;
+    }
+  }
   for (reg = zero; reg < NumRegs; reg = Register(reg+1))
-    if (regs[reg].isGeneralPurpose && LocationsAreSame(var, regs[reg].var))
+    if ((regs[reg].isGeneralPurpose || regs[reg].isSaved) &&
+	LocationsAreSame(var, regs[reg].var) &&
+	(var || reg < s0 || reg >= s0 + numSaved))
+	return true;
+  for (reg = s0; var == NULL && reg < s0 + numSaved; reg = Register(reg+1))
+    if (regs[reg].isGeneralPurpose && regs[reg].var == NULL)
 	return true;
   return false;
 }
@@ -104,29 +160,21 @@ bool Mips::FindRegisterWithContents(Location *var, Register& reg)
 
 /* Method: SelectRegisterToSpill
  * -----------------------------
- * Chooses an in-use register to replace with a new variable. We
- * prefer to replace a non-dirty once since we would not have to
- * write its contents back to memory, so the first loop searches
- * for a clean one. If none found, we take a dirty one.  In both
- * loops we deliberately won't choose either of the registers we
- * were asked to avoid.  We track the last dirty register spilled
- * and advance on each subsequent spill as a primitive means of
- * trying to not throw out things we just loaded and thus are likely
- * to need.
+ * Chooses an in-use register to replace with a new variable. We take
+ * the one handed out least recently (see useClock), dirty or not, since
+ * what was just loaded or computed is the likeliest to be needed again,
+ * and reloading it costs more than writing back one that is done with.
+ * We deliberately won't choose either of the registers we were asked
+ * to avoid.
  */
 Mips::Register Mips::SelectRegisterToSpill(Register avoid1, Register avoid2)
 {
-            // first hunt for a non-dirty one, since no work to spill
-  for (Register i = zero; i < NumRegs; i = (Register)(i+1)) {
+  Register best = NumRegs;
+  for (Register i = zero; i < NumRegs; i = (Register)(i+1))
     if (i != avoid1 && i != avoid2 && regs[i].isGeneralPurpose &&
-	  !regs[i].isDirty)
-	return i;
-  }
-  do {      // otherwise just pick the next usuable register
-    lastUsed = (Register)((lastUsed + 1) % NumRegs);
-  } while (lastUsed == avoid1 || lastUsed == avoid2 ||
-           !regs[lastUsed].isGeneralPurpose);
-  return lastUsed;
+	(best == NumRegs || regs[i].lastUse < regs[best].lastUse))
+      best = i;
+  return best;
 }
 
 
@@ -139,6 +187,8 @@ Mips::Register Mips::SelectRegisterToSpill(Register avoid1, Register avoid2)
  */
 void Mips::SpillRegister(Register reg)
 {
+  if (regs[reg].isSaved)      // the register is the var's home
+    return;
   Location *var = regs[reg].var;
   if (var && regs[reg].isDirty) {
     const char *offsetFromWhere = var->GetSegment() == fpRelative? regs[fp].name : regs[gp].name;
@@ -146,6 +196,7 @@ void Mips::SpillRegister(Register reg)
     Emit("sw %s, %d(%s)\t# spill %s from %s to %s%+d", regs[reg].name,
 	   var->GetOffset(), offsetFromWhere, var->GetName(), regs[reg].name,
 	   offsetFromWhere,var->GetOffset());
+    Stats::Count(Stats::Spills);
   }
   regs[reg].var = NULL;
 }       
@@ -164,8 +215,62 @@ void Mips::SpillAllDirtyRegisters()
     if (regs[i].var && regs[i].isDirty) break;
   if (i != NumRegs) // none are dirty, don't print message to avoid confusion
     Emit("# (save modified registers before flow of control change)");
-  for (i = zero; i < NumRegs; i = Register(i+1)) 
+  for (i = zero; i < NumRegs; i = Register(i+1)) {
     SpillRegister(i);
+    if (regs[i].isSaved)      // may be reached with another value
+      regs[i].isConstant = false;
+  }
+  StoreArgs(false);
+}
+
+
+/* Method: SaveDirtyRegisters
+ * ---------------------------
+ * Used before a conditional branch. The dirty registers are written back
+ * as above, since the code branched to starts out with nothing in the
+ * registers, but they keep their contents for the code that follows
+ * when the branch isn't taken, which need not load them again.
+ */
+void Mips::SaveDirtyRegisters()
+{
+  Register i;
+  for (i = zero; i < NumRegs; i = Register(i+1)) 
+    if (regs[i].var && regs[i].isDirty) break;
+  if (i != NumRegs)
+    Emit("# (save modified registers before flow of control change)");
+  for (i = zero; i < NumRegs; i = Register(i+1)) {
+    Location *var = regs[i].var;
+    if (var && regs[i].isDirty) {
+      SpillRegister(i);
+      regs[i].var = var;
+      regs[i].isDirty = false;
+    }
+  }
+  StoreArgs(true);
+}
+
+
+/* Method: StoreArgs
+ * -----------------
+ * Writes the parameters still held in the $a registers they were passed
+ * in to their places on the stack, if they have changed, along with the
+ * other variables. Those writes are made whether or not the parameters
+ * are used later on (which isn't known yet), and dropped by
+ * EmitEndFunction for the parameters that never are, which may not even
+ * have been passed. The registers keep the parameters if keepHeld is set.
+ */
+void Mips::StoreArgs(bool keepHeld)
+{
+  for (int k = 0; k < NumArgRegs; k++) {
+    if (args[k].isHeld && args[k].isDirty) {
+      args[k].stores.push_back(lines.size());
+      Emit("sw %s, %d($fp)\t# write param passed in %s to its place",
+	   regs[a0 + k].name, 4 + 4 * k, regs[a0 + k].name);
+      args[k].isDirty = false;
+    }
+    if (!keepHeld)
+      args[k].isHeld = false;
+  }
 }
 
 
@@ -190,11 +295,23 @@ void Mips::SpillForEndFunction()
 }
 
 
+// Removes the white space from both ends of s
+static void Trim(std::string &s)
+{
+  size_t start = s.find_first_not_of(" \t\n");
+  if (start == std::string::npos)
+    s.clear();
+  else
+    s = s.substr(start, s.find_last_not_of(" \t\n") + 1 - start);
+}
+
 /* Method: Emit
  * ------------
  * General purpose helper used to emit assembly instructions in
  * a reasonable tidy manner.  Takes printf-style formatting strings
- * and variable arguments.
+ * and variable arguments. The line is added to lines, split into
+ * its opcode and operands (or the label it defines), until FlushLines
+ * writes it out.
  */
 void Mips::Emit(const char *fmt, ...)
 {
@@ -204,10 +321,51 @@ void Mips::Emit(const char *fmt, ...)
   va_start(args, fmt);
   vsprintf(buf, fmt, args);
   va_end(args);
-  if (buf[strlen(buf) - 1] != ':') printf("\t"); // don't tab in labels
-  if (buf[0] != '#') printf("  ");   // outdent comments a little
-  printf("%s", buf);
-  if (buf[strlen(buf)-1] != '\n') printf("\n"); // end with a newline
+
+  AsmLine line;
+  line.text = buf;
+  std::string code(buf, strcspn(buf, "#"));  // less the comment
+  Trim(code);
+  if (code.empty() || code[0] == '.') {
+    // a comment or a directive
+  } else if (code[code.size() - 1] == ':') {
+    line.label = code.substr(0, code.size() - 1);
+  } else if (code.find(':') == std::string::npos) {
+    size_t end = code.find_first_of(" \t");
+    line.op = code.substr(0, end);
+    while (end != std::string::npos) {
+      size_t start = end + 1;
+      end = code.find(',', start);
+      line.args.push_back(code.substr(start, end == std::string::npos ?
+                                      end : end - start));
+      Trim(line.args.back());
+    }
+  }
+  lines.push_back(line);
+}
+
+/* Method: FlushLines
+ * ------------------
+ * Writes out the lines emitted so far (but those the peephole pass
+ * removed) and clears them.
+ */
+void Mips::FlushLines()
+{
+  for (size_t i = 0; i < lines.size(); i++) {
+    const char *buf = lines[i].text.c_str();
+    if (*buf == '\0')
+      continue;
+    if (buf[strlen(buf) - 1] != ':') fprintf(out, "\t"); // don't tab in labels
+    if (buf[0] != '#') fprintf(out, "  ");   // outdent comments a little
+    fprintf(out, "%s", buf);
+    if (buf[strlen(buf)-1] != '\n') fprintf(out, "\n"); // end with a newline
+  }
+  lines.clear();
+}
+
+void Mips::EmitComment(const char *text)
+{
+  Emit("# %s", text);
 }
 
 
@@ -223,20 +381,19 @@ void Mips::EmitLoadConstant(Location *dst, int val)
   Register reg = GetRegisterForWrite(dst);
   Emit("li %s, %d\t\t# load constant value %d into %s", regs[reg].name,
 	 val, val, regs[reg].name);
+  regs[reg].isConstant = true;
+  regs[reg].constant = val;
 }
 
 /* Method: EmitLoadStringConstant
  * ------------------------------
  * Used to assign a variable a pointer to string constant. Emits
  * assembly directives to create a new null-terminated string in the
- * data segment and assigns it a unique label. Slaves dst into a register
- * and loads that label address into the register.
+ * data segment and marks it with the given (unique) label. Slaves dst into
+ * a register and loads that label address into the register.
  */
-void Mips::EmitLoadStringConstant(Location *dst, const char *str)
+void Mips::EmitLoadStringConstant(Location *dst, const char *label, const char *str)
 {
-  static int strNum = 1;
-  char label[16];
-  sprintf(label, "_string%d", strNum++);
   Emit(".data\t\t\t# create string constant marked with label");
   Emit("%s: .asciiz %s", label, str);
   Emit(".text");
@@ -258,15 +415,33 @@ void Mips::EmitLoadLabel(Location *dst, const char *label)
 
 /* Method: EmitCopy
  * ----------------
- * Used to copy the value of one variable to another.  Slaves both
- * src and dst into registers and then emits a move instruction to
- * copy the contents from src to dst.
+ * Used to copy the value of one variable to another. Rather than moving
+ * the value to a register of its own, the register src is slaved to is
+ * handed over to dst (after writing src back to memory, if it was dirty,
+ * since it may be read again), so that the copy usually costs nothing.
+ * A constant the register is known to hold goes along with it. A
+ * variable kept in an $s register stays there, though, so a copy to
+ * or from one is a move.
  */
 void Mips::EmitCopy(Location *dst, Location *src)
 {
-  Register rSrc = GetRegister(src), rDst = GetRegisterForWrite(dst, rSrc);
-  Emit("move %s, %s\t\t# copy value", regs[rDst].name, regs[rSrc].name);
-
+  if (LocationsAreSame(dst, src))
+    return;
+  Register rSrc = GetRegister(src), rDst;
+  bool found = FindRegisterWithContents(dst, rDst);
+  if (regs[rSrc].isSaved || (found && regs[rDst].isSaved)) {
+    rDst = GetRegisterForWrite(dst, rSrc);
+    Emit("move %s, %s\t\t# copy %s to %s", regs[rDst].name, regs[rSrc].name,
+	 src->GetName(), dst->GetName());
+    regs[rDst].isConstant = regs[rSrc].isConstant;
+    regs[rDst].constant = regs[rSrc].constant;
+    return;
+  }
+  if (found)
+    regs[rDst].var = NULL;    // its value is about to be replaced
+  SpillRegister(rSrc);
+  regs[rSrc].var = dst;
+  regs[rSrc].isDirty = true;
 }
 
 
@@ -308,12 +483,22 @@ void Mips::EmitStore(Location *reference, Location *value, int offset)
  * in dst. All binary forms for arithmetic, logical, relational, equality
  * use this method. Slaves both operands and dst to registers, then
  * emits the appropriate instruction by looking up the mips name
- * for the particular op code.
+ * for the particular op code. A multiply, divide or remainder by a
+ * constant loaded earlier in the block is done without the HI/LO
+ * unit where it can be (see EmitByConstant below).
  */
 void Mips::EmitBinaryOp(BinaryOp::OpCode code, Location *dst, 
 				 Location *op1, Location *op2)
 {
   Register rLeft = GetRegister(op1), rRight = GetRegister(op2, rLeft);
+  if (code == BinaryOp::Mul || code == BinaryOp::Div ||
+      code == BinaryOp::Mod) {
+    if (regs[rRight].isConstant && EmitByConstant(code, dst, rLeft, rRight))
+      return;
+    if (code == BinaryOp::Mul && regs[rLeft].isConstant &&
+	EmitByConstant(code, dst, rRight, rLeft))
+      return;
+  }
   Register rDst = GetRegisterForWrite(dst, rLeft, rRight);
   Emit("%s %s, %s, %s\t", NameForTac(code), regs[rDst].name,
 	 regs[rLeft].name, regs[rRight].name);
@@ -321,6 +506,173 @@ void Mips::EmitBinaryOp(BinaryOp::OpCode code, Location *dst,
 }
 
 
+// Returns k if c is 2 to the k, else -1
+static int Log2(unsigned c)
+{
+  if (c == 0 || (c & (c - 1)) != 0)
+    return -1;
+  int k = 0;
+  while (c >>= 1)
+    k++;
+  return k;
+}
+
+// Finds a > b such that c is 2^a + 2^b, or 2^a - 2^b if isSub is set
+static bool SplitConstant(unsigned c, int *a, int *b, bool *isSub)
+{
+  unsigned low = c & (0u - c);             // its lowest bit
+  *b = Log2(low);
+  *isSub = (Log2(c - low) < 0);
+  *a = Log2(*isSub ? c + low : c - low);
+  return *a >= 0;
+}
+
+/* Function: FindMagic
+ * -------------------
+ * Finds the multiplier m and shift s for a signed division by d (|d| >= 2),
+ * such that x / d is the high word of m * x (plus x if d > 0 and m < 0,
+ * less x if d < 0 and m > 0) shifted right by s, plus one if that is
+ * negative. See Warren, Hacker's Delight, section 10-4.
+ */
+static void FindMagic(int d, int *m, int *s)
+{
+  const unsigned two31 = 0x80000000u;
+  unsigned ad = d < 0 ? 0u - (unsigned)d : (unsigned)d;
+  unsigned t = two31 + ((unsigned)d >> 31);
+  unsigned anc = t - 1 - t % ad;           // |nc|
+  unsigned q1 = two31 / anc, r1 = two31 - q1 * anc;
+  unsigned q2 = two31 / ad, r2 = two31 - q2 * ad, delta;
+  int p = 31;
+  do {
+    p++;
+    q1 *= 2; r1 *= 2;
+    if (r1 >= anc) { q1++; r1 -= anc; }
+    q2 *= 2; r2 *= 2;
+    if (r2 >= ad) { q2++; r2 -= ad; }
+    delta = ad - r2;
+  } while (q1 < delta || (q1 == delta && r1 == 0));
+  *m = (int)(q2 + 1);
+  if (d < 0)
+    *m = -*m;
+  *s = p - 32;
+}
+
+/* Method: EmitByConstant
+ * ----------------------
+ * Emits dst = src * c, src / c or src % c, where c is the constant in
+ * rConst, using shifts and adds, or the high word of a multiply by the
+ * reciprocal of c, instead of the mul, div and rem that SPIM turns into
+ * multi-cycle HI/LO sequences (and div and rem into a test for zero as
+ * well). The results are those of the signed operations, rounding toward
+ * zero. Returns false, having emitted nothing, for a multiply that takes
+ * more than two shifts, and for a divisor of zero, which has to trap.
+ * $v1 and $v0 are used as scratch registers.
+ */
+bool Mips::EmitByConstant(BinaryOp::OpCode code, Location *dst,
+			  Register rSrc, Register rConst)
+{
+  int c = regs[rConst].constant, k, a, b;
+  unsigned mag = c < 0 ? 0u - (unsigned)c : (unsigned)c;
+  bool isSub = false;
+  k = Log2(mag);
+  if (code == BinaryOp::Mul && c != 0 && k < 0 &&
+      !SplitConstant(mag, &a, &b, &isSub))
+    return false;
+  if (code != BinaryOp::Mul && c == 0)
+    return false;
+
+  Register rDst = GetRegisterForWrite(dst, rSrc, rConst);
+  const char *d = regs[rDst].name, *x = regs[rSrc].name;
+  switch (code) {
+    case BinaryOp::Mul:
+      if (c == 0) {
+	Emit("li %s, 0\t\t# %s * 0", d, x);
+	return true;
+      } else if (mag == 1) {
+	Emit("%s %s, %s\t\t# %s * %d", c < 0 ? "negu" : "move", d, x, x, c);
+	return true;
+      } else if (k >= 0) {
+	Emit("sll %s, %s, %d\t# %s * %d by shifting", d, x, k, x, c);
+      } else {
+	Emit("sll $v1, %s, %d\t# %s * %d by shifting and adding", x, a, x, c);
+	if (b != 0)
+	  Emit("sll %s, %s, %d", d, x, b);
+	Emit("%s %s, $v1, %s", isSub ? "subu" : "addu", d, b != 0 ? d : x);
+      }
+      if (c < 0)
+	Emit("negu %s, %s", d, d);
+      return true;
+    case BinaryOp::Div:
+      EmitDivByConstant(rDst, rSrc, c);
+      return true;
+    default:
+      if (mag == 1) {
+	Emit("li %s, 0\t\t# %s %% %d", d, x, c);
+	return true;
+      }
+      if (k >= 0) {                  // x - (x / 2^k) * 2^k, whatever c's sign
+	EmitDivByPowerOfTwo(v1, rSrc, k);
+	Emit("sll $v1, $v1, %d", k);
+      } else {
+	EmitDivByConstant(v1, rSrc, c);
+	Emit("mul $v1, $v1, %s", regs[rConst].name);
+      }
+      Emit("subu %s, %s, $v1\t# %s %% %d", d, x, x, c);
+      return true;
+  }
+}
+
+/* Method: EmitDivByPowerOfTwo
+ * ---------------------------
+ * Emits rDst = rSrc / 2^k for 1 <= k <= 31. An arithmetic shift rounds
+ * down, so 2^k - 1 is added to a negative dividend first.
+ */
+void Mips::EmitDivByPowerOfTwo(Register rDst, Register rSrc, int k)
+{
+  const char *d = regs[rDst].name, *x = regs[rSrc].name;
+  if (k == 1) {
+    Emit("srl $v1, %s, 31\t# %s / 2 by shifting", x, x);
+  } else {
+    Emit("sra $v1, %s, 31\t# %s / %u by shifting", x, x, 1u << k);
+    Emit("srl $v1, $v1, %d", 32 - k);
+  }
+  Emit("addu $v1, %s, $v1", x);
+  Emit("sra %s, $v1, %d", d, k);
+}
+
+/* Method: EmitDivByConstant
+ * -------------------------
+ * Emits rDst = rSrc / c for a nonzero c, leaving rSrc as it was until
+ * rDst is written (so rDst may be $v1).
+ */
+void Mips::EmitDivByConstant(Register rDst, Register rSrc, int c)
+{
+  const char *d = regs[rDst].name, *x = regs[rSrc].name;
+  unsigned mag = c < 0 ? 0u - (unsigned)c : (unsigned)c;
+  int k = Log2(mag), m, s;
+  if (mag == 1) {
+    Emit("%s %s, %s\t\t# %s / %d", c < 0 ? "negu" : "move", d, x, x, c);
+  } else if (k >= 0) {
+    EmitDivByPowerOfTwo(rDst, rSrc, k);
+    if (c < 0)
+      Emit("negu %s, %s", d, d);
+  } else {
+    FindMagic(c, &m, &s);
+    Emit("li $v1, %d\t# %s / %d by multiplying by its reciprocal", m, x, c);
+    Emit("mult %s, $v1", x);
+    Emit("mfhi $v1");
+    if (c > 0 && m < 0)
+      Emit("addu $v1, $v1, %s", x);
+    else if (c < 0 && m > 0)
+      Emit("subu $v1, $v1, %s", x);
+    if (s != 0)
+      Emit("sra $v1, $v1, %d", s);
+    Emit("srl $v0, $v1, 31\t# round a negative quotient toward zero");
+    Emit("addu %s, $v1, $v0", d);
+  }
+}
+
+
 /* Method: EmitLabel
  * -----------------
  * Used to emit label marker. Before a label, we spill all registers since
@@ -353,47 +705,76 @@ void Mips::EmitGoto(const char *label)
  * ---------------
  * Used for a conditional branch based on value of test variable.
  * We slave test var to register and use in the emitted test instruction,
- * either beqz. See comments above on Goto for why we spill
- * all registers here.
+ * either beqz, or bnez for EmitIfNZ. See comments above on Goto for why we
+ * write back all the registers here; they are kept for the code that
+ * falls through, though (see SaveDirtyRegisters).
  */
 void Mips::EmitIfZ(Location *test, const char *label)
 { 
   Register testReg = GetRegister(test);
-  SpillAllDirtyRegisters();
+  SaveDirtyRegisters();
   Emit("beqz %s, %s\t# branch if %s is zero ", regs[testReg].name, label,
 	 test->GetName());
 }
 
+void Mips::EmitIfNZ(Location *test, const char *label)
+{ 
+  Register testReg = GetRegister(test);
+  SaveDirtyRegisters();
+  Emit("bnez %s, %s\t# branch if %s is not zero ", regs[testReg].name, label,
+	 test->GetName());
+}
+
 
 /* Method: EmitParam
  * -----------------
- * Used to push a parameter on the stack in anticipation of upcoming
- * function call. Decrements the stack pointer by 4. Slaves argument into
- * register and then stores contents to location just made at end of
- * stack.
+ * Used to push a parameter in anticipation of upcoming function call.
+ * The parameters are pushed last to first, but not always right before
+ * the call: a method's receiver is worked out after its arguments are
+ * pushed, and that may take calls of its own. Which of them goes in a
+ * register is only known once the call takes them, so they are just
+ * noted here and passed by PassParams.
  */
 void Mips::EmitParam(Location *arg)
 { 
-  Emit("subu $sp, $sp, 4\t# decrement sp to make space for param");
-  Register reg = GetRegister(arg);
-  Emit("sw %s, 4($sp)\t# copy param value to stack", regs[reg].name);
+  params.push_back(arg);
 }
 
 
 /* Method: EmitCallInstr
  * ---------------------
  * Used to effect a function call. All necessary arguments should have
- * already been pushed on the stack, this is the last step that
+ * already been pushed (see EmitParam), this is the last step that
  * transfers control from caller to callee.  See comments on Goto method
- * above for why we spill all registers before making the jump. We issue
- * jal for a label, a jalr if address in register. Both will save the
- * return address in $ra. If there is an expected result passed, we slave
- * the var to a register and copy function return value from $v0 into that
- * register.  
+ * above for why we spill all registers before making the jump. How many
+ * of the params pushed the call takes is only known from the PopParams
+ * that follows it, so they are passed then (see PassParams), by code put
+ * in ahead of the jump; the register each param is in, if any, is noted
+ * here, since spilling leaves it as it was. We issue jal for a label, a
+ * jalr if address in register (moved out of the way if it is an $a
+ * register, which the params may go in). Both will save the return
+ * address in $ra. If there is an expected result passed, we slave the
+ * var to a register and copy function return value from $v0 into that
+ * register.
  */
 void Mips::EmitCallInstr(Location *result, const char *fn, bool isLabel)
 {
+  callPending = false;        // the last call took no params
+  paramRegs.assign(params.size(), zero);     // zero if not in a register
+  for (size_t i = 0; i < params.size(); i++) {
+    Register r;
+    if (FindRegisterWithContents(params[i], r))
+      paramRegs[i] = r;
+  }
+  if (!isLabel && strncmp(fn, "$a", 2) == 0) {
+    Emit("move $v0, %s\t\t# keep function address out of the way", fn);
+    fn = regs[v0].name;
+  }
+
   SpillAllDirtyRegisters();
+  callPending = true;
+  callLine = lines.size();
+  callIsBuiltin = isLabel && IsBuiltin(fn);
   Emit("%s %-15s\t# jump to function", isLabel? "jal": "jalr", fn);
   if (result != NULL) {
     Register r1 = GetRegisterForWrite(result);
@@ -401,6 +782,52 @@ void Mips::EmitCallInstr(Location *result, const char *fn, bool isLabel)
   }
 }
 
+/* Method: PassParams
+ * ------------------
+ * Passes the last n params pushed to the call just made, with code put
+ * in ahead of its jump. The stack pointer is decremented once to make
+ * space for all of them, the first four of which (unless calling a
+ * runtime routine) are passed in $a0-$a3 and the rest copied to the
+ * stack, the first nearest the top. Each is taken from the register it
+ * was in at the call, if any; but an $a register may be overwritten by
+ * then, so a param in one of those is loaded from memory instead.
+ */
+void Mips::PassParams(int n)
+{
+  if (!callPending)
+    return;
+  callPending = false;
+  Assert(n <= (int)params.size());
+  size_t end = lines.size();
+  int first = params.size() - 1;     // params[first - i] is param i
+  int numInRegs = callIsBuiltin ? 0 : n < NumArgRegs ? n : NumArgRegs;
+  if (n > 0)
+    Emit("subu $sp, $sp, %d\t# decrement sp to make space for params", 4 * n);
+  for (int i = n - 1; i >= 0; i--) {
+    Location *arg = params[first - i];
+    Register reg = i < numInRegs ? Register(a0 + i) : v1,
+	     from = paramRegs[first - i];
+    if (from >= a0 && from <= a3 && from != a0 + i && i < numInRegs)
+      from = zero;
+    if (from == zero) {
+      const char *offsetFromWhere = arg->GetSegment() == fpRelative? regs[fp].name : regs[gp].name;
+      Emit("lw %s, %d(%s)\t# load %s from %s%+d into %s", regs[reg].name,
+	   arg->GetOffset(), offsetFromWhere, arg->GetName(),
+	   offsetFromWhere, arg->GetOffset(), regs[reg].name);
+    } else if (i >= numInRegs) {
+      reg = from;
+    } else if (from != reg) {
+      Emit("move %s, %s\t\t# pass param in %s", regs[reg].name,
+	   regs[from].name, regs[reg].name);
+    }
+    if (i >= numInRegs)
+      Emit("sw %s, %d($sp)\t# copy param value to stack", regs[reg].name,
+	   4 + 4 * i);
+  }
+  params.resize(params.size() - n);
+  std::rotate(lines.begin() + callLine, lines.begin() + end, lines.end());
+}
+
 
 // Two covers for the above method for specific LCall/ACall variants
 void Mips::EmitLCall(Location *dst, const char *label)
@@ -415,10 +842,12 @@ void Mips::EmitACall(Location *dst, Location *fn)
 
 /*
  * We remove all parameters from the stack after a completed call
- * by adjusting the stack pointer upwards.
+ * by adjusting the stack pointer upwards. The number of bytes popped
+ * tells how many params the call took, so they are passed now.
  */
 void Mips::EmitPopParams(int bytes)
 {
+  PassParams(bytes / 4);
   if (bytes != 0)
     Emit("add $sp, $sp, %d\t# pop params off stack", bytes);
 }
@@ -445,6 +874,9 @@ void Mips::EmitPopParams(int bytes)
     Emit("move $v0, %s\t\t# assign return value into $v0",
 	   regs[GetRegister(returnVal)].name);
   SpillForEndFunction();
+  AsmLine restore;            // the $s registers used, see EmitEndFunction
+  restore.kind = AsmLine::RestoreRegs;
+  lines.push_back(restore);
   Emit("move $sp, $fp\t\t# pop callee frame off stack");
   Emit("lw $ra, -4($fp)\t# restore saved ra");
   Emit("lw $fp, 0($fp)\t# restore saved fp");
@@ -458,7 +890,9 @@ void Mips::EmitPopParams(int bytes)
  * upon entering a new function. We decrement the $sp to make space
  * and then save the current values of $fp and $ra (since we are
  * going to change them), then set up the $fp and bump the $sp down
- * to make space for all our locals/temps.
+ * to make space for all our locals/temps (and the $s registers the
+ * function uses, which are only known at its end, see EmitEndFunction).
+ * The variables to keep across calls are then put in $s registers.
  */
 void Mips::EmitBeginFunction(int stackFrameSize)
 {
@@ -468,9 +902,54 @@ void Mips::EmitBeginFunction(int stackFrameSize)
   Emit("sw $ra, 4($sp)\t# save ra");
   Emit("addiu $fp, $sp, 8\t# set up new fp");
 
-  if (stackFrameSize != 0)
-    Emit("subu $sp, $sp, %d\t# decrement sp to make space for locals/temps",
-	   stackFrameSize);
+  frameSize = stackFrameSize;
+  AsmLine save;
+  save.kind = AsmLine::SaveRegs;
+  lines.push_back(save);
+
+  callPending = false;
+  for (int k = 0; k < NumArgRegs; k++) {   // the params passed in registers
+    regs[a0 + k].var = NULL;
+    regs[a0 + k].isGeneralPurpose = false;
+    args[k].isHeld = args[k].isDirty = true;
+    args[k].isUsed = false;
+    args[k].stores.clear();
+  }
+  for (int i = 0; i < NumSavedRegs; i++) {
+    Register reg = Register(s0 + i);
+    regs[reg].var = NULL;
+    regs[reg].isDirty = regs[reg].isConstant = regs[reg].isSaved = false;
+    regs[reg].isGeneralPurpose = true;
+  }
+  for (size_t i = 0; i < savedVars.size(); i++) {
+    Register reg = Register(s0 + i);
+    Location *var = savedVars[i];
+    int k = ArgIndex(var);
+    if (k >= 0) {
+      Emit("move %s, %s\t\t# keep %s in %s", regs[reg].name,
+	   regs[a0 + k].name, var->GetName(), regs[reg].name);
+      args[k].isHeld = false;
+    } else if (var->GetOffset() > 0) {   // a param passed on the stack
+      Emit("lw %s, %d(%s)\t# keep %s in %s", regs[reg].name,
+	   var->GetOffset(), regs[fp].name, var->GetName(), regs[reg].name);
+    }
+    regs[reg].var = var;
+    regs[reg].isSaved = true;
+    regs[reg].isGeneralPurpose = false;
+  }
+  savedVars.clear();
+}
+
+/* Method: KeepAcrossCalls
+ * -----------------------
+ * Notes the variables to keep in $s0, $s1, ... in the function about to
+ * begin (at most numSaved of them, so none unless keepVars was set).
+ */
+void Mips::KeepAcrossCalls(List<Location*> *vars)
+{
+  savedVars.clear();
+  for (int i = 0; i < vars->NumElements() && i < numSaved; i++)
+    savedVars.push_back(vars->Nth(i));
 }
 
 
@@ -478,12 +957,68 @@ void Mips::EmitBeginFunction(int stackFrameSize)
  * -----------------------
  * Used to end the body of a function. Does an implicit return in fall off
  * case to clean up stack frame, return to caller etc. See comments on
- * EmitReturn above.
+ * EmitReturn above. The writes of the parameters passed in registers that
+ * the function never uses are taken out (see StoreArgs), and the code of
+ * the function is then cleaned up by the peephole pass, if it is on, and
+ * written out.
  */
 void Mips::EmitEndFunction()
 { 
   Emit("# (below handles reaching end of fn body with no explicit return)");
   EmitReturn(NULL);
+  for (int k = 0; k < NumArgRegs; k++)
+    for (size_t i = 0; !args[k].isUsed && i < args[k].stores.size(); i++)
+      lines[args[k].stores[i]] = AsmLine();
+  if (peephole)
+    Peephole();
+  AddSavesAndRestores();
+  FlushLines();
+}
+
+/* Method: AddSavesAndRestores
+ * ---------------------------
+ * Now that the code of the function is done, replaces the marks left by
+ * EmitBeginFunction and EmitReturn with the code that makes space for
+ * the locals/temps and saves the first numSaved $s registers, those a
+ * caller may keep variables in, that the function uses (whether to keep
+ * variables or as any other register) below them, and the code that
+ * restores those registers before each return.
+ */
+void Mips::AddSavesAndRestores()
+{
+  std::vector<Register> used;
+  for (int i = 0; i < numSaved; i++) {
+    const char *name = regs[s0 + i].name;
+    bool isUsed = false;
+    for (size_t j = 0; j < lines.size() && !isUsed; j++)
+      for (size_t a = 0; a < lines[j].args.size() && !isUsed; a++)
+	isUsed = Uses(lines[j].args[a], name);
+    if (isUsed)
+      used.push_back(Register(s0 + i));
+  }
+
+  int offset = -8 - frameSize;        // just below the locals/temps
+  std::vector<AsmLine> code;
+  code.swap(lines);
+  for (size_t j = 0; j < code.size(); j++) {
+    if (code[j].kind == AsmLine::Plain) {
+      lines.push_back(code[j]);
+    } else if (code[j].kind == AsmLine::SaveRegs) {
+      if (used.empty() && frameSize != 0)
+	Emit("subu $sp, $sp, %d\t# decrement sp to make space for locals/temps",
+	     frameSize);
+      else if (!used.empty())
+	Emit("subu $sp, $sp, %d\t# decrement sp to make space for locals/temps"
+	     " and saved registers", frameSize + 4 * (int)used.size());
+      for (size_t i = 0; i < used.size(); i++)
+	Emit("sw %s, %d(%s)\t# save %s", regs[used[i]].name,
+	     offset - 4 * (int)i, regs[fp].name, regs[used[i]].name);
+    } else {
+      for (size_t i = 0; i < used.size(); i++)
+	Emit("lw %s, %d(%s)\t# restore %s", regs[used[i]].name,
+	     offset - 4 * (int)i, regs[fp].name, regs[used[i]].name);
+    }
+  }
 }
 
 
@@ -502,6 +1037,7 @@ void Mips::EmitVTable(const char *label, List<const char*> *methodLabels)
   for (int i = 0; i < methodLabels->NumElements(); i++)
     Emit(".word %s\n", methodLabels->Nth(i));
   Emit(".text");
+  FlushLines();
 }
 
 
@@ -517,6 +1053,7 @@ void Mips::EmitPreamble()
   Emit(".text");
   Emit(".align 2");
   Emit(".globl main");
+  FlushLines();
 }
 
 
@@ -536,19 +1073,10 @@ const char *Mips::NameForTac(BinaryOp::OpCode code)
 
 /* Constructor
  * ----------
- * Constructor sets up the mips names and register descriptors to
- * the initial starting state.
- */
-Mips::Mips() {
-  mipsName[BinaryOp::Add] = "add";
-  mipsName[BinaryOp::Sub] = "sub";
-  mipsName[BinaryOp::Mul] = "mul";
-  mipsName[BinaryOp::Div] = "div";
-  mipsName[BinaryOp::Mod] = "rem";
-  mipsName[BinaryOp::Eq] = "seq";
-  mipsName[BinaryOp::Less] = "slt";
-  mipsName[BinaryOp::And] = "and";
-  mipsName[BinaryOp::Or] = "or";
+ * Constructor sets up the register descriptors to the initial starting
+ * state. All of the assembly is written to out.
+ */
+Mips::Mips(FILE *o, bool p, bool keepVars) {
   regs[zero] = (RegContents){false, NULL, "$zero", false};
   regs[at] = (RegContents){false, NULL, "$at", false};
   regs[v0] = (RegContents){false, NULL, "$v0", false};
@@ -581,8 +1109,17 @@ Mips::Mips() {
   regs[s5] = (RegContents){false, NULL, "$s5", true};
   regs[s6] = (RegContents){false, NULL, "$s6", true};
   regs[s7] = (RegContents){false, NULL, "$s7", true};
-  lastUsed = zero;
+  for (int k = 0; k < NumArgRegs; k++)
+    args[k].isHeld = args[k].isDirty = args[k].isUsed = false;
+  useClock = 0;
+  numSaved = keepVars ? NumSavedRegs : 0;
+  out = o;
+  peephole = p;
+  callPending = false;
 }
-const char *Mips::mipsName[BinaryOp::NumOps];
+
+// The mips names for each BinaryOp::OpCode, in the order of the OpCode enum
+const char * const Mips::mipsName[BinaryOp::NumOps] =
+  {"add", "sub", "mul", "div", "rem", "seq", "slt", "and", "or"};
 
 
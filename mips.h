@@ -9,6 +9,22 @@
  * it does.  You will not need to modify this class unless
  * you're attempting some machine-specific optimizations. 
  *
+ * Calls from one Decaf function to another pass the first four words of
+ * arguments (this, then the actual arguments, for a method) in $a0-$a3,
+ * and the rest on the stack. The caller still makes room on the stack
+ * for all of them, where the callee's parameters live, as they always
+ * have (at 4($fp), 8($fp) and so on), but the callee only writes one
+ * passed in a register there if it must: until then, the parameter is
+ * used in place (see FindRegisterWithContents). The runtime routines
+ * (_Alloc, _PrintInt, etc.) come from SPIM's trap handler file, so they
+ * take their arguments on the stack as before.
+ *
+ * $s0-$s5 are callee-saved: a function saves those it uses on entry and
+ * restores them on return, so the variables kept in them (see
+ * KeepAcrossCalls) need not be written back to memory at a call. Without
+ * keepVars they, like $s6 and $s7 always, are scratch registers no
+ * function saves, since no function keeps anything in them.
+ *
  * It comments the emitted assembly but the commenting for the code
  * in the class itself is pretty sparse. The SPIM manual (see link
  * from other materials on our web site) has more detailed documentation
@@ -18,12 +34,16 @@
 #ifndef _H_mips
 #define _H_mips
 
+#include <stdio.h>
+#include <string>
+#include <vector>
 #include "tac.h"
 #include "list.h"
+#include "target.h"
 class Location;
 
 
-class Mips {
+class Mips : public Target {
   private:
     typedef enum {zero, at, v0, v1, a0, a1, a2, a3,
 			t0, t1, t2, t3, t4, t5, t6, t7,
@@ -35,9 +55,61 @@ class Mips {
 	Location *var;
 	const char *name;
 	bool isGeneralPurpose;
+	bool isConstant;        // holds a var just given a known value
+	int constant;
+	bool isSaved;           // keeps var for the whole function
+	long lastUse;           // when it was last handed out, see useClock
     } regs[NumRegs];
 
-    Register lastUsed;
+    long useClock;
+    FILE *out;
+
+    static const int NumArgRegs = 4;   // $a0-$a3
+    struct ArgContents {
+	bool isHeld;            // the parameter is still in the register
+	bool isDirty;           // and hasn't been written to its place
+	bool isUsed;            // the function refers to the parameter
+	std::vector<size_t> stores;    // the lines that write it there
+    } args[NumArgRegs];
+    std::vector<Location*> params;     // pushed for the calls to come
+    std::vector<Register> paramRegs;   // where they were at the last call
+    bool callPending;                  // its params are yet to be passed,
+    bool callIsBuiltin;                // ahead of lines[callLine]
+    size_t callLine;
+
+    static const int NumSavedRegs = 6; // $s0-$s5, $s6 and $s7 are scratch
+    int numSaved;                      // of them the functions save, if any
+    std::vector<Location*> savedVars;  // to keep in them, see KeepAcrossCalls
+    int frameSize;                     // of the function's locals/temps
+
+         // The assembly is kept, a line at a time, until the end of the
+         // function (or vtable), so that the peephole pass can go over
+         // it before it is written out (see peephole.cc)
+    struct AsmLine {
+	std::string text;              // as printed, less the indentation
+	std::string op;                // opcode, or "" if not an instruction
+	std::vector<std::string> args; // operands, e.g. $t0, -8($fp), _L3
+	std::string label;             // the label defined, if a label
+	enum { Plain, SaveRegs, RestoreRegs } kind;  // where the $s
+				       // registers used are saved, restored
+	AsmLine() : kind(Plain) {}
+    };
+    std::vector<AsmLine> lines;
+    bool peephole;
+
+    void FlushLines();
+    void AddSavesAndRestores();
+    static bool Uses(const std::string &arg, const std::string &reg);
+    void Peephole();
+    bool IsDead(const std::string &reg, size_t from);
+    size_t NextInstruction(size_t i);
+    void Rewrite(size_t i, const char *op, std::string arg1, std::string arg2,
+                 const std::string &comment);
+    bool RemoveStoreLoad(size_t i);
+    bool RemoveBranchToNext(size_t i);
+    bool RemoveSelfMove(size_t i);
+    bool RemoveBranchOver(size_t i);
+    bool RemoveConstantMove(size_t i);
 
     typedef enum { ForRead, ForWrite } Reason;
 
@@ -48,21 +120,33 @@ class Mips {
     Register SelectRegisterToSpill(Register avoid1, Register avoid2);
     void SpillRegister(Register reg);
     void SpillAllDirtyRegisters();
+    void SaveDirtyRegisters();
     void SpillForEndFunction();
+    int ArgIndex(Location *var);
+    void StoreArgs(bool keepHeld);
 
     void EmitCallInstr(Location *dst, const char *fn, bool isL);
+    void PassParams(int n);
+    bool EmitByConstant(BinaryOp::OpCode code, Location *dst, Register rSrc,
+			Register rConst);
+    void EmitDivByPowerOfTwo(Register rDst, Register rSrc, int k);
+    void EmitDivByConstant(Register rDst, Register rSrc, int c);
     
-    static const char *mipsName[BinaryOp::NumOps];
+    static const char * const mipsName[BinaryOp::NumOps];
     static const char *NameForTac(BinaryOp::OpCode code);
 
  public:
     
-    Mips();
+         // The peephole pass is run on each function if peephole is set.
+         // Unless keepVars is set too, no function keeps variables in
+         // the $s registers, so none has to save them
+    Mips(FILE *out, bool peephole = false, bool keepVars = false);
 
-    static void Emit(const char *fmt, ...);
+    void Emit(const char *fmt, ...);
+    void EmitComment(const char *text);
     
     void EmitLoadConstant(Location *dst, int val);
-    void EmitLoadStringConstant(Location *dst, const char *str);
+    void EmitLoadStringConstant(Location *dst, const char *label, const char *str);
     void EmitLoadLabel(Location *dst, const char *label);
 
     void EmitLoad(Location *dst, Location *reference, int offset);
@@ -75,8 +159,10 @@ class Mips {
     void EmitLabel(const char *label);
     void EmitGoto(const char *label);
     void EmitIfZ(Location *test, const char*label);
+    void EmitIfNZ(Location *test, const char*label);
     void EmitReturn(Location *returnVal);
     
+    void KeepAcrossCalls(List<Location*> *vars);
     void EmitBeginFunction(int frameSize);
     void EmitEndFunction();
 
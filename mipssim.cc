@@ -0,0 +1,839 @@
+/* File: mipssim.cc
+ * ----------------
+ * Implementation of the MipsSimulator class.
+ */
+
+#include "mipssim.h"
+#include "utility.h"
+#include <ctype.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+
+// The data segment starts below the user's data, where SPIM points $gp
+// (which is how dcc addresses the global variables)
+static const int DataSegment = 0x10000000;
+static const int GlobalPointer = 0x10008000;
+
+static const char *registerNames[32] =
+  {"zero", "at", "v0", "v1", "a0", "a1", "a2", "a3",
+   "t0", "t1", "t2", "t3", "t4", "t5", "t6", "t7",
+   "s0", "s1", "s2", "s3", "s4", "s5", "s6", "s7",
+   "t8", "t9", "k0", "k1", "gp", "sp", "fp", "ra"};
+
+enum { Zero = 0, V0 = 2, A0 = 4, A1 = 5, Gp = 28, Sp = 29, Fp = 30, Ra = 31 };
+
+const MipsSimulator::OpInfo MipsSimulator::opInfo[] = {
+    {"nop", Nop, NoOperands},       {"syscall", Syscall, NoOperands},
+    {"add", Add, Reg3},             {"addi", Add, Reg3},
+    {"addu", Addu, Reg3},           {"addiu", Addu, Reg3},
+    {"sub", Sub, Reg3},             {"subu", Subu, Reg3},
+    {"mul", Mul, Reg3},             {"div", Div, Reg3},
+    {"divu", Divu, Reg3},           {"rem", Rem, Reg3},
+    {"remu", Remu, Reg3},           {"and", And, Reg3},
+    {"andi", And, Reg3},            {"or", Or, Reg3},
+    {"ori", Or, Reg3},              {"xor", Xor, Reg3},
+    {"xori", Xor, Reg3},            {"nor", Nor, Reg3},
+    {"sll", Sll, Reg3},             {"sllv", Sll, Reg3},
+    {"srl", Srl, Reg3},             {"srlv", Srl, Reg3},
+    {"sra", Sra, Reg3},             {"srav", Sra, Reg3},
+    {"seq", Seq, Reg3},             {"sne", Sne, Reg3},
+    {"slt", Slt, Reg3},             {"slti", Slt, Reg3},
+    {"sltu", Sltu, Reg3},           {"sltiu", Sltu, Reg3},
+    {"sle", Sle, Reg3},             {"sgt", Sgt, Reg3},
+    {"sge", Sge, Reg3},             {"move", Move, Reg2},
+    {"neg", Neg, Reg2},             {"negu", Neg, Reg2},
+    {"not", Not, Reg2},             {"li", Li, RegImm},
+    {"la", La, RegLabel},           {"lw", Lw, Memory},
+    {"lb", Lb, Memory},             {"lbu", Lbu, Memory},
+    {"sw", Sw, Memory},             {"sb", Sb, Memory},
+    {"b", B, Label},                {"j", B, Label},
+    {"beqz", Beqz, RegBranch},      {"bnez", Bnez, RegBranch},
+    {"bltz", Bltz, RegBranch},      {"blez", Blez, RegBranch},
+    {"bgtz", Bgtz, RegBranch},      {"bgez", Bgez, RegBranch},
+    {"beq", Beq, Reg2Branch},       {"bne", Bne, Reg2Branch},
+    {"blt", Blt, Reg2Branch},       {"ble", Ble, Reg2Branch},
+    {"bgt", Bgt, Reg2Branch},       {"bge", Bge, Reg2Branch},
+    {"jal", Jal, Label},            {"jalr", Jalr, Reg1},
+    {"jr", Jr, Reg1},               {"mult", Mult, Src2},
+    {"mfhi", Mfhi, Dst1},           {"mflo", Mflo, Dst1},
+    {NULL, Nop, NoOperands}
+};
+
+// In the order DoBuiltin numbers them
+const char * const MipsSimulator::builtinNames[] =
+  {"_Alloc", "_ReadLine", "_ReadInteger", "_StringEqual", "_PrintInt",
+   "_PrintString", "_PrintBool", "_Halt", NULL};
+
+const char * const MipsSimulator::classNames[NumClasses] =
+  {"loads", "stores", "spill loads", "spill stores", "branches", "calls",
+   "returns", "syscalls", "builtin calls"};
+
+// Like SPIM's start-up code, which is what main returns to
+static const char *startup[] =
+  {"__start: jal main", "li $v0, 10", "syscall", NULL};
+
+MipsSimulator::MipsSimulator()
+  : fileName(NULL), numErrors(0), hi(0), lo(0), pc(0), halted(false),
+    failed(false), heapBase(0), heapTop(0), stackStart(StackTop - 4096 - 16),
+    stackLow(stackStart), stackSize(InitialStack),
+    numInstructions(0) {
+    for (int i = 0; i < 32; i++)
+        regs[i] = 0;
+    for (int i = 0; i < NumClasses; i++)
+        counts[i] = 0;
+}
+
+
+/* Method: Assemble
+ * ----------------
+ * Assembles the program in two passes. The first translates each line,
+ * recording the labels it defines and the uses of labels it contains;
+ * once all of the labels are known, the second fills in those uses. The
+ * builtins are defined as labels too (unless the program defines them
+ * itself), each with a single pseudo-instruction that runs it.
+ */
+bool MipsSimulator::Assemble(FILE *in, const char *name) {
+    fileName = name;
+    data.assign(DataBase - DataSegment, 0);
+    stack.assign(StackLimit, 0);
+
+    bool inText = true;
+    for (int i = 0; startup[i] != NULL; i++) {
+        char *line = strdup(startup[i]);
+        AssembleLine(line, 0, &inText);
+        free(line);
+    }
+
+    char *line = NULL;
+    size_t size = 0;
+    int lineNum = 0;
+    inText = true;
+    while (getline(&line, &size, in) != -1)
+        AssembleLine(line, ++lineNum, &inText);
+    free(line);
+
+    AddBuiltins();
+    ResolveFixups();
+
+    while (data.size() % 8 != 0)
+        data.push_back(0);
+    heapBase = heapTop = DataSegment + data.size();
+    return numErrors == 0;
+}
+
+void MipsSimulator::Error(int lineNum, const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    if (lineNum > 0)
+        fprintf(stderr, "*** %s, line %d: ", fileName, lineNum);
+    else
+        fprintf(stderr, "*** %s: ", fileName);
+    vfprintf(stderr, fmt, args);
+    fprintf(stderr, "\n");
+    va_end(args);
+    numErrors++;
+}
+
+static bool IsLabelChar(char c) {
+    return isalnum((unsigned char)c) || c == '_' || c == '.' || c == '$';
+}
+
+static char *SkipSpace(char *s) {
+    while (isspace((unsigned char)*s))
+        s++;
+    return s;
+}
+
+void MipsSimulator::AssembleLine(char *line, int lineNum, bool *inText) {
+    bool inString = false;
+    for (char *p = line; *p != '\0'; p++) {     // strip the comment
+        if (inString && *p == '\\' && p[1] != '\0')
+            p++;
+        else if (*p == '"')
+            inString = !inString;
+        else if (*p == '#' && !inString) {
+            *p = '\0';
+            break;
+        }
+    }
+
+    char *s = SkipSpace(line);
+    while (true) {                              // labels
+        char *end = s;
+        while (IsLabelChar(*end))
+            end++;
+        if (end == s || *end != ':')
+            break;
+        *end = '\0';
+        int address = (*inText ? TextBase + 4 * (int)text.size()
+                               : DataSegment + (int)data.size());
+        DefineLabel(s, address, lineNum);
+        s = SkipSpace(end + 1);
+    }
+    if (*s == '\0')
+        return;
+
+    char *name = s;
+    while (*s != '\0' && !isspace((unsigned char)*s))
+        s++;
+    if (*s != '\0')
+        *s++ = '\0';
+
+    if (name[0] == '.')
+        AssembleDirective(name, s, lineNum, inText);
+    else if (!*inText)
+        Error(lineNum, "instruction %s in the data segment", name);
+    else
+        AssembleInstruction(name, s, lineNum);
+}
+
+void MipsSimulator::DefineLabel(const char *name, int address, int lineNum) {
+    if (labels.count(name) != 0)
+        Error(lineNum, "label %s is defined more than once", name);
+    else
+        labels[name] = address;
+}
+
+static void AppendWord(std::vector<unsigned char> *bytes, int value) {
+    for (int i = 0; i < 4; i++)
+        bytes->push_back((value >> (8 * i)) & 0xff);
+}
+
+void MipsSimulator::AssembleDirective(char *dir, char *args, int lineNum,
+                                      bool *inText) {
+    char *s = SkipSpace(args);
+
+    if (strcmp(dir, ".text") == 0) {
+        *inText = true;
+    } else if (strcmp(dir, ".data") == 0) {
+        *inText = false;
+    } else if (strcmp(dir, ".globl") == 0 || strcmp(dir, ".extern") == 0) {
+        // every label is visible anyway
+    } else if (strcmp(dir, ".align") == 0) {
+        int n;
+        if (!ParseImmediate(&s, &n) || n < 0 || n > 12)
+            Error(lineNum, "bad alignment");
+        else if (!*inText)
+            while (data.size() % (1 << n) != 0)
+                data.push_back(0);
+    } else if (*inText) {
+        Error(lineNum, "directive %s in the text segment", dir);
+    } else if (strcmp(dir, ".word") == 0 || strcmp(dir, ".byte") == 0) {
+        bool isWord = (dir[1] == 'w');
+        do {
+            int value = 0;
+            std::string label;
+            s = SkipSpace(s);
+            if (isWord && (isalpha((unsigned char)*s) || *s == '_')) {
+                ParseLabel(&s, &label);
+                Fixup f = { label, false, (int)data.size(), lineNum };
+                fixups.push_back(f);
+            } else if (!ParseImmediate(&s, &value)) {
+                Error(lineNum, "bad operand for %s", dir);
+                return;
+            }
+            if (isWord)
+                AppendWord(&data, value);
+            else
+                data.push_back(value & 0xff);
+        } while (ParseComma(&s));
+    } else if (strcmp(dir, ".space") == 0) {
+        int n;
+        if (!ParseImmediate(&s, &n) || n < 0)
+            Error(lineNum, "bad size for .space");
+        else
+            data.resize(data.size() + n, 0);
+    } else if (strcmp(dir, ".ascii") == 0 || strcmp(dir, ".asciiz") == 0) {
+        if (*s != '"') {
+            Error(lineNum, "expected a string for %s", dir);
+            return;
+        }
+        for (s++; *s != '"'; s++) {
+            char c = *s;
+            if (c == '\0') {
+                Error(lineNum, "unterminated string");
+                return;
+            }
+            if (c == '\\') {
+                switch (*++s) {
+                  case 'n': c = '\n'; break;
+                  case 't': c = '\t'; break;
+                  case '0': c = '\0'; break;
+                  default: c = *s; break;
+                }
+            }
+            data.push_back(c);
+        }
+        if (dir[6] == 'z')
+            data.push_back('\0');
+    } else {
+        Error(lineNum, "unknown directive %s", dir);
+    }
+}
+
+bool MipsSimulator::ParseRegister(char **s, int *reg) {
+    char *p = SkipSpace(*s);
+    if (*p != '$')
+        return false;
+    p++;
+    if (isdigit((unsigned char)*p)) {
+        *reg = strtol(p, &p, 10);
+        if (*reg > 31)
+            return false;
+    } else {
+        char *end = p;
+        while (isalnum((unsigned char)*end))
+            end++;
+        std::string name(p, end - p);
+        *reg = -1;
+        for (int i = 0; i < 32; i++)
+            if (name == registerNames[i])
+                *reg = i;
+        if (name == "s8")
+            *reg = Fp;
+        if (*reg < 0)
+            return false;
+        p = end;
+    }
+    *s = p;
+    return true;
+}
+
+bool MipsSimulator::ParseImmediate(char **s, int *imm) {
+    char *p = SkipSpace(*s), *end;
+    long value = strtol(p, &end, 0);
+    if (end == p)
+        return false;
+    *imm = (int)value;
+    *s = end;
+    return true;
+}
+
+bool MipsSimulator::ParseLabel(char **s, std::string *label) {
+    char *p = SkipSpace(*s), *end = p;
+    while (IsLabelChar(*end))
+        end++;
+    if (end == p || isdigit((unsigned char)*p))
+        return false;
+    label->assign(p, end - p);
+    *s = end;
+    return true;
+}
+
+bool MipsSimulator::ParseComma(char **s) {
+    char *p = SkipSpace(*s);
+    if (*p != ',')
+        return false;
+    *s = p + 1;
+    return true;
+}
+
+/* Method: AssembleInstruction
+ * ---------------------------
+ * Translates one instruction, given the forms of operands its mnemonic
+ * takes. SPIM allows an immediate for the last operand of any of the
+ * three-register instructions, so we do too.
+ */
+void MipsSimulator::AssembleInstruction(char *mnemonic, char *args,
+                                        int lineNum) {
+    const OpInfo *info = opInfo;
+    while (info->name != NULL && strcmp(info->name, mnemonic) != 0)
+        info++;
+    if (info->name == NULL) {
+        Error(lineNum, "unknown instruction %s", mnemonic);
+        return;
+    }
+
+    Instruction in = { info->op, 0, 0, -1, 0, 0, lineNum };
+    std::string label;
+    char *s = args;
+    bool ok = true;
+
+    switch (info->form) {
+      case NoOperands:
+        break;
+      case Reg3:
+        ok = ParseRegister(&s, &in.rd) && ParseComma(&s) &&
+             ParseRegister(&s, &in.rs) && ParseComma(&s) &&
+             (ParseRegister(&s, &in.rt) || ParseImmediate(&s, &in.imm));
+        break;
+      case Reg2:
+        ok = ParseRegister(&s, &in.rd) && ParseComma(&s) &&
+             ParseRegister(&s, &in.rs);
+        break;
+      case RegImm:
+        ok = ParseRegister(&s, &in.rd) && ParseComma(&s) &&
+             ParseImmediate(&s, &in.imm);
+        break;
+      case RegLabel:
+        ok = ParseRegister(&s, &in.rd) && ParseComma(&s) &&
+             ParseLabel(&s, &label);
+        break;
+      case Memory:
+        ok = ParseRegister(&s, &in.rd) && ParseComma(&s);
+        if (ok) {
+            ParseImmediate(&s, &in.imm);        // the offset is optional
+            s = SkipSpace(s);
+            ok = (*s++ == '(') && ParseRegister(&s, &in.rs);
+            s = SkipSpace(s);
+            ok = ok && (*s++ == ')');
+        }
+        break;
+      case Label:
+        ok = ParseLabel(&s, &label);
+        break;
+      case RegBranch:
+        ok = ParseRegister(&s, &in.rs) && ParseComma(&s) &&
+             ParseLabel(&s, &label);
+        break;
+      case Reg2Branch:
+        ok = ParseRegister(&s, &in.rs) && ParseComma(&s) &&
+             (ParseRegister(&s, &in.rt) || ParseImmediate(&s, &in.imm)) &&
+             ParseComma(&s) && ParseLabel(&s, &label);
+        break;
+      case Reg1:
+        ok = ParseRegister(&s, &in.rs);
+        break;
+      case Src2:
+        ok = ParseRegister(&s, &in.rs) && ParseComma(&s) &&
+             ParseRegister(&s, &in.rt);
+        break;
+      case Dst1:
+        ok = ParseRegister(&s, &in.rd);
+        break;
+    }
+    if (!ok || *SkipSpace(s) != '\0') {
+        Error(lineNum, "bad operands for %s", mnemonic);
+        return;
+    }
+
+    if (!label.empty()) {
+        Fixup f = { label, true, (int)text.size(), lineNum };
+        fixups.push_back(f);
+    }
+    text.push_back(in);
+}
+
+void MipsSimulator::AddBuiltins() {
+    for (int i = 0; builtinNames[i] != NULL; i++) {
+        if (labels.count(builtinNames[i]) != 0)
+            continue;
+        labels[builtinNames[i]] = TextBase + 4 * (int)text.size();
+        Instruction in = { Builtin, 0, 0, -1, i, 0, 0 };
+        text.push_back(in);
+    }
+}
+
+void MipsSimulator::ResolveFixups() {
+    for (size_t i = 0; i < fixups.size(); i++) {
+        Fixup *f = &fixups[i];
+        std::map<std::string, int>::iterator l = labels.find(f->label);
+        if (l == labels.end()) {
+            Error(f->line, "undefined label %s", f->label.c_str());
+        } else if (f->inText) {
+            text[f->index].target = l->second;
+        } else {
+            for (int b = 0; b < 4; b++)
+                data[f->index + b] = (l->second >> (8 * b)) & 0xff;
+        }
+    }
+    fixups.clear();
+}
+
+
+/* Method: RuntimeError
+ * --------------------
+ * Reports an error that stops the program. The messages go to stdout,
+ * where SPIM's console would show them, so that they come out in order
+ * with the program's own output.
+ */
+void MipsSimulator::RuntimeError(const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    vprintf(fmt, args);
+    va_end(args);
+    halted = failed = true;
+}
+
+/* Method: Address
+ * ---------------
+ * Maps an address in the data segment, the heap or the stack to where
+ * its bytes are kept. An access below the stack grows it, as in SPIM,
+ * by at least as much again as its current size; it is an error for
+ * that to make the stack reach the limit. On an error, returns NULL.
+ */
+unsigned char *MipsSimulator::Address(unsigned addr, int size, bool isWrite) {
+    if (addr % size != 0) {
+        RuntimeError("Exception occurred at PC=0x%08x\n"
+                     "  Unaligned address in %s: 0x%08x\n",
+                     TextBase + 4 * (pc - 1),
+                     isWrite ? "store" : "inst/data fetch", addr);
+        return NULL;
+    }
+    if (addr >= (unsigned)DataSegment && addr < (unsigned)heapTop)
+        return &data[addr - DataSegment];
+
+    if (addr >= (unsigned)heapTop && addr < StackTop) {
+        unsigned bottom = StackTop - stackSize;
+        if (addr < bottom) {
+            int extra = bottom - addr + 4;
+            int newSize = stackSize + (extra > stackSize ? extra : stackSize);
+            if (newSize >= StackLimit) {
+                RuntimeError("Can't expand stack segment by %d bytes to "
+                             "%d bytes\nUse -lstack # with # > %d\n",
+                             extra, newSize, newSize);
+                return NULL;
+            }
+            stackSize = newSize;
+        }
+        if (addr < stackLow)
+            stackLow = addr;
+        return &stack[addr - (StackTop - StackLimit)];
+    }
+
+    RuntimeError("Exception occurred at PC=0x%08x\n"
+                 "  Bad address in data/stack %s: 0x%08x\n",
+                 TextBase + 4 * (pc - 1), isWrite ? "write" : "read", addr);
+    return NULL;
+}
+
+bool MipsSimulator::LoadWord(unsigned addr, int *value) {
+    unsigned char *p = Address(addr, 4, false);
+    if (p == NULL)
+        return false;
+    *value = p[0] | (p[1] << 8) | (p[2] << 16) | ((unsigned)p[3] << 24);
+    return true;
+}
+
+bool MipsSimulator::StoreWord(unsigned addr, int value) {
+    unsigned char *p = Address(addr, 4, true);
+    if (p == NULL)
+        return false;
+    for (int i = 0; i < 4; i++)
+        p[i] = (value >> (8 * i)) & 0xff;
+    return true;
+}
+
+// The heap grows up from the end of the data, a word at a time
+int MipsSimulator::Sbrk(int bytes) {
+    int old = heapTop;
+    if (bytes < 0 || heapTop + (long)bytes > DataSegment + (long)HeapLimit) {
+        RuntimeError("Can't expand data segment by %d bytes to %d bytes\n",
+                     bytes, heapTop + bytes - DataSegment);
+        return 0;
+    }
+    heapTop += (bytes + 3) & ~3;
+    data.resize(heapTop - DataSegment, 0);
+    return old;
+}
+
+int MipsSimulator::TextIndex(unsigned addr) {
+    unsigned index = (addr - TextBase) / 4;
+    if (addr < (unsigned)TextBase || addr % 4 != 0 || index >= text.size()) {
+        RuntimeError("Exception occurred at PC=0x%08x\n"
+                     "  Bad address in text read: 0x%08x\n",
+                     TextBase + 4 * (pc - 1), addr);
+        return -1;
+    }
+    return index;
+}
+
+
+/* Method: Run
+ * -----------
+ * Starts the program where SPIM would, with $sp and $gp where SPIM puts
+ * them, and executes instructions until it exits or is stopped. SPIM
+ * leaves a 4KB gap at the top of the stack and then pushes argc and the
+ * argv and environment arrays; here those are empty, so $sp points to
+ * argc (0), with the NULL words that end the two arrays above it.
+ */
+int MipsSimulator::Run() {
+    regs[Sp] = stackStart;
+    regs[Gp] = GlobalPointer;
+    pc = 0;
+    halted = failed = false;
+
+    while (!halted) {
+        if (pc < 0 || pc >= (int)text.size())
+            TextIndex(TextBase + 4 * pc);
+        else
+            Execute(&text[pc++]);
+    }
+    fflush(stdout);
+    return failed ? 1 : 0;
+}
+
+// Whether adding a and b overflowed to sum (add and sub trap on overflow)
+static bool AddOverflows(int a, int b, int sum) {
+    return (a >= 0) == (b >= 0) && (sum >= 0) != (a >= 0);
+}
+
+void MipsSimulator::Execute(Instruction *in) {
+    int s = regs[in->rs];
+    int t = (in->rt >= 0 ? regs[in->rt] : in->imm);
+    int result = 0;
+    bool writesRd = true;
+
+    if (in->op != Builtin)
+        numInstructions++;
+
+    switch (in->op) {
+      case Nop:     writesRd = false; break;
+      case Add:
+        result = (int)((unsigned)s + (unsigned)t);
+        if (AddOverflows(s, t, result)) {
+            RuntimeError("Exception occurred at PC=0x%08x\n"
+                         "  Arithmetic overflow\n", TextBase + 4 * (pc - 1));
+            return;
+        }
+        break;
+      case Sub:
+        result = (int)((unsigned)s - (unsigned)t);
+        if ((s >= 0) != (t >= 0) && (result >= 0) != (s >= 0)) {
+            RuntimeError("Exception occurred at PC=0x%08x\n"
+                         "  Arithmetic overflow\n", TextBase + 4 * (pc - 1));
+            return;
+        }
+        break;
+      case Addu:    result = (int)((unsigned)s + (unsigned)t); break;
+      case Subu:    result = (int)((unsigned)s - (unsigned)t); break;
+      case Mul:     result = (int)((unsigned)s * (unsigned)t); break;
+      case Div:
+      case Divu:
+      case Rem:
+      case Remu:
+        if (t == 0) {
+            RuntimeError("Exception occurred at PC=0x%08x\n"
+                         "  Divide by zero\n", TextBase + 4 * (pc - 1));
+            return;
+        }
+        if (in->op == Divu)
+            result = (unsigned)s / (unsigned)t;
+        else if (in->op == Remu)
+            result = (unsigned)s % (unsigned)t;
+        else if (s == (int)0x80000000 && t == -1)
+            result = (in->op == Div ? s : 0);
+        else
+            result = (in->op == Div ? s / t : s % t);
+        break;
+      case And:     result = s & t; break;
+      case Or:      result = s | t; break;
+      case Xor:     result = s ^ t; break;
+      case Nor:     result = ~(s | t); break;
+      case Sll:     result = (int)((unsigned)s << (t & 31)); break;
+      case Srl:     result = (int)((unsigned)s >> (t & 31)); break;
+      case Sra:     result = s >> (t & 31); break;
+      case Seq:     result = (s == t); break;
+      case Sne:     result = (s != t); break;
+      case Slt:     result = (s < t); break;
+      case Sltu:    result = ((unsigned)s < (unsigned)t); break;
+      case Sle:     result = (s <= t); break;
+      case Sgt:     result = (s > t); break;
+      case Sge:     result = (s >= t); break;
+      case Move:    result = s; break;
+      case Neg:     result = (int)(0u - (unsigned)s); break;
+      case Not:     result = ~s; break;
+      case Li:      result = in->imm; break;
+      case Mult: {
+        long long product = (long long)s * t;
+        hi = (int)(product >> 32);
+        lo = (int)product;
+        writesRd = false;
+        break;
+      }
+      case Mfhi:    result = hi; break;
+      case Mflo:    result = lo; break;
+      case La:      result = in->target; break;
+
+      case Lw:
+      case Lb:
+      case Lbu:
+        counts[Loads]++;
+        if ((in->rs == Fp || in->rs == Gp) && in->rd != Fp && in->rd != Ra)
+            counts[SpillLoads]++;
+        if (in->op == Lw) {
+            if (!LoadWord(s + in->imm, &result))
+                return;
+        } else {
+            unsigned char *p = Address(s + in->imm, 1, false);
+            if (p == NULL)
+                return;
+            result = (in->op == Lb ? (signed char)*p : *p);
+        }
+        break;
+      case Sw:
+      case Sb:
+        counts[Stores]++;
+        if ((in->rs == Fp || in->rs == Gp) && in->rd != Fp && in->rd != Ra)
+            counts[SpillStores]++;
+        if (in->op == Sw) {
+            StoreWord(s + in->imm, regs[in->rd]);
+        } else {
+            unsigned char *p = Address(s + in->imm, 1, true);
+            if (p != NULL)
+                *p = regs[in->rd] & 0xff;
+        }
+        return;
+
+      case B:
+      case Beqz: case Bnez: case Bltz: case Blez: case Bgtz: case Bgez:
+      case Beq: case Bne: case Blt: case Ble: case Bgt: case Bge: {
+        bool taken = false;
+        switch (in->op) {
+          case Beqz:    taken = (s == 0); break;
+          case Bnez:    taken = (s != 0); break;
+          case Bltz:    taken = (s < 0); break;
+          case Blez:    taken = (s <= 0); break;
+          case Bgtz:    taken = (s > 0); break;
+          case Bgez:    taken = (s >= 0); break;
+          case Beq:     taken = (s == t); break;
+          case Bne:     taken = (s != t); break;
+          case Blt:     taken = (s < t); break;
+          case Ble:     taken = (s <= t); break;
+          case Bgt:     taken = (s > t); break;
+          case Bge:     taken = (s >= t); break;
+          default:      taken = true; break;
+        }
+        counts[Branches]++;
+        if (taken)
+            pc = TextIndex(in->target);
+        return;
+      }
+      case Jal:
+      case Jalr:
+        counts[Calls]++;
+        regs[Ra] = TextBase + 4 * pc;
+        pc = TextIndex(in->op == Jal ? in->target : s);
+        return;
+      case Jr:
+        counts[Returns]++;
+        pc = TextIndex(s);
+        return;
+      case Syscall:
+        counts[Syscalls]++;
+        DoSyscall();
+        return;
+      case Builtin:
+        counts[BuiltinCalls]++;
+        builtinCounts[builtinNames[in->imm]]++;
+        DoBuiltin(in->imm);
+        if (!halted)
+            pc = TextIndex(regs[Ra]);
+        return;
+      case NumOps:
+        Assert(0);
+    }
+    if (writesRd && in->rd != Zero)
+        regs[in->rd] = result;
+}
+
+/* Method: ReadConsoleLine
+ * -----------------------
+ * Reads a line of input the way SPIM does, keeping the newline. Like
+ * fgets, it stops short of the end of the line after size-1 characters.
+ */
+std::string MipsSimulator::ReadConsoleLine(int size) {
+    std::string line;
+    int c;
+    fflush(stdout);
+    while ((int)line.size() < size - 1 && (c = getchar()) != EOF) {
+        line += (char)c;
+        if (c == '\n')
+            break;
+    }
+    return line;
+}
+
+std::string MipsSimulator::StringAt(unsigned addr) {
+    std::string s;
+    unsigned char *p;
+    while ((p = Address(addr++, 1, false)) != NULL && *p != '\0')
+        s += (char)*p;
+    return s;
+}
+
+void MipsSimulator::DoSyscall() {
+    switch (regs[V0]) {
+      case 1:   printf("%d", regs[A0]); break;
+      case 4:   fputs(StringAt(regs[A0]).c_str(), stdout); break;
+      case 5:   regs[V0] = atoi(ReadConsoleLine(256).c_str()); break;
+      case 8: {
+        std::string line = ReadConsoleLine(regs[A1]);
+        for (size_t i = 0; i <= line.size() && (int)i < regs[A1]; i++) {
+            unsigned char *p = Address(regs[A0] + i, 1, true);
+            if (p == NULL)
+                break;
+            *p = (i < line.size() ? line[i] : '\0');
+        }
+        break;
+      }
+      case 9:   regs[V0] = Sbrk(regs[A0]); break;
+      case 10:  halted = true; break;
+      case 11:  putchar(regs[A0]); break;
+      default:
+        RuntimeError("Unknown system call: %d\n", regs[V0]);
+        break;
+    }
+}
+
+/* Method: DoBuiltin
+ * -----------------
+ * Runs one of the Decaf runtime routines. Their arguments were pushed
+ * on the stack by the caller, the first nearest the top.
+ */
+void MipsSimulator::DoBuiltin(int which) {
+    int arg0 = 0, arg1 = 0;
+    LoadWord(regs[Sp] + 4, &arg0);
+    if (which == 3)
+        LoadWord(regs[Sp] + 8, &arg1);
+    if (halted)
+        return;
+
+    switch (which) {
+      case 0:                                   // _Alloc
+        regs[V0] = Sbrk(arg0);
+        break;
+      case 1: {                                 // _ReadLine
+        std::string line = ReadConsoleLine(ReadLineSize);
+        if (!line.empty() && line[line.size() - 1] == '\n')
+            line.erase(line.size() - 1);
+        int buffer = Sbrk(ReadLineSize);
+        if (buffer != 0)
+            memcpy(&data[buffer - DataSegment], line.c_str(), line.size() + 1);
+        regs[V0] = buffer;
+        break;
+      }
+      case 2:                                   // _ReadInteger
+        regs[V0] = atoi(ReadConsoleLine(256).c_str());
+        break;
+      case 3:                                   // _StringEqual
+        regs[V0] = (StringAt(arg0) == StringAt(arg1));
+        break;
+      case 4:                                   // _PrintInt
+        printf("%d", arg0);
+        break;
+      case 5:                                   // _PrintString
+        fputs(StringAt(arg0).c_str(), stdout);
+        break;
+      case 6:                                   // _PrintBool
+        fputs(arg0 ? "true" : "false", stdout);
+        break;
+      case 7:                                   // _Halt
+        halted = true;
+        break;
+    }
+}
+
+
+void MipsSimulator::Report(FILE *out, const char *name) {
+    fprintf(out, "+++ counts for %s\n", name ? name : "stdin");
+    fprintf(out, "  %-20s %10ld\n", "instructions", numInstructions);
+    for (int c = 0; c < NumClasses; c++)
+        fprintf(out, "  %-20s %10ld\n", classNames[c], counts[c]);
+    std::map<std::string, long>::iterator i;
+    for (i = builtinCounts.begin(); i != builtinCounts.end(); ++i)
+        fprintf(out, "    %-18s %10ld\n", i->first.c_str(), i->second);
+    fprintf(out, "  %-20s %10ld bytes\n", "peak heap", PeakHeap());
+    fprintf(out, "  %-20s %10ld bytes\n", "peak stack", PeakStack());
+}
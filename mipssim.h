@@ -0,0 +1,154 @@
+/* File: mipssim.h
+ * ---------------
+ * The MipsSimulator class assembles and runs the MIPS code dcc writes,
+ * so that the generated code can be tested and measured without SPIM.
+ * It understands the subset of the SPIM assembly language that the Mips
+ * class emits (plus the obvious relatives of those instructions, e.g.
+ * the other branches and shifts), the .text/.data/.align/.globl/.word/
+ * .byte/.space/.ascii/.asciiz directives and the SPIM syscalls for
+ * console I/O, sbrk and exit.
+ *
+ * The Decaf runtime routines (_Alloc, _PrintInt, _StringEqual, etc.),
+ * which SPIM loads from its trap handler file, are built in: a call to
+ * one of them runs it natively, and it is counted as a call to a builtin
+ * rather than as the instructions it would take on SPIM.
+ *
+ * Memory is laid out like SPIM's: the text starts at 0x00400000, the
+ * data at 0x10010000 with the heap right after it, and the stack grows
+ * down from 0x80000000. Like SPIM's, the stack is grown in steps that
+ * double its size, and may not reach 512KB.
+ *
+ * While running, it counts the instructions executed, broken down by
+ * class. Each instruction in the source counts once, whether or not SPIM
+ * would expand it into several machine instructions (li, la, mul, etc.).
+ */
+
+#ifndef _H_mipssim
+#define _H_mipssim
+
+#include <stdio.h>
+#include <map>
+#include <string>
+#include <vector>
+
+class MipsSimulator
+{
+  public:
+    typedef enum { Loads, Stores, SpillLoads, SpillStores, Branches,
+                   Calls, Returns, Syscalls, BuiltinCalls,
+                   NumClasses } Class;
+
+    MipsSimulator();
+
+    // Reads the assembly from in, reporting any errors on stderr.
+    // Returns whether it assembled without error.
+    bool Assemble(FILE *in, const char *fileName);
+
+    // Runs the program from main, with stdin and stdout as its console.
+    // Returns its exit status: 0 when the program exits normally, 1 when
+    // it was stopped by a runtime error.
+    int Run();
+
+    void Report(FILE *out, const char *fileName);
+
+    long InstructionCount() { return numInstructions; }
+    long Count(Class c) { return counts[c]; }
+    long PeakHeap() { return heapTop - heapBase; }
+    long PeakStack() { return stackStart - stackLow; }
+
+  private:
+    typedef enum { Nop, Add, Addu, Sub, Subu, Mul, Div, Divu, Rem, Remu,
+                   And, Or, Xor, Nor, Sll, Srl, Sra, Seq, Sne, Slt, Sltu,
+                   Sle, Sgt, Sge, Move, Neg, Not, Li, La, Lw, Lb, Lbu, Sw,
+                   Sb, B, Beqz, Bnez, Bltz, Blez, Bgtz, Bgez, Beq, Bne,
+                   Blt, Ble, Bgt, Bge, Jal, Jalr, Jr, Mult, Mfhi, Mflo,
+                   Syscall, Builtin, NumOps } OpCode;
+
+    // The operands an instruction is written with
+    typedef enum { NoOperands, Reg3, Reg2, RegImm, RegLabel, Memory,
+                   Label, RegBranch, Reg2Branch, Reg1, Src2, Dst1 } Form;
+
+    struct OpInfo {
+        const char *name;
+        OpCode op;
+        Form form;
+    };
+
+    struct Instruction {
+        OpCode op;
+        int rd, rs, rt;     // rt is -1 when the last operand is imm
+        int imm;
+        int target;         // address of the label operand, once resolved
+        int line;
+    };
+
+    // A use of a label, which can only be filled in once all of the
+    // labels are known
+    struct Fixup {
+        std::string label;
+        bool inText;
+        int index;          // of the instruction, or of the data word
+        int line;
+    };
+
+    static const int TextBase = 0x00400000;
+    static const int DataBase = 0x10010000;
+    static const unsigned StackTop = 0x80000000u;
+    static const int StackLimit = 512 * 1024;
+    static const int InitialStack = 64 * 1024;
+    static const int HeapLimit = 64 * 1024 * 1024;
+    static const int ReadLineSize = 128;
+
+    static const OpInfo opInfo[];
+    static const char * const builtinNames[];
+    static const char * const classNames[NumClasses];
+
+    std::vector<Instruction> text;
+    std::vector<unsigned char> data;    // the data segment and the heap
+    std::vector<unsigned char> stack;   // indexed from StackTop down
+    std::map<std::string, int> labels;
+    std::vector<Fixup> fixups;
+    const char *fileName;
+    int numErrors;
+
+    int regs[32];
+    int hi, lo;                         // the product of the last mult
+    int pc;                             // index into text
+    bool halted, failed;
+    int heapBase, heapTop;
+    unsigned stackStart;                // where $sp starts out
+    unsigned stackLow;                  // lowest stack address touched
+    int stackSize;                      // bytes the stack has grown to
+
+    long numInstructions;
+    long counts[NumClasses];
+    std::map<std::string, long> builtinCounts;
+
+    void AssembleLine(char *line, int lineNum, bool *inText);
+    void AssembleDirective(char *dir, char *args, int lineNum, bool *inText);
+    void AssembleInstruction(char *mnemonic, char *args, int lineNum);
+    void DefineLabel(const char *name, int address, int lineNum);
+    void AddBuiltins();
+    void ResolveFixups();
+    void Error(int lineNum, const char *fmt, ...);
+
+    bool ParseRegister(char **s, int *reg);
+    bool ParseImmediate(char **s, int *imm);
+    bool ParseLabel(char **s, std::string *label);
+    bool ParseComma(char **s);
+
+    unsigned char *Address(unsigned addr, int size, bool isWrite);
+    bool LoadWord(unsigned addr, int *value);
+    bool StoreWord(unsigned addr, int value);
+    int Sbrk(int bytes);
+    int TextIndex(unsigned addr);
+    void RuntimeError(const char *fmt, ...);
+
+    void Execute(Instruction *in);
+    void DoSyscall();
+    void DoBuiltin(int which);
+    std::string ReadConsoleLine(int size);
+    std::string StringAt(unsigned addr);
+};
+
+#endif
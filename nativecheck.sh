@@ -0,0 +1,82 @@
+#! /bin/sh
+#
+# Runs the regression suite like check.sh, but compiles each test to
+# x86-64 (dcc -target x86), links it with the C runtime and runs it
+# natively, see x86.h. With TARGET=c, each test is compiled to C instead
+# (dcc -target c, see csource.h) and then by $CC with $CFLAGS. As with
+# simcheck.sh, the SPIM banner at the top of the expected outputs is
+# skipped.
+#
+# A native program's stack is as big as the host gives it, so tests that
+# check where SPIM runs out of stack (listed in $SKIP) are not run.
+
+[ -x dcc ] || { echo "Error: dcc not executable"; exit 1; }
+
+DIR="samples"
+TARGET=${TARGET:-"x86"}
+CC=${CC:-"gcc"}
+CFLAGS=${CFLAGS:-"-O2"}
+SKIP=${SKIP:-"rec recframe"}
+
+LIST=
+if [ "$#" = "0" ]; then
+	LIST=`ls $DIR/*.out`
+else
+	for test in "$@"; do
+		LIST="$LIST $DIR/$test.out"
+	done
+fi
+
+tmp=${TMP:-"/tmp"}/nativecheck
+status=0
+
+for file in $LIST; do
+	base=`echo $file | sed 's/\(.*\)\.out/\1/'`
+	name=`basename $base`
+
+	ext=''
+	if [ -r $base.frag ]; then
+		ext='frag'
+	elif [ -r $base.decaf ]; then
+		ext='decaf'
+	else
+		echo "Error: Input file for base: $base not found"
+		continue
+	fi
+	case " $SKIP " in
+		*" $name "*) echo "Skipping $file"; continue ;;
+	esac
+
+	printf "Checking %-27s: " $file
+	src=$tmp.s
+	[ $TARGET = c ] && src=$tmp.c
+	flags=
+	[ -r $base.flags ] && flags=`cat $base.flags`
+	./dcc -target $TARGET $flags < $base.$ext > $src 2> $tmp.errors
+	if [ $? -ne 0 -o -s $tmp.errors ]; then
+		cp $tmp.errors $tmp.out
+	elif ! $CC $CFLAGS -no-pie -o $tmp $src runtime.c > $tmp.out 2>&1; then
+		echo "Error: $base does not assemble"
+	elif [ -r $base.in ]; then
+		$tmp < $base.in > $tmp.out 2>&1
+	else
+		$tmp < /dev/null > $tmp.out 2>&1
+	fi
+
+	if head -1 $file | grep -q '^SPIM Version'; then
+		tail -n +6 $file > $tmp.expected
+	else
+		cp $file $tmp.expected
+	fi
+
+	if cmp -s $tmp.out $tmp.expected; then
+		echo "PASS"
+	else
+		echo "FAIL <--"
+		diff $tmp.out $tmp.expected
+		status=1
+	fi
+done
+
+rm -f $tmp $tmp.s $tmp.c $tmp.errors $tmp.out $tmp.expected
+exit $status
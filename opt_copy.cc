@@ -0,0 +1,310 @@
+/* File: opt_copy.cc
+ * -----------------
+ * Copy propagation and coalescing (see optimizer.h).
+ *
+ * Within a block, after x = y the reads of x are made reads of y, for as
+ * long as neither is assigned again (and, if either is a global, until
+ * the next call). That leaves many copies that are not read any more,
+ * for dead code elimination to take away.
+ *
+ * A copy x = t whose t is not read afterwards is then folded into the
+ * instruction in the same block that assigned t, as long as nothing in
+ * between touches x or reads t: that instruction assigns x instead, so
+ * that t = a + b; x = t becomes x = a + b. Where t is still read further
+ * on in the block (but not after it), with x unchanged, those reads are
+ * made reads of x first, as for the test at the bottom of a loop after
+ * i = i + 1. That is only done if the copy can then be folded, or it
+ * would just undo the propagation above.
+ *
+ * Both halves keep indexes (of the copies from each variable, and of
+ * where in the block each variable is read and assigned) rather than
+ * walking the block for each copy, so that a long block, such as a main
+ * made of thousands of calls, takes time in proportion to its length.
+ */
+
+#include "optimizer.h"
+#include "cfg.h"
+#include "liveness.h"
+#include "ssa.h"
+#include "stats.h"
+#include "utility.h"
+#include <algorithm>
+#include <climits>
+#include <map>
+#include <set>
+#include <vector>
+
+typedef std::pair<int,int> VarKey;             // segment and offset
+
+static VarKey KeyFor(Location *loc) {
+  return VarKey(loc->GetSegment(), loc->GetOffset());
+}
+
+namespace {
+
+/* Class: CopyMap
+ * --------------
+ * The copies in force at a point in a block: the src of each dst, along
+ * with the dsts of each src and the dsts of the copies to or from
+ * globals, so that forgetting those of one variable, or those a call
+ * ends, only touches the copies concerned.
+ */
+class CopyMap {
+  private:
+    std::map<VarKey, Location*> copyOf;
+    std::map<VarKey, std::set<VarKey> > copiesFrom;
+    std::set<VarKey> global;
+
+  public:
+         // Returns the src of the copy to loc, or NULL
+    Location *Lookup(Location *loc) {
+      std::map<VarKey, Location*>::iterator i = copyOf.find(KeyFor(loc));
+      return (i == copyOf.end() ? NULL : i->second);
+    }
+    void Add(Location *dst, Location *src) {
+      copyOf[KeyFor(dst)] = src;
+      copiesFrom[KeyFor(src)].insert(KeyFor(dst));
+      if (dst->GetSegment() == gpRelative || src->GetSegment() == gpRelative)
+        global.insert(KeyFor(dst));
+    }
+
+         // Forgets the copies to and from the variable at key
+    void Kill(VarKey key) {
+      std::map<VarKey, Location*>::iterator i = copyOf.find(key);
+      if (i != copyOf.end()) {
+        copiesFrom[KeyFor(i->second)].erase(key);
+        global.erase(key);
+        copyOf.erase(i);
+      }
+      std::map<VarKey, std::set<VarKey> >::iterator f = copiesFrom.find(key);
+      if (f == copiesFrom.end())
+        return;
+      for (std::set<VarKey>::iterator d = f->second.begin(); d != f->second.end(); ++d) {
+        copyOf.erase(*d);
+        global.erase(*d);
+      }
+      copiesFrom.erase(f);
+    }
+
+         // Forgets the copies to and from globals, which a call may assign
+    void KillGlobals() {
+      std::vector<VarKey> dsts(global.begin(), global.end());
+      for (size_t d = 0; d < dsts.size(); d++)
+        Kill(dsts[d]);
+    }
+};
+
+/* Class: BlockIndex
+ * -----------------
+ * Where in a block each variable is read and assigned, and where the
+ * calls are, by position. It is kept up to date as instructions are
+ * changed, and the copies folded away are left as NULL until the end, so
+ * that the positions don't move.
+ */
+class BlockIndex {
+  private:
+    std::map<VarKey, std::set<int> > reads, writes;
+    std::set<int> calls;
+
+    void Update(Instruction *instr, int pos, bool add);
+
+  public:
+    BlockIndex(BasicBlock *b);
+
+    void Add(Instruction *instr, int pos)    { Update(instr, pos, true); }
+    void Remove(Instruction *instr, int pos) { Update(instr, pos, false); }
+
+         // The last position before pos, or -1, and the first after pos,
+         // or INT_MAX, at which key is read or assigned, or there is a call
+    static int Before(const std::set<int> &s, int pos) {
+      std::set<int>::const_iterator i = s.lower_bound(pos);
+      return (i == s.begin() ? -1 : *--i);
+    }
+    static int After(const std::set<int> &s, int pos) {
+      std::set<int>::const_iterator i = s.upper_bound(pos);
+      return (i == s.end() ? INT_MAX : *i);
+    }
+    std::set<int> &Reads(VarKey key)  { return reads[key]; }
+    std::set<int> &Writes(VarKey key) { return writes[key]; }
+    std::set<int> &Calls()            { return calls; }
+};
+
+BlockIndex::BlockIndex(BasicBlock *b) {
+  for (size_t j = 0; j < b->code.size(); j++)
+    Add(b->code[j], j);
+}
+
+void BlockIndex::Update(Instruction *instr, int pos, bool add) {
+  List<Location*> srcs;
+  instr->GetSrcs(&srcs);
+  for (int s = 0; s < srcs.NumElements(); s++) {
+    if (add)
+      reads[KeyFor(srcs.Nth(s))].insert(pos);
+    else
+      reads[KeyFor(srcs.Nth(s))].erase(pos);
+  }
+  if (instr->GetDst() != NULL) {
+    if (add)
+      writes[KeyFor(instr->GetDst())].insert(pos);
+    else
+      writes[KeyFor(instr->GetDst())].erase(pos);
+  }
+  if (SSAForm::IsCall(instr)) {
+    if (add)
+      calls.insert(pos);
+    else
+      calls.erase(pos);
+  }
+}
+
+} // namespace
+
+/* Function: FindAssigner
+ * ----------------------
+ * Finds the instruction before the copy at j that last assigned its src,
+ * which the copy can be folded into if nothing in between touches dst or
+ * reads src. Returns its position, or -1 if there is none such.
+ */
+static int FindAssigner(BasicBlock *b, BlockIndex *index, int j) {
+  Assign *copy = dynamic_cast<Assign*>(b->code[j]);
+  Location *dst = copy->GetDst(), *src = copy->GetSrc();
+  VarKey dstKey = KeyFor(dst), srcKey = KeyFor(src);
+  if (dstKey == srcKey)
+    return -1;
+  int i = BlockIndex::Before(index->Writes(srcKey), j);
+  if (i < 0 || BlockIndex::Before(index->Reads(srcKey), j) > i ||
+      BlockIndex::Before(index->Reads(dstKey), j) > i ||
+      BlockIndex::Before(index->Writes(dstKey), j) > i)
+    return -1;
+  if (dst->GetSegment() == gpRelative && BlockIndex::Before(index->Calls(), j) > i)
+    return -1;
+  return i;
+}
+
+/* Function: Coalesce
+ * ------------------
+ * Tries to fold the copy at j into the instruction that assigned its
+ * src (see FindAssigner). Returns whether it did (in which case the copy
+ * is gone, leaving NULL in its place).
+ */
+static bool Coalesce(BasicBlock *b, BlockIndex *index, int j) {
+  int i = FindAssigner(b, index, j);
+  if (i < 0)
+    return false;
+  Assign *copy = dynamic_cast<Assign*>(b->code[j]);
+  index->Remove(b->code[i], i);
+  b->code[i]->SetDst(copy->GetDst());
+  index->Add(b->code[i], i);
+  index->Remove(copy, j);
+  b->code[j] = NULL;
+  delete copy;
+  return true;
+}
+
+/* Function: ReadDstInstead
+ * ------------------------
+ * Makes the reads of the src of the copy at j later in the block (up to
+ * where src is assigned again) reads of its dst, if dst still holds the
+ * same value at each of them. Returns whether it did.
+ */
+static bool ReadDstInstead(BasicBlock *b, BlockIndex *index, int j) {
+  Assign *copy = dynamic_cast<Assign*>(b->code[j]);
+  Location *dst = copy->GetDst();
+  VarKey dstKey = KeyFor(dst), srcKey = KeyFor(copy->GetSrc());
+  if (copy->GetSrc()->GetSegment() == gpRelative)   // a call may assign it
+    return false;
+  int end = BlockIndex::After(index->Writes(srcKey), j);
+  int changed = BlockIndex::After(index->Writes(dstKey), j);
+  if (dst->GetSegment() == gpRelative)
+    changed = std::min(changed, BlockIndex::After(index->Calls(), j));
+
+  std::set<int> &reads = index->Reads(srcKey);
+  std::vector<int> readers(reads.upper_bound(j), reads.upper_bound(end));
+  if (!readers.empty() && readers.back() > changed)
+    return false;
+  for (size_t r = 0; r < readers.size(); r++) {
+    Instruction *instr = b->code[readers[r]];
+    List<Location*> srcs, newSrcs;
+    instr->GetSrcs(&srcs);
+    for (int s = 0; s < srcs.NumElements(); s++)
+      newSrcs.Append(KeyFor(srcs.Nth(s)) == srcKey ? dst : srcs.Nth(s));
+    index->Remove(instr, readers[r]);
+    instr->SetSrcs(&newSrcs);
+    index->Add(instr, readers[r]);
+  }
+  return true;
+}
+
+void Optimizer::PropagateCopies() {
+  int numPropagated = 0, numCoalesced = 0, numDropped = 0;
+  for (size_t i = 0; i < graph->rpo.size(); i++) {
+    BasicBlock *b = graph->rpo[i];
+    CopyMap copies;
+    for (size_t j = 0; j < b->code.size(); j++) {
+      Instruction *instr = b->code[j];
+      List<Location*> srcs, newSrcs;
+      instr->GetSrcs(&srcs);
+      bool changed = false;
+      for (int s = 0; s < srcs.NumElements(); s++) {
+        Location *src = copies.Lookup(srcs.Nth(s));
+        newSrcs.Append(src != NULL ? src : srcs.Nth(s));
+        changed = changed || (src != NULL);
+      }
+      if (changed) {
+        instr->SetSrcs(&newSrcs);
+        numPropagated++;
+      }
+
+      if (instr->GetDst() != NULL)
+        copies.Kill(KeyFor(instr->GetDst()));
+      if (SSAForm::IsCall(instr))
+        copies.KillGlobals();
+      if (Assign *copy = dynamic_cast<Assign*>(instr)) {
+        if (KeyFor(copy->GetDst()) == KeyFor(copy->GetSrc())) {
+          b->code.erase(b->code.begin() + j--);
+          delete copy;
+          numDropped++;
+        } else {
+          copies.Add(copy->GetDst(), copy->GetSrc());
+        }
+      }
+    }
+  }
+
+  // Going back through each block, with what is live after the
+  // instruction at hand
+  if (numPropagated > 0 || numDropped > 0)
+    InvalidateLiveness();
+  Liveness &liveness = *GetLiveness();
+  for (size_t i = 0; i < graph->rpo.size(); i++) {
+    BasicBlock *b = graph->rpo[i];
+    BlockIndex index(b);
+    std::vector<bool> live = liveness.liveOut[b->id];
+    for (int j = b->code.size(); j-- > 0; ) {
+      Assign *copy = dynamic_cast<Assign*>(b->code[j]);
+      if (copy != NULL && live[liveness.VarFor(copy->GetSrc())] &&
+          !liveness.liveOut[b->id][liveness.VarFor(copy->GetSrc())] &&
+          FindAssigner(b, &index, j) >= 0 && ReadDstInstead(b, &index, j)) {
+        live[liveness.VarFor(copy->GetSrc())] = false;
+        live[liveness.VarFor(copy->GetDst())] = true;
+      }
+      if (copy != NULL && !live[liveness.VarFor(copy->GetSrc())] &&
+          Coalesce(b, &index, j)) {
+        numCoalesced++;
+        continue;
+      }
+      liveness.Step(b->code[j], &live);
+    }
+    b->code.erase(std::remove(b->code.begin(), b->code.end(), (Instruction*)NULL),
+                  b->code.end());
+  }
+  // Folding copies leaves what is live into and out of each block as it
+  // was (dst is assigned earlier, where nothing in between touches it, and
+  // src isn't read again before its next assignment), so the liveness
+  // need not be found again
+
+  Stats::Count(Stats::CopiesPropagated, numPropagated);
+  Stats::Count(Stats::CopiesCoalesced, numCoalesced);
+  PrintDebug("opt", "%s: propagated copies into %d instructions, coalesced %d copies",
+             name, numPropagated, numCoalesced);
+}
@@ -0,0 +1,115 @@
+/* File: opt_dce.cc
+ * ----------------
+ * Dead code elimination (see optimizer.h).
+ *
+ * An instruction is dead if all it does is assign a variable that is not
+ * live after it (see liveness.h). Locals and temps can't be got at by
+ * anything but the code of the function, so this takes care of dead
+ * stores to them as well. Calls, Stores and Returns are never dead, and
+ * neither are a Div or Mod, which trap on a zero divisor. (Add and Sub
+ * trap on overflow on Mips, but the other targets don't, so that is not
+ * counted as something the program does.)
+ *
+ * Removing an instruction can make the ones computing its operands dead
+ * in turn, so the liveness is found again until nothing more goes. Then
+ * the locals and temps that are left are packed together at the top of
+ * the frame.
+ */
+
+#include "optimizer.h"
+#include "cfg.h"
+#include "liveness.h"
+#include "ssa.h"
+#include "stats.h"
+#include "codegen.h"
+#include "utility.h"
+#include <map>
+#include <set>
+
+static bool CanRemove(Instruction *instr) {
+  if (instr->GetDst() == NULL || SSAForm::IsCall(instr))
+    return false;
+  BinaryOp *op = dynamic_cast<BinaryOp*>(instr);
+  return (op == NULL || (op->GetOpCode() != BinaryOp::Div &&
+                         op->GetOpCode() != BinaryOp::Mod));
+}
+
+/* Method: EliminateDeadCode
+ * -------------------------
+ * Each block is swept from the end, keeping track of what is live after
+ * the instruction at hand.
+ */
+void Optimizer::EliminateDeadCode() {
+  int numRemoved = 0;
+  for (bool changed = true; changed; ) {
+    changed = false;
+    Liveness &liveness = *GetLiveness();
+    for (size_t i = 0; i < graph->rpo.size(); i++) {
+      BasicBlock *b = graph->rpo[i];
+      std::vector<bool> live = liveness.liveOut[b->id];
+      for (size_t j = b->code.size(); j-- > 0; ) {
+        Instruction *instr = b->code[j];
+        if (CanRemove(instr) && !live[liveness.VarFor(instr->GetDst())]) {
+          b->code.erase(b->code.begin() + j);
+          delete instr;
+          numRemoved++;
+          changed = true;
+        } else {
+          liveness.Step(instr, &live);
+        }
+      }
+    }
+    if (changed)
+      InvalidateLiveness();
+  }
+
+  int oldSize, newSize;
+  CompactFrame(&oldSize, &newSize);
+  Stats::Count(Stats::DeadInstructions, numRemoved);
+  PrintDebug("opt", "%s: removed %d dead instructions, frame %d -> %d bytes",
+             name, numRemoved, oldSize, newSize);
+}
+
+/* Method: CompactFrame
+ * --------------------
+ * Gives the locals and temps still used new offsets, in the order of the
+ * old ones, from the first local down, and shrinks the frame to match.
+ */
+void Optimizer::CompactFrame(int *oldSize, int *newSize) {
+  std::set<Location*> locs;
+  std::map<int, int> offsets;                 // old to new
+  for (size_t b = 0; b < graph->blocks.size(); b++) {
+    std::vector<Instruction*> &code = graph->blocks[b]->code;
+    for (size_t j = 0; j < code.size(); j++) {
+      List<Location*> operands;
+      code[j]->GetSrcs(&operands);
+      if (code[j]->GetDst() != NULL)
+        operands.Append(code[j]->GetDst());
+      for (int o = 0; o < operands.NumElements(); o++) {
+        Location *loc = operands.Nth(o);
+        if (loc->GetSegment() == fpRelative && loc->GetOffset() < 0) {
+          locs.insert(loc);
+          offsets[loc->GetOffset()] = 0;
+        }
+      }
+    }
+  }
+
+  int next = CodeGenerator::OffsetToFirstLocal;
+  bool renumbered = false;
+  for (std::map<int, int>::reverse_iterator i = offsets.rbegin();
+       i != offsets.rend(); ++i) {
+    i->second = next;
+    renumbered = renumbered || (i->first != next);
+    next -= CodeGenerator::VarSize;
+  }
+  for (std::set<Location*>::iterator i = locs.begin(); i != locs.end(); ++i)
+    (*i)->SetOffset(offsets[(*i)->GetOffset()]);
+  if (renumbered)                             // the liveness goes by offset
+    InvalidateLiveness();
+
+  BeginFunc *begin = graph->GetBeginFunc();
+  *oldSize = begin->GetFrameSize();
+  *newSize = offsets.size() * CodeGenerator::VarSize;
+  begin->SetFrameSize(*newSize);
+}
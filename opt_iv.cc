@@ -0,0 +1,352 @@
+/* File: opt_iv.cc
+ * ---------------
+ * Strength reduction of induction variables (see optimizer.h).
+ *
+ * A basic induction variable of a loop is a local that the loop assigns
+ * only by adding a constant to it (i = i + 1). An array access a[i] in
+ * the loop computes the address a + (i * 4 + 4) with a multiply and two
+ * adds; as long as a doesn't change in the loop, that address goes up by
+ * the same amount each time i does. So it is kept in a variable of its
+ * own instead: set before the loop (in a new preheader, see cfg.h), and
+ * stepped right after i is, so that it always matches i. The reads of the
+ * address in its block read that variable instead, and the multiply and
+ * adds go away with dead code elimination.
+ *
+ * An unrolled loop (see ForStmt::EmitRotated) steps i once for each copy
+ * of the body, and the address along with it each time.
+ *
+ * Only the computations in the same block as the one reading i are
+ * followed, so that i can't have been stepped in between. The loop test
+ * is not rewritten in terms of the address: every a[i] is checked
+ * against the bounds of a using i, so i stays in use anyway.
+ */
+
+#include "optimizer.h"
+#include "cfg.h"
+#include "codegen.h"
+#include "stats.h"
+#include "utility.h"
+#include <map>
+#include <set>
+#include <tuple>
+
+typedef std::pair<int,int> VarKey;             // segment and offset
+
+static VarKey KeyFor(Location *loc) {
+  return VarKey(loc->GetSegment(), loc->GetOffset());
+}
+
+namespace {
+
+     // A value scale * iv + offset (+ base, if not NULL), where iv is a
+     // basic induction variable
+struct Affine {
+  Location *iv, *base;
+  int scale, offset;
+};
+
+     // The induction variable, scale, offset and base, by which the
+     // addresses that are kept in the same variable are known
+typedef std::tuple<VarKey, int, int, VarKey> AddressKey;
+
+struct Reduction {
+  Instruction *instr;                          // computes the address
+  Affine value;
+};
+
+class InductionReducer {
+  private:
+    CodeGenerator *cg;
+    FlowGraph *graph;
+    std::map<VarKey, int> constants;           // of the whole function
+    std::map<VarKey, int> numDefs;             // in the loop at hand
+    std::map<VarKey, std::vector<std::pair<Instruction*, int> > > steps;
+                                               // of each basic induction
+                                               // variable, by how much
+    bool hasCall;
+
+    bool IsConstant(Location *loc, int *value);
+    bool IsInvariant(Location *loc);
+    void FindConstants();
+    void FindInductionVariables(Loop *loop);
+    bool Derive(Instruction *instr, std::map<VarKey, Affine> &known,
+                Affine *value);
+    void ReadFrom(std::vector<Instruction*> *code, size_t start,
+                  Location *var, Location *addr);
+
+  public:
+    int numReduced;
+
+    InductionReducer(CodeGenerator *cg, FlowGraph *graph);
+    std::vector<Reduction> FindReductions(Loop *loop);
+    void Reduce(BasicBlock *pre, const std::vector<Reduction> &reductions);
+};
+
+InductionReducer::InductionReducer(CodeGenerator *c, FlowGraph *g) {
+  cg = c;
+  graph = g;
+  numReduced = 0;
+  hasCall = false;
+  FindConstants();
+}
+
+// The variables that are only ever loaded with the same constant
+void InductionReducer::FindConstants() {
+  std::set<VarKey> varying;
+  for (size_t i = 0; i < graph->rpo.size(); i++) {
+    BasicBlock *b = graph->rpo[i];
+    for (size_t j = 0; j < b->code.size(); j++) {
+      Instruction *instr = b->code[j];
+      if (instr->GetDst() == NULL)
+        continue;
+      VarKey key = KeyFor(instr->GetDst());
+      LoadConstant *lc = dynamic_cast<LoadConstant*>(instr);
+      if (lc == NULL || key.first == gpRelative ||
+          (constants.count(key) && constants[key] != lc->GetValue()))
+        varying.insert(key);
+      else
+        constants[key] = lc->GetValue();
+    }
+  }
+  for (std::set<VarKey>::iterator v = varying.begin(); v != varying.end(); ++v)
+    constants.erase(*v);
+}
+
+bool InductionReducer::IsConstant(Location *loc, int *value) {
+  std::map<VarKey, int>::iterator c = constants.find(KeyFor(loc));
+  if (c == constants.end())
+    return false;
+  *value = c->second;
+  return true;
+}
+
+bool InductionReducer::IsInvariant(Location *loc) {
+  return numDefs[KeyFor(loc)] == 0 &&
+    !(hasCall && loc->GetSegment() == gpRelative);
+}
+
+void InductionReducer::FindInductionVariables(Loop *loop) {
+  numDefs.clear();
+  steps.clear();
+  hasCall = false;
+  for (size_t i = 0; i < loop->blocks.size(); i++) {
+    BasicBlock *b = loop->blocks[i];
+    for (size_t j = 0; j < b->code.size(); j++) {
+      Instruction *instr = b->code[j];
+      if (instr->GetDst() != NULL)
+        numDefs[KeyFor(instr->GetDst())]++;
+      if (dynamic_cast<LCall*>(instr) || dynamic_cast<ACall*>(instr))
+        hasCall = true;
+    }
+  }
+  for (size_t i = 0; i < loop->blocks.size(); i++) {
+    BasicBlock *b = loop->blocks[i];
+    for (size_t j = 0; j < b->code.size(); j++) {
+      BinaryOp *op = dynamic_cast<BinaryOp*>(b->code[j]);
+      if (op == NULL || op->GetDst()->GetSegment() == gpRelative)
+        continue;
+      VarKey iv = KeyFor(op->GetDst());
+      int step;
+      if (op->GetOpCode() == BinaryOp::Add && KeyFor(op->GetOp1()) == iv &&
+          IsConstant(op->GetOp2(), &step))
+        steps[iv].push_back(std::make_pair(op, step));
+      else if (op->GetOpCode() == BinaryOp::Add && KeyFor(op->GetOp2()) == iv &&
+               IsConstant(op->GetOp1(), &step))
+        steps[iv].push_back(std::make_pair(op, step));
+      else if (op->GetOpCode() == BinaryOp::Sub && KeyFor(op->GetOp1()) == iv &&
+               IsConstant(op->GetOp2(), &step))
+        steps[iv].push_back(std::make_pair(op, -step));
+    }
+  }
+  // An unrolled loop steps i once for each copy of the body, but i is
+  // not an induction variable if anything else assigns it
+  for (std::map<VarKey, std::vector<std::pair<Instruction*, int> > >::iterator
+         s = steps.begin(); s != steps.end(); )
+    if ((int)s->second.size() != numDefs[s->first])
+      steps.erase(s++);
+    else
+      ++s;
+}
+
+/* Method: Derive
+ * --------------
+ * Works out whether instr computes an affine function of an induction
+ * variable from the values known so far in its block.
+ */
+bool InductionReducer::Derive(Instruction *instr, std::map<VarKey, Affine> &known,
+                              Affine *value) {
+  BinaryOp *op = dynamic_cast<BinaryOp*>(instr);
+  if (op == NULL || steps.count(KeyFor(op->GetDst())))
+    return false;
+  Location *a = op->GetOp1(), *b = op->GetOp2();
+  int c;
+  for (int swap = 0; swap < 2; swap++, std::swap(a, b)) {
+    std::map<VarKey, Affine>::iterator k = known.find(KeyFor(a));
+    if (op->GetOpCode() == BinaryOp::Mul && steps.count(KeyFor(a)) &&
+        IsConstant(b, &c)) {
+      Affine v = {a, NULL, c, 0};
+      *value = v;
+      return true;
+    }
+    if (op->GetOpCode() != BinaryOp::Add || k == known.end() ||
+        k->second.base != NULL)
+      continue;
+    *value = k->second;
+    if (IsConstant(b, &c)) {
+      value->offset += c;
+      return true;
+    }
+    if (IsInvariant(b)) {
+      value->base = b;
+      return true;
+    }
+  }
+  return false;
+}
+
+std::vector<Reduction> InductionReducer::FindReductions(Loop *loop) {
+  std::vector<Reduction> reductions;
+  FindInductionVariables(loop);
+  if (steps.empty())
+    return reductions;
+  for (size_t i = 0; i < loop->blocks.size(); i++) {
+    BasicBlock *b = loop->blocks[i];
+    std::map<VarKey, Affine> known;
+    for (size_t j = 0; j < b->code.size(); j++) {
+      Instruction *instr = b->code[j];
+      Location *dst = instr->GetDst();
+      if (dst == NULL)
+        continue;
+      Affine value;
+      bool derived = Derive(instr, known, &value);
+      VarKey key = KeyFor(dst);
+      known.erase(key);
+      for (std::map<VarKey, Affine>::iterator k = known.begin(); k != known.end(); )
+        if (KeyFor(k->second.iv) == key)
+          known.erase(k++);
+        else
+          ++k;
+      if (!derived || key.first == gpRelative || numDefs[key] != 1)
+        continue;
+      if (value.base == NULL) {
+        known[key] = value;
+      } else {
+        Reduction r = {instr, value};
+        reductions.push_back(r);
+      }
+    }
+  }
+  return reductions;
+}
+
+/* Method: Reduce
+ * --------------
+ * Sets up a variable for each address (those that are the same share
+ * one) in pre, steps it after its induction variable, and makes each
+ * computation of the address a copy of it.
+ */
+void InductionReducer::Reduce(BasicBlock *pre, const std::vector<Reduction> &reductions) {
+  std::map<AddressKey, Location*> addresses;
+  for (size_t r = 0; r < reductions.size(); r++) {
+    const Affine &v = reductions[r].value;
+    AddressKey key(KeyFor(v.iv), v.scale, v.offset, KeyFor(v.base));
+    Location *addr = addresses[key];
+    if (addr == NULL) {
+      addr = addresses[key] = cg->GenTempVar();
+      Location *scale = cg->GenTempVar(), *offset = cg->GenTempVar();
+      Location *scaled = cg->GenTempVar(), *sum = cg->GenTempVar();
+      pre->code.push_back(new LoadConstant(scale, v.scale));
+      pre->code.push_back(new BinaryOp(BinaryOp::Mul, scaled, v.iv, scale));
+      pre->code.push_back(new LoadConstant(offset, v.offset));
+      pre->code.push_back(new BinaryOp(BinaryOp::Add, sum, scaled, offset));
+      pre->code.push_back(new BinaryOp(BinaryOp::Add, addr, v.base, sum));
+
+      std::vector<std::pair<Instruction*, int> > &ivSteps = steps[KeyFor(v.iv)];
+      std::map<int, Location*> deltas;
+      for (size_t s = 0; s < ivSteps.size(); s++) {
+        Location *&delta = deltas[ivSteps[s].second];
+        if (delta == NULL) {
+          delta = cg->GenTempVar();
+          pre->code.push_back(new LoadConstant(delta, v.scale * ivSteps[s].second));
+        }
+        for (size_t b = 0; b < graph->blocks.size(); b++) {
+          std::vector<Instruction*> &code = graph->blocks[b]->code;
+          for (size_t j = 0; j < code.size(); j++)
+            if (code[j] == ivSteps[s].first) {
+              code.insert(code.begin() + j + 1,
+                          new BinaryOp(BinaryOp::Add, addr, addr, delta));
+              break;
+            }
+        }
+      }
+    }
+
+    Instruction *instr = reductions[r].instr;
+    for (size_t b = 0; b < graph->blocks.size(); b++) {
+      std::vector<Instruction*> &code = graph->blocks[b]->code;
+      for (size_t j = 0; j < code.size(); j++)
+        if (code[j] == instr) {
+          code[j] = new Assign(instr->GetDst(), addr);
+          ReadFrom(&code, j + 1, instr->GetDst(), addr);
+          delete instr;
+          numReduced++;
+          break;
+        }
+    }
+  }
+}
+
+// Makes the reads of var from code[start] on read addr instead, up to
+// where either is assigned, so that the copy of addr into var is left
+// for dead code elimination
+void InductionReducer::ReadFrom(std::vector<Instruction*> *code, size_t start,
+                                Location *var, Location *addr) {
+  for (size_t j = start; j < code->size(); j++) {
+    Instruction *instr = (*code)[j];
+    List<Location*> srcs, newSrcs;
+    instr->GetSrcs(&srcs);
+    bool reads = false;
+    for (int s = 0; s < srcs.NumElements(); s++) {
+      reads = reads || KeyFor(srcs.Nth(s)) == KeyFor(var);
+      newSrcs.Append(KeyFor(srcs.Nth(s)) == KeyFor(var) ? addr : srcs.Nth(s));
+    }
+    if (reads)
+      instr->SetSrcs(&newSrcs);
+    Location *dst = instr->GetDst();
+    if (dst != NULL && (KeyFor(dst) == KeyFor(var) || KeyFor(dst) == KeyFor(addr)))
+      return;
+  }
+}
+
+} // namespace
+
+void Optimizer::ReduceInductions() {
+  InductionReducer reducer(cg, graph);
+  int numLoops = 0;
+  std::set<BasicBlock*> done;
+  graph->ComputeDominators();
+  for (bool changed = true; changed; ) {
+    changed = false;
+    std::vector<Loop> loops = graph->FindLoops();
+    for (size_t l = 0; l < loops.size() && !changed; l++) {
+      if (done.count(loops[l].header))
+        continue;
+      done.insert(loops[l].header);
+      std::vector<Reduction> reductions = reducer.FindReductions(&loops[l]);
+      if (reductions.empty())
+        continue;
+      BasicBlock *pre = InsertPreheader(&loops[l]);
+      if (pre == NULL)
+        continue;
+      reducer.Reduce(pre, reductions);
+      numLoops++;
+      changed = true;
+    }
+  }
+  if (numLoops > 0)
+    InvalidateLiveness();
+
+  Stats::Count(Stats::AddressesReduced, reducer.numReduced);
+  PrintDebug("opt", "%s: reduced %d addresses in %d loops",
+             name, reducer.numReduced, numLoops);
+}
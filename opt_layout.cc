@@ -0,0 +1,68 @@
+/* File: opt_layout.cc
+ * -------------------
+ * Static block layout (see optimizer.h).
+ *
+ * Each array access is checked against the bounds of the array, and
+ * each NewArray against a negative size, by a test that branches over
+ * a block that prints the runtime error and calls _Halt. That block is
+ * all but never run, yet it sits in the middle of the code, so the test
+ * has to branch every time to get past it (and in a loop, the check is
+ * made each time around). So the branch is turned the other way (IfZ
+ * becomes IfNZ, and vice versa), to go to the error block, which is
+ * moved out of line to the end of the function, and the code that is
+ * run falls through from the test to what follows it. With the label
+ * after the error block no longer branched to, the targets also carry
+ * on from the test as if it were part of the same block.
+ *
+ * The loops were already laid out with the test at the bottom, branching
+ * back to the top (see LoopStmt in ast_stmt.h), so that is the likely
+ * way of their branches too.
+ */
+
+#include "optimizer.h"
+#include "cfg.h"
+#include "codegen.h"
+#include "stats.h"
+#include "utility.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Returns whether b does nothing but report an error and stop
+static bool IsCold(BasicBlock *b) {
+  LCall *call = dynamic_cast<LCall*>(b->GetBranch());
+  return call != NULL && strcmp(call->GetLabel(), "_Halt") == 0;
+}
+
+/* Method: LayOutBlocks
+ * --------------------
+ * Looks for an IfZ whose fallthrough is a cold block reached from
+ * nowhere else, and whose target comes right after that block.
+ */
+void Optimizer::LayOutBlocks() {
+  int numMoved = 0;
+  size_t end = graph->blocks.size();            // the blocks moved go after
+  for (size_t b = 0; b + 2 < end; b++) {
+    BasicBlock *test = graph->blocks[b];
+    BasicBlock *cold = graph->blocks[b + 1];
+    IfZ *ifz = dynamic_cast<IfZ*>(test->GetBranch());
+    if (ifz == NULL || !IsCold(cold) || cold->preds.size() != 1 ||
+        graph->BlockForLabel(ifz->GetLabel()) != graph->blocks[b + 2])
+      continue;
+
+    char *label = cg->NewLabel();
+    graph->AddLabel(cold, label);
+    test->code.back() = new IfZ(ifz->GetTest(), label, !ifz->IfNonZero());
+    delete ifz;
+    free(label);
+    graph->MoveToEnd(cold);
+    end--;
+    numMoved++;
+  }
+  if (numMoved > 0) {
+    graph->Rebuild();
+    InvalidateLiveness();
+  }
+
+  Stats::Count(Stats::BlocksMoved, numMoved);
+  PrintDebug("opt", "%s: moved %d error blocks out of line", name, numMoved);
+}
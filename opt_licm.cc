@@ -0,0 +1,219 @@
+/* File: opt_licm.cc
+ * -----------------
+ * Loop-invariant code motion (see optimizer.h).
+ *
+ * The loops are the natural loops of the flow graph (see cfg.h). The
+ * blocks ending in _Halt, such as those reporting a bad array subscript,
+ * can't get back to the header, so they are outside of them.
+ *
+ * An instruction in a loop is invariant if its operands are: assigned
+ * nowhere in the loop (globals not even by a call), or only by an
+ * invariant instruction. Such an instruction is moved to a new block run
+ * just before the loop (its preheader) if
+ *
+ *   - it is the only assignment to its dst in the loop, and its dst is
+ *     neither a global nor live on the way into the loop, so that no
+ *     read can tell it was moved;
+ *   - it can't trap, or else it would have been run on every way out of
+ *     the loop anyway (i.e. its block dominates them): a Load could read
+ *     through a null or bad pointer, and a Div or Mod by zero;
+ *   - for a Load, nothing in the loop may write memory (no Store or call).
+ *
+ * A LoadConstant read by a Mul, Div or Mod that stays in the loop is
+ * copied to the preheader rather than moved, so that the Mips code still
+ * sees the constant operand in the same block (see mips.cc).
+ *
+ * A loop is left by its test (at the bottom, see LoopStmt in ast_stmt.h),
+ * so the loads that qualify are mostly those in the test, such as the
+ * length in i < a.length(). The inner
+ * loops are done first, so what is moved out of one can move on out of
+ * the loop around it.
+ */
+
+#include "optimizer.h"
+#include "cfg.h"
+#include "liveness.h"
+#include "ssa.h"
+#include "stats.h"
+#include "utility.h"
+#include <algorithm>
+#include <map>
+#include <set>
+
+typedef std::pair<int,int> VarKey;             // segment and offset
+
+static VarKey KeyFor(Location *loc) {
+  return VarKey(loc->GetSegment(), loc->GetOffset());
+}
+
+static bool CanTrap(Instruction *instr) {
+  BinaryOp *op = dynamic_cast<BinaryOp*>(instr);
+  return dynamic_cast<Load*>(instr) != NULL ||
+    (op != NULL && (op->GetOpCode() == BinaryOp::Div ||
+                    op->GetOpCode() == BinaryOp::Mod));
+}
+
+static bool CanMove(Instruction *instr) {
+  return dynamic_cast<LoadConstant*>(instr) != NULL ||
+    dynamic_cast<LoadStringConstant*>(instr) != NULL ||
+    dynamic_cast<LoadLabel*>(instr) != NULL ||
+    dynamic_cast<Assign*>(instr) != NULL ||
+    dynamic_cast<BinaryOp*>(instr) != NULL ||
+    dynamic_cast<Load*>(instr) != NULL;
+}
+
+/* Function: FindInvariants
+ * ------------------------
+ * Returns the instructions of the loop that can be moved out of it, in
+ * an order they can run in. liveIn is what is live into its header.
+ */
+static std::vector<Instruction*> FindInvariants(Loop &loop, Liveness &liveness,
+                                               std::vector<bool> &liveIn) {
+  std::map<VarKey, int> numDefs;
+  bool hasCall = false, writesMemory = false;
+  std::vector<BasicBlock*> exits;
+  for (size_t i = 0; i < loop.blocks.size(); i++) {
+    BasicBlock *b = loop.blocks[i];
+    for (size_t j = 0; j < b->code.size(); j++) {
+      Instruction *instr = b->code[j];
+      if (instr->GetDst() != NULL)
+        numDefs[KeyFor(instr->GetDst())]++;
+      if (SSAForm::IsCall(instr))
+        hasCall = writesMemory = true;
+      if (dynamic_cast<Store*>(instr) != NULL)
+        writesMemory = true;
+    }
+    bool isExit = b->succs.empty();
+    for (size_t s = 0; s < b->succs.size(); s++)
+      if (!loop.inLoop[b->succs[s]->id])
+        isExit = true;
+    if (isExit)
+      exits.push_back(b);
+  }
+
+  std::set<Instruction*> invariant;
+  std::vector<Instruction*> order;
+  for (bool changed = true; changed; ) {
+    changed = false;
+    for (size_t i = 0; i < loop.blocks.size(); i++) {
+      BasicBlock *b = loop.blocks[i];
+      bool runsEveryTime = true;
+      for (size_t e = 0; e < exits.size(); e++)
+        runsEveryTime = runsEveryTime && b->Dominates(exits[e]);
+      for (size_t j = 0; j < b->code.size(); j++) {
+        Instruction *instr = b->code[j];
+        Location *dst = instr->GetDst();
+        if (invariant.count(instr) || !CanMove(instr) ||
+            dst->GetSegment() == gpRelative || numDefs[KeyFor(dst)] != 1 ||
+            liveIn[liveness.VarFor(dst)] ||
+            (CanTrap(instr) && !runsEveryTime) ||
+            (dynamic_cast<Load*>(instr) != NULL && writesMemory))
+          continue;
+        List<Location*> srcs;
+        instr->GetSrcs(&srcs);
+        bool operandsInvariant = true;
+        for (int s = 0; s < srcs.NumElements(); s++) {
+          Location *src = srcs.Nth(s);
+          if (numDefs[KeyFor(src)] != 0 ||
+              (hasCall && src->GetSegment() == gpRelative))
+            operandsInvariant = false;
+        }
+        if (!operandsInvariant)
+          continue;
+        invariant.insert(instr);
+        order.push_back(instr);
+        numDefs[KeyFor(dst)] = 0;              // as it is assigned before
+        changed = true;
+      }
+    }
+  }
+  return order;
+}
+
+// The operands of the Mul, Div and Mod instructions staying in the loop
+static std::set<VarKey> FindMultiplierVars(Loop &loop,
+                                           std::set<Instruction*> &isMoved) {
+  std::set<VarKey> vars;
+  for (size_t i = 0; i < loop.blocks.size(); i++) {
+    std::vector<Instruction*> &code = loop.blocks[i]->code;
+    for (size_t j = 0; j < code.size(); j++) {
+      BinaryOp *op = dynamic_cast<BinaryOp*>(code[j]);
+      if (op == NULL || isMoved.count(op) ||
+          (op->GetOpCode() != BinaryOp::Mul &&
+           op->GetOpCode() != BinaryOp::Div &&
+           op->GetOpCode() != BinaryOp::Mod))
+        continue;
+      List<Location*> srcs;
+      op->GetSrcs(&srcs);
+      for (int s = 0; s < srcs.NumElements(); s++)
+        vars.insert(KeyFor(srcs.Nth(s)));
+    }
+  }
+  return vars;
+}
+
+/* Method: HoistInvariants
+ * ------------------------
+ * The loops and liveness are found once, before anything is moved.
+ * Moving code out of a loop only changes what is live between the new
+ * preheader and the header: the dst of what is moved isn't live into
+ * the header, so each read of it was already after its assignment. So
+ * what is live into the headers stays right, and a preheader only has
+ * to be added to the loops around the one it was made for. The block
+ * ids shift with each preheader, so inLoop is marked again each time.
+ */
+void Optimizer::HoistInvariants() {
+  int numHoisted = 0, numLoops = 0;
+  graph->ComputeDominators();
+  std::vector<Loop> loops = graph->FindLoops();
+  Liveness &liveness = *GetLiveness();
+  std::vector<std::vector<bool> > headerLiveIn;
+  for (size_t l = 0; l < loops.size(); l++)
+    headerLiveIn.push_back(liveness.liveIn[loops[l].header->id]);
+
+  for (size_t l = 0; l < loops.size(); l++) {
+    Loop &loop = loops[l];
+    loop.inLoop.assign(graph->blocks.size(), false);
+    for (size_t i = 0; i < loop.blocks.size(); i++)
+      loop.inLoop[loop.blocks[i]->id] = true;
+    std::vector<Instruction*> moved =
+      FindInvariants(loop, liveness, headerLiveIn[l]);
+    if (moved.empty())
+      continue;
+    BasicBlock *pre = InsertPreheader(&loop);
+    if (pre == NULL)
+      continue;
+    for (size_t o = l + 1; o < loops.size(); o++) {
+      std::vector<BasicBlock*> &blocks = loops[o].blocks;
+      std::vector<BasicBlock*>::iterator h =
+        std::find(blocks.begin(), blocks.end(), loop.header);
+      if (h != blocks.end())
+        blocks.insert(h, pre);
+    }
+
+    std::set<Instruction*> isMoved(moved.begin(), moved.end());
+    std::set<VarKey> divisors = FindMultiplierVars(loop, isMoved);
+    for (size_t i = 0; i < moved.size(); i++) {
+      LoadConstant *lc = dynamic_cast<LoadConstant*>(moved[i]);
+      if (lc != NULL && divisors.count(KeyFor(lc->GetDst()))) {
+        isMoved.erase(lc);
+        moved[i] = new LoadConstant(lc->GetDst(), lc->GetValue());
+      }
+    }
+    for (size_t i = 0; i < loop.blocks.size(); i++) {
+      std::vector<Instruction*> &code = loop.blocks[i]->code;
+      for (size_t j = code.size(); j-- > 0; )
+        if (isMoved.count(code[j]))
+          code.erase(code.begin() + j);
+    }
+    pre->code.insert(pre->code.end(), moved.begin(), moved.end());
+    numHoisted += moved.size();
+    numLoops++;
+  }
+  if (numLoops > 0)
+    InvalidateLiveness();
+
+  Stats::Count(Stats::InstructionsHoisted, numHoisted);
+  PrintDebug("opt", "%s: hoisted %d instructions out of %d loops",
+             name, numHoisted, numLoops);
+}
@@ -0,0 +1,350 @@
+/* File: opt_lvn.cc
+ * ----------------
+ * Value numbering (see optimizer.h).
+ *
+ * Each value computed gets a number, and each expression is known by its
+ * operator and the numbers of its operands, so an expression that was
+ * computed before (and is still held by some variable) can be replaced
+ * by a copy of that variable. Constants are numbered too, so that the
+ * same expression on two temps loaded with the same constant matches.
+ *
+ * The numbering is carried from a block into each successor that has no
+ * other pred (i.e. over extended basic blocks), since nothing can happen
+ * in between. Going in by the edge an IfZ takes (or an IfNZ doesn't) also
+ * tells that its test was zero, so a later test of the same value (such as the bounds
+ * check of a repeated a[i]) is decided at compile time. Only values held
+ * by a variable assigned in the same block are copied, though: the Mips
+ * target keeps nothing in registers from one block to the next, so a
+ * copy from an earlier block has to load it, which costs more than most
+ * computations.
+ *
+ * Loads are known by the address they read, and are all forgotten at
+ * each Store and call, any of which may write the memory read (a Store
+ * does tell what is at its own address afterwards, though). Calls also
+ * give the globals new values.
+ */
+
+#include "optimizer.h"
+#include "cfg.h"
+#include "stats.h"
+#include "utility.h"
+#include <map>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+/* Class: ScopedMap
+ * ----------------
+ * A map that logs its changes, so that the state at the end of a block
+ * can be given to each of its successors in turn: going back to a mark
+ * undoes everything set since.
+ */
+template <class K, class V>
+class ScopedMap {
+  private:
+    std::map<K, V> map;
+    std::vector<std::pair<K, std::pair<bool, V> > > undo;  // old entries
+
+  public:
+    bool Lookup(const K &key, V *value) {
+      typename std::map<K, V>::iterator i = map.find(key);
+      if (i == map.end())
+        return false;
+      *value = i->second;
+      return true;
+    }
+    void Set(const K &key, const V &value) {
+      typename std::map<K, V>::iterator i = map.find(key);
+      if (i == map.end()) {
+        undo.push_back(std::make_pair(key, std::make_pair(false, V())));
+        map[key] = value;
+      } else {
+        undo.push_back(std::make_pair(key, std::make_pair(true, i->second)));
+        i->second = value;
+      }
+    }
+    size_t Mark() { return undo.size(); }
+    void Restore(size_t mark) {
+      for (; undo.size() > mark; undo.pop_back()) {
+        if (undo.back().second.first)
+          map[undo.back().first] = undo.back().second.second;
+        else
+          map.erase(undo.back().first);
+      }
+    }
+};
+
+typedef enum { ConstExpr, BinaryExpr, LoadExpr } ExprKind;
+
+     // A variable by segment and offset, plus the generation of the
+     // globals (0 for the others), which goes up at each call
+typedef std::tuple<int, int, int> VarKey;
+     // The kind, the op code, constant or offset, and the operand values;
+     // loads also have the generation of memory, which goes up at each
+     // Store or call
+typedef std::tuple<int, int, int, int, int> ExprKey;
+
+class ValueNumberer {
+  private:
+    FlowGraph *graph;
+    int nextValue;
+    int globalGen, memoryGen;
+    ScopedMap<VarKey, int> varValue;
+    ScopedMap<ExprKey, int> exprValue;
+    ScopedMap<int, std::pair<Location*, BasicBlock*> > holder;
+                                             // a variable with the value,
+                                             // and where it was assigned
+    BasicBlock *current;
+    ScopedMap<int, int> constant;            // values known to be constant
+
+    VarKey KeyFor(Location *loc);
+    int ValueOf(Location *loc);
+    void SetValue(Location *loc, int value);
+    Location *HolderOf(int value);
+    int NewValue()                      { return nextValue++; }
+    bool Reuse(BasicBlock *b, size_t *j, ExprKey key);
+    void NumberBlock(BasicBlock *b);
+
+  public:
+    int numReused, numBranches;
+
+    ValueNumberer(FlowGraph *graph);
+    void Run();
+};
+
+ValueNumberer::ValueNumberer(FlowGraph *g) {
+  graph = g;
+  current = NULL;
+  nextValue = 0;
+  globalGen = memoryGen = 0;
+  numReused = numBranches = 0;
+}
+
+VarKey ValueNumberer::KeyFor(Location *loc) {
+  return VarKey(loc->GetSegment(), loc->GetOffset(),
+                loc->GetSegment() == gpRelative ? globalGen : 0);
+}
+
+int ValueNumberer::ValueOf(Location *loc) {
+  int value;
+  if (!varValue.Lookup(KeyFor(loc), &value)) {
+    value = NewValue();
+    SetValue(loc, value);
+  }
+  return value;
+}
+
+void ValueNumberer::SetValue(Location *loc, int value) {
+  varValue.Set(KeyFor(loc), value);
+  if (HolderOf(value) == NULL)
+    holder.Set(value, std::make_pair(loc, current));
+}
+
+// Returns a variable that was assigned value in the current block and
+// still holds it, or NULL
+Location *ValueNumberer::HolderOf(int value) {
+  std::pair<Location*, BasicBlock*> h;
+  int held;
+  if (holder.Lookup(value, &h) && h.second == current &&
+      varValue.Lookup(KeyFor(h.first), &held) && held == value)
+    return h.first;
+  return NULL;
+}
+
+/* Method: Reuse
+ * -------------
+ * Numbers the result of the instruction at *j, which computes the
+ * expression key. If it was computed before, the instruction is deleted
+ * if its dst still holds the value (and *j is moved back), or else is
+ * replaced by a copy of a variable given the value in this block, if
+ * any. Returns whether it was either.
+ */
+bool ValueNumberer::Reuse(BasicBlock *b, size_t *j, ExprKey key) {
+  Instruction *instr = b->code[*j];
+  Location *dst = instr->GetDst();
+  int value;
+  if (!exprValue.Lookup(key, &value)) {
+    value = NewValue();
+    exprValue.Set(key, value);
+    SetValue(dst, value);
+    return false;
+  }
+  int held;
+  Location *loc = HolderOf(value);
+  if (varValue.Lookup(KeyFor(dst), &held) && held == value) {
+    b->code.erase(b->code.begin() + (*j)--);
+  } else if (loc != NULL) {
+    b->code[*j] = new Assign(dst, loc);
+    SetValue(dst, value);
+  } else {
+    SetValue(dst, value);
+    return false;
+  }
+  delete instr;
+  return true;
+}
+
+void ValueNumberer::NumberBlock(BasicBlock *b) {
+  current = b;
+  for (size_t j = 0; j < b->code.size(); j++) {
+    Instruction *instr = b->code[j];
+    if (LoadConstant *lc = dynamic_cast<LoadConstant*>(instr)) {
+      // a LoadConstant is as cheap as a copy, so it is dropped if its dst
+      // already holds the constant, and otherwise only made a copy of a
+      // variable given the constant in this block, which copy propagation
+      // can then take out (as in the steps of an unrolled loop)
+      ExprKey key(ConstExpr, lc->GetValue(), 0, 0, 0);
+      int value, held;
+      if (exprValue.Lookup(key, &value) &&
+          varValue.Lookup(KeyFor(lc->GetDst()), &held) && held == value) {
+        b->code.erase(b->code.begin() + j--);
+        delete instr;
+        numReused++;
+        continue;
+      }
+      Location *loc;
+      if (exprValue.Lookup(key, &value) && (loc = HolderOf(value)) != NULL) {
+        b->code[j] = new Assign(lc->GetDst(), loc);
+        SetValue(lc->GetDst(), value);
+        delete instr;
+        numReused++;
+        continue;
+      }
+      if (!exprValue.Lookup(key, &value)) {
+        value = NewValue();
+        exprValue.Set(key, value);
+        constant.Set(value, lc->GetValue());
+      }
+      SetValue(lc->GetDst(), value);
+    } else if (BinaryOp *op = dynamic_cast<BinaryOp*>(instr)) {
+      int a = ValueOf(op->GetOp1()), c = ValueOf(op->GetOp2());
+      BinaryOp::OpCode code = op->GetOpCode();
+      bool commutes = (code == BinaryOp::Add || code == BinaryOp::Mul ||
+                       code == BinaryOp::Eq || code == BinaryOp::And ||
+                       code == BinaryOp::Or);
+      if (commutes && a > c)
+        std::swap(a, c);
+      if (Reuse(b, &j, ExprKey(BinaryExpr, code, a, c, 0)))
+        numReused++;
+    } else if (Load *load = dynamic_cast<Load*>(instr)) {
+      int addr = ValueOf(load->GetSrc());
+      if (Reuse(b, &j, ExprKey(LoadExpr, load->GetOffset(), addr, 0, memoryGen)))
+        numReused++;
+    } else if (Store *store = dynamic_cast<Store*>(instr)) {
+      int addr = ValueOf(store->GetAddr()), value = ValueOf(store->GetSrc());
+      memoryGen = NewValue();
+      exprValue.Set(ExprKey(LoadExpr, store->GetOffset(), addr, 0, memoryGen), value);
+    } else if (Assign *assign = dynamic_cast<Assign*>(instr)) {
+      int value = ValueOf(assign->GetSrc()), held;
+      if (varValue.Lookup(KeyFor(assign->GetDst()), &held) && held == value) {
+        b->code.erase(b->code.begin() + j--);
+        delete instr;
+        numReused++;
+        continue;
+      }
+      SetValue(assign->GetDst(), value);
+    } else if (IfZ *ifz = dynamic_cast<IfZ*>(instr)) {
+      int test;
+      if (!constant.Lookup(ValueOf(ifz->GetTest()), &test))
+        continue;
+      if (ifz->IsTakenFor(test))
+        b->code[j] = new Goto(ifz->GetLabel());
+      else
+        b->code.erase(b->code.begin() + j--);
+      delete instr;
+      numBranches++;
+    } else {
+      if (dynamic_cast<LCall*>(instr) != NULL || dynamic_cast<ACall*>(instr) != NULL) {
+        memoryGen = NewValue();
+        globalGen = NewValue();
+      }
+      if (instr->GetDst() != NULL)
+        SetValue(instr->GetDst(), NewValue());
+    }
+  }
+}
+
+/* Method: Run
+ * -----------
+ * Each block that is not the only successor of another starts a tree of
+ * blocks that are, which is walked depth first. The marks taken before
+ * each block are what its changes are undone back to once the blocks
+ * below it are done, so that its siblings start from the same state.
+ */
+void ValueNumberer::Run() {
+  struct Frame {
+    BasicBlock *block;
+    size_t child;
+    size_t marks[4];
+    int globalGen, memoryGen;         // at the end of the block
+  };
+
+  for (size_t r = 0; r < graph->rpo.size(); r++) {
+    BasicBlock *root = graph->rpo[r];
+    if (root->preds.size() == 1)
+      continue;
+    std::vector<Frame> stack;
+    Frame top = { root, 0 };
+    stack.push_back(top);
+    int knownZero = -1;           // the value of the test on the way in
+    while (!stack.empty()) {
+      Frame &f = stack.back();
+      if (f.child == 0) {
+        f.marks[0] = varValue.Mark();
+        f.marks[1] = exprValue.Mark();
+        f.marks[2] = holder.Mark();
+        f.marks[3] = constant.Mark();
+        if (knownZero >= 0)
+          constant.Set(knownZero, 0);
+        NumberBlock(f.block);
+        f.globalGen = globalGen;
+        f.memoryGen = memoryGen;
+      }
+      BasicBlock *b = f.block;
+      while (f.child < b->succs.size() && b->succs[f.child]->preds.size() != 1)
+        f.child++;
+      if (f.child == b->succs.size()) {
+        varValue.Restore(f.marks[0]);
+        exprValue.Restore(f.marks[1]);
+        holder.Restore(f.marks[2]);
+        constant.Restore(f.marks[3]);
+        stack.pop_back();
+        continue;
+      }
+      BasicBlock *succ = b->succs[f.child++];
+      globalGen = f.globalGen;
+      memoryGen = f.memoryGen;
+      knownZero = -1;
+      IfZ *ifz = dynamic_cast<IfZ*>(b->GetBranch());
+      if (ifz != NULL && b->succs.size() == 2 &&
+          (succ == graph->BlockForLabel(ifz->GetLabel())) != ifz->IfNonZero())
+        knownZero = ValueOf(ifz->GetTest());
+      Frame next = { succ, 0 };
+      stack.push_back(next);
+    }
+  }
+}
+
+} // namespace
+
+
+/* Method: NumberValues
+ * --------------------
+ * Branches decided along the way are made unconditional or removed, as
+ * in PropagateConstants, and the graph is rebuilt to drop what they
+ * skip.
+ */
+void Optimizer::NumberValues() {
+  ValueNumberer numberer(graph);
+  numberer.Run();
+  if (numberer.numBranches > 0)
+    graph->Rebuild();
+  if (numberer.numReused > 0 || numberer.numBranches > 0)
+    InvalidateLiveness();
+
+  Stats::Count(Stats::ValuesReused, numberer.numReused);
+  Stats::Count(Stats::BranchesFolded, numberer.numBranches);
+  PrintDebug("opt", "%s: reused %d values and folded %d branches", name,
+             numberer.numReused, numberer.numBranches);
+}
@@ -0,0 +1,118 @@
+/* File: opt_saved.cc
+ * ------------------
+ * Picking the variables to keep in callee-saved registers (see
+ * optimizer.h).
+ *
+ * The Mips class keeps a variable in a register only until the next
+ * label, branch or call, where it writes it back to memory if it was
+ * assigned, and loads it again where it is next read, so a loop counter
+ * or a sum is loaded and stored again each time around its loop, and
+ * around each call. A variable can instead be kept for the whole of the
+ * function in a register that calls preserve, where it need not be
+ * loaded or stored at all. Saving and restoring that register costs a
+ * store and a load each time the function is called, though, so a
+ * variable is only kept if the loads and stores it would take otherwise
+ * add up to more than SaveCost: a load for each stretch of a block (up to
+ * or after a call) that reads it, and a store for each that assigns it,
+ * each counting LoopWeight times more for each loop around it. The blocks
+ * are counted as if each ran once a call, while a recursive function
+ * mostly returns by the way that makes no calls, so SaveCost is twice the
+ * store and load. There are only a few such registers, so the variables
+ * are then ranked by the loads and stores they save. Globals can't be
+ * kept, since the function called may use them.
+ */
+
+#include "optimizer.h"
+#include "cfg.h"
+#include "ssa.h"
+#include "stats.h"
+#include "utility.h"
+#include <algorithm>
+#include <map>
+
+static const int MaxSaved = 6,          // $s0-$s5, see mips.h
+                 LoopWeight = 8,
+                 SaveCost = 4;          // instructions, see above
+
+typedef std::pair<int,int> VarKey;      // segment and offset
+
+namespace {
+
+// The loads and stores a variable takes where it isn't kept
+struct Traffic {
+  Location *loc;
+  double count;                         // weighed by the loops around them
+  int readIn, assignedIn;               // the last stretches that did
+  Traffic() : loc(NULL), count(0), readIn(-1), assignedIn(-1) {}
+};
+
+// Orders the variables by traffic, heaviest first
+bool ByCount(const Traffic *a, const Traffic *b) {
+  return a->count > b->count;
+}
+
+} // namespace
+
+/* Method: PickSavedVars
+ * ---------------------
+ * Counts the loads and stores of each of the locals, temps and params,
+ * a stretch of each block at a time, and tells the BeginFunc the
+ * heaviest of those that are worth keeping.
+ */
+void Optimizer::PickSavedVars() {
+  graph->ComputeDominators();
+  std::vector<Loop> loops = graph->FindLoops();
+  std::vector<double> blockWeight(graph->blocks.size(), 1);
+  for (size_t l = 0; l < loops.size(); l++)
+    for (size_t i = 0; i < loops[l].blocks.size(); i++)
+      blockWeight[loops[l].blocks[i]->id] *= LoopWeight;
+
+  std::map<VarKey, Traffic> traffic;
+  int stretch = 0;
+  for (size_t b = 0; b < graph->blocks.size(); b++) {
+    BasicBlock *block = graph->blocks[b];
+    double weight = blockWeight[block->id];
+    stretch++;
+    for (size_t j = 0; j < block->code.size(); j++) {
+      Instruction *instr = block->code[j];
+      List<Location*> srcs;
+      instr->GetSrcs(&srcs);
+      for (int s = 0; s < srcs.NumElements(); s++) {
+        Location *loc = srcs.Nth(s);
+        Traffic &t = traffic[VarKey(loc->GetSegment(), loc->GetOffset())];
+        t.loc = loc;
+        if (t.readIn != stretch) {
+          t.count += weight;
+          t.readIn = stretch;
+        }
+      }
+      if (SSAForm::IsCall(instr))
+        stretch++;
+      if (Location *loc = instr->GetDst()) {
+        Traffic &t = traffic[VarKey(loc->GetSegment(), loc->GetOffset())];
+        t.loc = loc;
+        if (t.assignedIn != stretch) {
+          t.count += weight;
+          t.assignedIn = stretch;
+        }
+        t.readIn = stretch;             // it is in a register from here
+      }
+    }
+  }
+
+  std::vector<Traffic*> vars;
+  for (std::map<VarKey, Traffic>::iterator i = traffic.begin(); i != traffic.end(); ++i)
+    if (i->second.count > SaveCost && i->second.loc->GetSegment() == fpRelative)
+      vars.push_back(&i->second);
+  std::stable_sort(vars.begin(), vars.end(), ByCount);
+  if (vars.size() > (size_t)MaxSaved)
+    vars.resize(MaxSaved);
+
+  List<Location*> *saved = new List<Location*>;
+  for (size_t i = 0; i < vars.size(); i++)
+    saved->Append(vars[i]->loc);
+  graph->GetBeginFunc()->SetSavedVars(saved);
+  Stats::Count(Stats::VarsSaved, saved->NumElements());
+  PrintDebug("opt", "%s: keeping %d variables across calls", name,
+             saved->NumElements());
+}
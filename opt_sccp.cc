@@ -0,0 +1,256 @@
+/* File: opt_sccp.cc
+ * -----------------
+ * Sparse conditional constant propagation (Wegman and Zadeck), see
+ * optimizer.h.
+ *
+ * Each SSA Value starts out unknown (Top: no assignment to it has been
+ * seen to run yet) and can only go down, to a constant and then to
+ * varying (Bottom). The blocks are only looked at once an edge into them
+ * is found to be taken, so a branch on a constant keeps the code it
+ * skips from spoiling the values of the variables it assigns.
+ */
+
+#include "optimizer.h"
+#include "cfg.h"
+#include "ssa.h"
+#include "stats.h"
+#include "utility.h"
+
+namespace {
+
+struct Lattice {
+  typedef enum { Top, Const, Bottom } State;
+  State state;
+  int val;
+
+  Lattice(State s = Top, int v = 0) : state(s), val(v) {}
+  bool operator==(const Lattice &o) const {
+    return state == o.state && (state != Const || val == o.val);
+  }
+};
+
+Lattice Meet(Lattice a, Lattice b) {
+  if (a.state == Lattice::Top) return b;
+  if (b.state == Lattice::Top) return a;
+  if (a == b) return a;
+  return Lattice(Lattice::Bottom);
+}
+
+class ConstantPropagator {
+  private:
+    FlowGraph *graph;
+    SSAForm *ssa;
+    std::vector<Lattice> lattice;             // by Value
+    std::vector<bool> blockExecutable;        // by block id
+    std::vector<std::vector<bool> > edgeExecutable; // by block id, pred index
+    std::vector<std::vector<Instruction*> > instrUsers; // by Value
+    std::vector<std::vector<int> > phiUsers;  // by Value
+    std::map<Instruction*, BasicBlock*> blockOf;
+    std::vector<std::pair<BasicBlock*, BasicBlock*> > flowWork;
+    std::vector<int> ssaWork;
+
+    void Lower(int value, Lattice l);
+    void MarkEdge(BasicBlock *from, BasicBlock *to);
+    void VisitPhi(int phi);
+    void VisitInstruction(Instruction *instr, BasicBlock *b);
+    Lattice Evaluate(Instruction *instr);
+
+  public:
+    ConstantPropagator(FlowGraph *graph, SSAForm *ssa);
+    void Propagate();
+    Lattice ValueOf(int value)          { return lattice[value]; }
+    bool IsExecutable(BasicBlock *b)    { return blockExecutable[b->id]; }
+};
+
+ConstantPropagator::ConstantPropagator(FlowGraph *g, SSAForm *s) {
+  graph = g;
+  ssa = s;
+  lattice.resize(ssa->values.size());
+  instrUsers.resize(ssa->values.size());
+  phiUsers.resize(ssa->values.size());
+  blockExecutable.assign(graph->blocks.size(), false);
+  edgeExecutable.resize(graph->blocks.size());
+
+  for (size_t v = 0; v < ssa->values.size(); v++) {
+    SSAForm::Kind kind = ssa->values[v].kind;
+    if (kind == SSAForm::EntryValue || kind == SSAForm::CallValue)
+      lattice[v] = Lattice(Lattice::Bottom);
+  }
+  for (size_t i = 0; i < graph->rpo.size(); i++) {
+    BasicBlock *b = graph->rpo[i];
+    edgeExecutable[b->id].assign(b->preds.size(), false);
+    for (size_t p = 0; p < ssa->phis[b->id].size(); p++) {
+      int phi = ssa->phis[b->id][p];
+      for (size_t a = 0; a < ssa->values[phi].args.size(); a++)
+        phiUsers[ssa->values[phi].args[a]].push_back(phi);
+    }
+    for (size_t j = 0; j < b->code.size(); j++) {
+      Instruction *instr = b->code[j];
+      blockOf[instr] = b;
+      std::vector<int> &u = ssa->uses[instr];
+      for (size_t s = 0; s < u.size(); s++)
+        instrUsers[u[s]].push_back(instr);
+    }
+  }
+}
+
+void ConstantPropagator::Lower(int value, Lattice l) {
+  Lattice lowered = Meet(lattice[value], l);
+  if (lowered == lattice[value])
+    return;
+  lattice[value] = lowered;
+  ssaWork.push_back(value);
+}
+
+void ConstantPropagator::MarkEdge(BasicBlock *from, BasicBlock *to) {
+  flowWork.push_back(std::make_pair(from, to));
+}
+
+void ConstantPropagator::VisitPhi(int phi) {
+  SSAForm::Value &v = ssa->values[phi];
+  Lattice l;
+  for (size_t a = 0; a < v.args.size(); a++)
+    if (edgeExecutable[v.block->id][a])
+      l = Meet(l, lattice[v.args[a]]);
+  Lower(phi, l);
+}
+
+Lattice ConstantPropagator::Evaluate(Instruction *instr) {
+  std::vector<int> &u = ssa->uses[instr];
+  if (LoadConstant *lc = dynamic_cast<LoadConstant*>(instr))
+    return Lattice(Lattice::Const, lc->GetValue());
+  if (dynamic_cast<Assign*>(instr) != NULL)
+    return lattice[u[0]];
+  if (BinaryOp *op = dynamic_cast<BinaryOp*>(instr)) {
+    Lattice a = lattice[u[0]], b = lattice[u[1]];
+    if (a.state == Lattice::Bottom || b.state == Lattice::Bottom)
+      return Lattice(Lattice::Bottom);
+    if (a.state == Lattice::Top || b.state == Lattice::Top)
+      return Lattice(Lattice::Top);
+    int result;
+    if (BinaryOp::Fold(op->GetOpCode(), a.val, b.val, &result))
+      return Lattice(Lattice::Const, result);
+  }
+  return Lattice(Lattice::Bottom);
+}
+
+void ConstantPropagator::VisitInstruction(Instruction *instr, BasicBlock *b) {
+  if (instr->GetDst() != NULL)
+    Lower(ssa->defs[instr], Evaluate(instr));
+
+  IfZ *ifz = dynamic_cast<IfZ*>(instr);
+  if (ifz == NULL)
+    return;
+  Lattice test = lattice[ssa->uses[instr][0]];
+  BasicBlock *taken = graph->BlockForLabel(ifz->GetLabel());
+  BasicBlock *next = graph->blocks[b->id + 1];
+  if (test.state == Lattice::Bottom) {
+    MarkEdge(b, taken);
+    MarkEdge(b, next);
+  } else if (test.state == Lattice::Const) {
+    MarkEdge(b, ifz->IsTakenFor(test.val) ? taken : next);
+  }
+}
+
+void ConstantPropagator::Propagate() {
+  BasicBlock *entry = graph->GetEntry();
+  blockExecutable[entry->id] = true;
+  for (size_t s = 0; s < entry->succs.size(); s++)
+    MarkEdge(entry, entry->succs[s]);
+
+  while (!flowWork.empty() || !ssaWork.empty()) {
+    if (!flowWork.empty()) {
+      BasicBlock *from = flowWork.back().first, *to = flowWork.back().second;
+      flowWork.pop_back();
+      int pred = to->PredIndex(from);
+      if (edgeExecutable[to->id][pred])
+        continue;
+      edgeExecutable[to->id][pred] = true;
+      for (size_t p = 0; p < ssa->phis[to->id].size(); p++)
+        VisitPhi(ssa->phis[to->id][p]);
+      if (blockExecutable[to->id])
+        continue;
+      blockExecutable[to->id] = true;
+      for (size_t j = 0; j < to->code.size(); j++)
+        VisitInstruction(to->code[j], to);
+      if (dynamic_cast<IfZ*>(to->GetBranch()) == NULL)
+        for (size_t s = 0; s < to->succs.size(); s++)
+          MarkEdge(to, to->succs[s]);
+    } else {
+      int value = ssaWork.back();
+      ssaWork.pop_back();
+      for (size_t i = 0; i < phiUsers[value].size(); i++) {
+        int phi = phiUsers[value][i];
+        if (blockExecutable[ssa->values[phi].block->id])
+          VisitPhi(phi);
+      }
+      for (size_t i = 0; i < instrUsers[value].size(); i++) {
+        Instruction *instr = instrUsers[value][i];
+        BasicBlock *b = blockOf[instr];
+        if (blockExecutable[b->id])
+          VisitInstruction(instr, b);
+      }
+    }
+  }
+}
+
+} // namespace
+
+
+/* Method: PropagateConstants
+ * --------------------------
+ * Once the values are known, each assignment of a constant value is
+ * replaced by a LoadConstant of it (which leaves the instructions that
+ * computed its operands for dead code elimination to take away), and
+ * each branch on a constant is made unconditional or removed. Rebuilding
+ * the graph then drops the blocks that were never reached.
+ */
+void Optimizer::PropagateConstants() {
+  graph->ComputeDominators();
+  SSAForm ssa(graph);
+  if (IsDebugOn("ssa")) {
+    printf("+++ (ssa): %s\n", name);
+    ssa.Print(stdout);
+  }
+  ConstantPropagator propagator(graph, &ssa);
+  propagator.Propagate();
+
+  int numFolded = 0, numBranches = 0;
+  for (size_t i = 0; i < graph->rpo.size(); i++) {
+    BasicBlock *b = graph->rpo[i];
+    if (!propagator.IsExecutable(b))
+      continue;
+    for (size_t j = 0; j < b->code.size(); j++) {
+      Instruction *instr = b->code[j];
+      if (instr->GetDst() != NULL && dynamic_cast<LoadConstant*>(instr) == NULL) {
+        Lattice l = propagator.ValueOf(ssa.defs[instr]);
+        if (l.state == Lattice::Const) {
+          b->code[j] = new LoadConstant(instr->GetDst(), l.val);
+          delete instr;
+          numFolded++;
+        }
+      } else if (IfZ *ifz = dynamic_cast<IfZ*>(instr)) {
+        Lattice test = propagator.ValueOf(ssa.uses[instr][0]);
+        if (test.state != Lattice::Const)
+          continue;
+        if (ifz->IsTakenFor(test.val)) {
+          b->code[j] = new Goto(ifz->GetLabel());
+        } else {
+          b->code.erase(b->code.begin() + j);
+          j--;
+        }
+        delete instr;
+        numBranches++;
+      }
+    }
+  }
+  if (numBranches > 0)
+    graph->Rebuild();
+  if (numFolded > 0 || numBranches > 0)
+    InvalidateLiveness();
+
+  Stats::Count(Stats::ConstantsFolded, numFolded);
+  Stats::Count(Stats::BranchesFolded, numBranches);
+  PrintDebug("opt", "%s: folded %d constants and %d branches", name,
+             numFolded, numBranches);
+}
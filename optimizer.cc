@@ -0,0 +1,65 @@
+/* File: optimizer.cc
+ * ------------------
+ * Implementation of the Optimizer class: setting up the flow graph and
+ * running the passes. The passes themselves are in opt_*.cc.
+ */
+
+#include "optimizer.h"
+#include "cfg.h"
+#include "codegen.h"
+#include "liveness.h"
+#include <stdlib.h>
+
+Optimizer::Optimizer(CodeGenerator *g, List<Instruction*> *c) {
+  cg = g;
+  code = c;
+  Label *label = dynamic_cast<Label*>(code->Nth(0));
+  Assert(label != NULL);
+  name = label->GetLabel();
+  graph = new FlowGraph(code);
+  liveness = NULL;
+}
+
+Optimizer::~Optimizer() {
+  delete liveness;
+  delete graph;
+}
+
+Liveness *Optimizer::GetLiveness() {
+  if (liveness == NULL)
+    liveness = new Liveness(graph);
+  return liveness;
+}
+
+void Optimizer::InvalidateLiveness() {
+  delete liveness;
+  liveness = NULL;
+}
+
+BasicBlock *Optimizer::InsertPreheader(Loop *loop) {
+  char *label = cg->NewLabel();
+  BasicBlock *pre = graph->InsertPreheader(loop->header, loop->inLoop, label);
+  free(label);
+  if (pre != NULL) {
+    graph->Rebuild();
+    graph->ComputeDominators();
+  }
+  return pre;
+}
+
+bool Optimizer::IsFunction(List<Instruction*> *code) {
+  return code->NumElements() >= 3 && dynamic_cast<Label*>(code->Nth(0)) != NULL &&
+    dynamic_cast<BeginFunc*>(code->Nth(1)) != NULL;
+}
+
+void Optimizer::Run() {
+  PropagateConstants();
+  NumberValues();
+  PropagateCopies();
+  HoistInvariants();
+  ReduceInductions();
+  EliminateDeadCode();
+  LayOutBlocks();
+  PickSavedVars();
+  graph->Linearize(code);
+}
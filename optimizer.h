@@ -0,0 +1,112 @@
+/* File: optimizer.h
+ * -----------------
+ * The Optimizer class rewrites the Tac of a function to do the same work
+ * in fewer (or cheaper) instructions, before it is handed to the Target.
+ * It is run on each function by CodeGenerator::FlushCode, unless the
+ * optimizations were turned off (dcc -O0).
+ *
+ * The code is first split into basic blocks (see cfg.h), then the passes
+ * run over those in turn:
+ *
+ *   PropagateConstants   sparse conditional constant propagation on the
+ *                        SSA form (see ssa.h): assignments whose value
+ *                        is always the same constant become LoadConstants,
+ *                        and branches on constants become Gotos (or go
+ *                        away), along with the code they made unreachable.
+ *
+ *   NumberValues         value numbering over extended basic blocks:
+ *                        a computation (or load) whose value is already
+ *                        held by some variable becomes a copy of it, and
+ *                        a test that was already made on the way to it
+ *                        is decided.
+ *
+ *   PropagateCopies      within each block, reads of the dst of a copy
+ *                        read its src instead, and a copy of a value that
+ *                        is not read again is folded into the instruction
+ *                        that computed it.
+ *
+ *   HoistInvariants      loop-invariant code motion: a computation whose
+ *                        operands don't change in a loop is moved to a
+ *                        block run once before it, if that is safe.
+ *
+ *   ReduceInductions     strength reduction: the address of a[i] in a loop
+ *                        that steps i by a constant is kept in a variable
+ *                        stepped along with i, rather than computed from
+ *                        i with a multiply each time.
+ *
+ *   EliminateDeadCode    removes the instructions whose only effect is to
+ *                        assign a variable that is not read afterwards
+ *                        (see liveness.h), then packs the locals and
+ *                        temps that are left into a smaller frame.
+ *
+ *   LayOutBlocks         moves the blocks that report a runtime error out
+ *                        of line to the end of the function, so that the
+ *                        tests in front of them fall through when they
+ *                        pass.
+ *
+ *   PickSavedVars        picks the variables that would otherwise be
+ *                        loaded and stored the most, for the target to
+ *                        keep in registers that calls preserve ($s0-$s5
+ *                        on MIPS) for the whole function.
+ *
+ * The passes that need to know what is live share one Liveness, which is
+ * only found again once a pass has changed the code.
+ *
+ * With -d opt, what each pass did to each function is reported on
+ * stdout, and with -d ssa the SSA form of each function is printed.
+ */
+
+#ifndef _H_optimizer
+#define _H_optimizer
+
+#include "list.h"
+#include "tac.h"
+class CodeGenerator;
+class BasicBlock;
+class FlowGraph;
+class Liveness;
+struct Loop;
+
+class Optimizer {
+  private:
+    CodeGenerator *cg;
+    List<Instruction*> *code;
+    FlowGraph *graph;
+    const char *name;             // of the function, for reports
+    Liveness *liveness;           // of the code as it is, or NULL
+
+    void PropagateConstants();
+    void NumberValues();
+    void PropagateCopies();
+    void HoistInvariants();
+    void ReduceInductions();
+    void EliminateDeadCode();
+    void CompactFrame(int *oldSize, int *newSize);
+    void LayOutBlocks();
+    void PickSavedVars();
+
+         // Returns what is live in the graph (see liveness.h), found again
+         // only if a pass has changed the code since it was last found
+    Liveness *GetLiveness();
+
+         // Called by a pass once it has changed what the code reads or
+         // assigns, or the blocks, so the liveness is found again
+    void InvalidateLiveness();
+
+         // Adds a preheader in front of the loop (see cfg.h) and finds the
+         // edges and dominators again, or returns NULL if it can't be done
+    BasicBlock *InsertPreheader(Loop *loop);
+
+  public:
+         // The code must hold exactly one function, which is rewritten in
+         // place. New temps, if any are needed, are made by cg.
+    Optimizer(CodeGenerator *cg, List<Instruction*> *code);
+    ~Optimizer();
+
+    void Run();
+
+         // Returns whether code is a function (rather than a vtable)
+    static bool IsFunction(List<Instruction*> *code);
+};
+
+#endif
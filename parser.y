@@ -11,14 +11,25 @@
 
 %{
 
-#include "scanner.h" // for yylex
+#include "scanner.h"
 #include "parser.h"
 #include "errors.h"
 
-void yyerror(const char *msg); // standard error-handling routine
+void yyerror(yyltype *loc, void *scanner, const char *msg); // standard error-handling routine
 
 %}
 
+/* Reentrancy
+ * ----------
+ * The parser is pure (yylval and yylloc are locals of yyparse rather than
+ * globals) and takes the scanner to read tokens from as a parameter, which
+ * it hands along to each call to yylex.
+ */
+%define api.pure full
+%locations
+%parse-param {void *scanner}
+%lex-param {void *scanner}
+
  
 /* yylval 
  * ------
@@ -44,6 +55,10 @@ void yyerror(const char *msg); // standard error-handling routine
     LValue *lvalue;
 }
 
+%code {
+int yylex(YYSTYPE *yylval, yyltype *yylloc, void *scanner); // Defined in the generated lex.yy.c file
+}
+
 
 /* Tokens
  * ------
@@ -110,6 +125,7 @@ Program   :    DeclList            {
                                       // comment out prev line to skip semantic analysis
                                       if (ReportError::NumErrors() == 0) 
                                           program->Emit();
+                                      delete program;
                                     }
           ;
 
@@ -195,14 +211,15 @@ FnDecl    :    FnHeader StmtBlock   { ($$=$1)->SetFunctionBody($2); }
 
 StmtBlock :    '{' VarDecls StmtList '}' 
                                     { $$ = new StmtBlock($2, $3); }
+          |    '{' VarDecls '}'     { $$ = new StmtBlock($2, new List<Stmt*>); }
           ;
 
 VarDecls  :    VarDecls VarDecl     { ($$=$1)->Append($2); }
           |    /* empty */          { $$ = new List<VarDecl*>; }
           ;
 
-StmtList  :    Stmt StmtList        { $$ = $2; $$->InsertAt($1, 0); }
-          |    /* empty */          { $$ = new List<Stmt*>; }
+StmtList  :    StmtList Stmt        { ($$=$1)->Append($2); }
+          |    Stmt                 { ($$ = new List<Stmt*>)->Append($1); }
           ;
 
 Stmt      :    OptExpr ';'          { $$ = $1; }
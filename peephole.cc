@@ -0,0 +1,212 @@
+/* File: peephole.cc
+ * -----------------
+ * The peephole pass over the MIPS code of a function (see mips.h).
+ *
+ * The Mips class translates one Tac instruction at a time, so it leaves
+ * sequences that are plainly redundant once they are seen side by side,
+ * such as a variable written back to memory at the end of one Tac
+ * instruction and loaded again at the start of the next. Before the code
+ * of a function is written out, the rules below are tried at each of
+ * its instructions, over and over until none applies:
+ *
+ *   sw R, X; lw R, X          the load is dropped (or made a move R2, R,
+ *                             if it loads another register R2)
+ *   b L; L:                   the branch is dropped (beqz and bnez too)
+ *   move R, R                 dropped
+ *   beqz R, L1; b L2; L1:     bnez R, L2; L1: (and bnez the other way)
+ *   li R, c; move R2, R       li R2, c, if R is not read again
+ *
+ * The comments and directives in between are ignored. The last rule
+ * relies on how the registers are used (see mips.cc): the variables are
+ * all written back at each label, branch and call, and the code after it
+ * loads them into registers afresh, so what a general purpose register
+ * held before then is never read after (but for an argument passed in
+ * $a0-$a3, which the call reads). The instructions each rule
+ * removed are counted in the Stats (see -d timing).
+ */
+
+#include "mips.h"
+#include "stats.h"
+
+// The opcodes whose first operand is read, not written
+static bool ReadsFirst(const std::string &op)
+{
+  static const char * const ops[] = {"sw", "sb", "beqz", "bnez", "beq",
+                                     "bne", "b", "j", "jr", "jal", "jalr",
+                                     "mult", "multu"};
+  for (size_t i = 0; i < sizeof(ops) / sizeof(ops[0]); i++)
+    if (op == ops[i])
+      return true;
+  return false;
+}
+
+// Returns whether the operand arg is reg, or an address based on it
+bool Mips::Uses(const std::string &arg, const std::string &reg)
+{
+  return arg == reg || (arg.size() > reg.size() + 2 &&
+                        arg.compare(arg.size() - reg.size() - 2,
+                                    std::string::npos, "(" + reg + ")") == 0);
+}
+
+// Makes line i the instruction op with the given operands and comment
+void Mips::Rewrite(size_t i, const char *op, std::string arg1,
+                   std::string arg2, const std::string &comment)
+{
+  AsmLine &line = lines[i];
+  line.op = op;
+  line.args.clear();
+  line.args.push_back(arg1);
+  line.args.push_back(arg2);
+  line.text = line.op + " " + arg1 + ", " + arg2 + "\t# " + comment;
+}
+
+/* Method: NextInstruction
+ * -----------------------
+ * Returns the index of the first instruction or label after line i
+ * (lines.size() if there is none).
+ */
+size_t Mips::NextInstruction(size_t i)
+{
+  for (i++; i < lines.size(); i++)
+    if (!lines[i].op.empty() || !lines[i].label.empty())
+      break;
+  return i;
+}
+
+/* Method: IsDead
+ * --------------
+ * Returns whether the general purpose register reg is sure not to be
+ * read from line from on, before it is written.
+ */
+bool Mips::IsDead(const std::string &reg, size_t from)
+{
+  for (size_t i = from; i < lines.size(); i = NextInstruction(i)) {
+    AsmLine &line = lines[i];
+    if (!line.label.empty())
+      return true;
+    if (line.op.empty())
+      continue;
+    bool readsFirst = ReadsFirst(line.op);
+    for (size_t a = readsFirst ? 0 : 1; a < line.args.size(); a++)
+      if (Uses(line.args[a], reg))
+        return false;
+    if (!readsFirst && !line.args.empty() && line.args[0] == reg)
+      return true;
+    if ((line.op == "jal" || line.op == "jalr") && reg.compare(0, 2, "$a") == 0)
+      return false;                 // an argument
+    if (line.op == "b" || line.op == "jr" || line.op == "jal" ||
+        line.op == "jalr")
+      return true;
+  }
+  return true;
+}
+
+// sw R, X; lw R2, X
+bool Mips::RemoveStoreLoad(size_t i)
+{
+  size_t j = NextInstruction(i);
+  if (lines[i].op != "sw" || j == lines.size() || lines[j].op != "lw" ||
+      lines[i].args.size() != 2 || lines[j].args.size() != 2 ||
+      lines[j].args[1] != lines[i].args[1])
+    return false;
+  std::string stored = lines[i].args[0];
+  if (lines[j].args[0] == stored)
+    lines[j] = AsmLine();
+  else
+    Rewrite(j, "move", lines[j].args[0], stored,
+            "reload of " + lines[i].args[1]);
+  Stats::Count(Stats::LoadsAfterStores);
+  return true;
+}
+
+// b L; L: (or beqz R, L; L:)
+bool Mips::RemoveBranchToNext(size_t i)
+{
+  std::string target;
+  if (lines[i].op == "b" && lines[i].args.size() == 1)
+    target = lines[i].args[0];
+  else if ((lines[i].op == "beqz" || lines[i].op == "bnez") &&
+           lines[i].args.size() == 2)
+    target = lines[i].args[1];
+  else
+    return false;
+  for (size_t j = NextInstruction(i); j < lines.size() &&
+         !lines[j].label.empty(); j = NextInstruction(j))
+    if (lines[j].label == target) {
+      lines[i] = AsmLine();
+      Stats::Count(Stats::BranchesToNext);
+      return true;
+    }
+  return false;
+}
+
+// move R, R
+bool Mips::RemoveSelfMove(size_t i)
+{
+  if (lines[i].op != "move" || lines[i].args.size() != 2 ||
+      lines[i].args[0] != lines[i].args[1])
+    return false;
+  lines[i] = AsmLine();
+  Stats::Count(Stats::SelfMoves);
+  return true;
+}
+
+// beqz R, L1; b L2; L1:
+bool Mips::RemoveBranchOver(size_t i)
+{
+  if ((lines[i].op != "beqz" && lines[i].op != "bnez") ||
+      lines[i].args.size() != 2)
+    return false;
+  size_t j = NextInstruction(i), k = NextInstruction(j);
+  if (k >= lines.size() || lines[j].op != "b" || lines[j].args.size() != 1 ||
+      lines[k].label != lines[i].args[1])
+    return false;
+  bool ifZero = (lines[i].op == "bnez");  // the test turned around
+  Rewrite(i, ifZero ? "beqz" : "bnez", lines[i].args[0], lines[j].args[0],
+          ifZero ? "branch if zero" : "branch if not zero");
+  lines[j] = AsmLine();
+  Stats::Count(Stats::BranchesOverBranches);
+  return true;
+}
+
+// li R, c; move R2, R
+bool Mips::RemoveConstantMove(size_t i)
+{
+  size_t j = NextInstruction(i);
+  if (lines[i].op != "li" || j == lines.size() || lines[j].op != "move" ||
+      lines[i].args.size() != 2 || lines[j].args.size() != 2 ||
+      lines[j].args[1] != lines[i].args[0])
+    return false;
+  Register reg;
+  for (reg = zero; reg < NumRegs; reg = Register(reg+1))
+    if (lines[i].args[0] == regs[reg].name)
+      break;
+  if (reg == NumRegs || !regs[reg].isGeneralPurpose ||
+      !IsDead(lines[i].args[0], j + 1))
+    return false;
+  Rewrite(i, "li", lines[j].args[0], lines[i].args[1],
+          "load constant value " + lines[i].args[1] + " into " +
+          lines[j].args[0]);
+  lines[j] = AsmLine();
+  Stats::Count(Stats::ConstantMoves);
+  return true;
+}
+
+/* Method: Peephole
+ * ----------------
+ * Applies the rules above to the lines of the function until none of
+ * them applies anywhere. Each rule looks at most a few instructions
+ * ahead, so a pass takes time linear in the length of the function,
+ * and each pass but the last makes a change that no rule undoes.
+ */
+void Mips::Peephole()
+{
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    for (size_t i = 0; i < lines.size(); i++)
+      if (RemoveStoreLoad(i) || RemoveBranchToNext(i) || RemoveSelfMove(i) ||
+          RemoveBranchOver(i) || RemoveConstantMove(i))
+        changed = true;
+  }
+}
@@ -0,0 +1,106 @@
+#! /bin/sh
+#
+# Checks the generated code for performance regressions. Each kernel
+# listed in samples/perf.baseline is compiled and run on the simulator
+# (see mipssim.h), which is deterministic, and its output is checked
+# like any other test. The number of instructions it executed and its
+# peak heap use are then compared against the baseline: an increase of
+# more than $TOLERANCE percent (1 by default) is a regression, and a
+# decrease of more than that is reported as an improvement.
+#
+# With -update, the baseline is rewritten with the current counts
+# instead (do this, and commit the result, once an improvement is in).
+
+[ -x dcc ] || { echo "Error: dcc not executable"; exit 1; }
+[ -x mipssim ] || { echo "Error: mipssim not executable"; exit 1; }
+
+DIR="samples"
+BASELINE="$DIR/perf.baseline"
+TOLERANCE=${TOLERANCE:-"1"}
+
+update=no
+if [ "$1" = "-update" ]; then
+	update=yes
+	shift
+fi
+
+LIST="$@"
+if [ "$#" = "0" ]; then
+	LIST=`grep -v '^#' $BASELINE | awk '{ print $1 }'`
+fi
+
+tmp=${TMP:-"/tmp"}/perfcheck
+status=0
+
+if [ $update = yes ]; then
+	echo "# kernel          instructions    peak heap (bytes)" > $tmp.baseline
+fi
+
+printf "%-16s %-6s %12s %9s %10s %9s  %s\n" kernel output instrs change \
+	heap change result
+for test in $LIST; do
+	base=$DIR/$test
+
+	./dcc < $base.decaf > $tmp.asm 2> $tmp.errors
+	if [ $? -ne 0 -o -s $tmp.errors ]; then
+		echo "Error: $base.decaf does not compile"
+		cat $tmp.errors
+		status=1
+		continue
+	fi
+	if [ -r $base.in ]; then
+		./mipssim -s $tmp.asm < $base.in > $tmp.out 2> $tmp.counts
+	else
+		./mipssim -s $tmp.asm < /dev/null > $tmp.out 2> $tmp.counts
+	fi
+
+	tail -n +6 $base.out > $tmp.expected
+	output=PASS
+	if ! cmp -s $tmp.out $tmp.expected; then
+		output=FAIL
+		status=1
+	fi
+
+	instrs=`sed -n 's/^  instructions *\([0-9]*\)$/\1/p' $tmp.counts`
+	heap=`sed -n 's/^  peak heap *\([0-9]*\) bytes$/\1/p' $tmp.counts`
+	if [ $update = yes ]; then
+		printf "%-16s %14d %20d\n" $test $instrs $heap >> $tmp.baseline
+		printf "%-16s %-6s %12d %9s %10d %9s  %s\n" $test $output \
+			$instrs - $heap - updated
+		continue
+	fi
+
+	old=`awk -v t=$test '$1 == t { print $2, $3 }' $BASELINE`
+	if [ -z "$old" ]; then
+		printf "%-16s %-6s %12d %9s %10d %9s  %s\n" $test $output \
+			$instrs - $heap - "no baseline"
+		continue
+	fi
+
+	# Prints the changes in percent, then the verdict, which is worst
+	# of the two
+	echo $old $instrs $heap | awk -v tol=$TOLERANCE '
+		function change(old, new) {
+			return old == 0 ? (new == 0 ? 0 : 100) : 100 * (new - old) / old
+		}
+		{ ci = change($1, $3); ch = change($2, $4)
+		  verdict = "ok"
+		  if (ci < -tol || ch < -tol) verdict = "improved"
+		  if (ci > tol || ch > tol) verdict = "REGRESSED <--"
+		  printf "%+.2f%% %+.2f%% %s\n", ci, ch, verdict }' > $tmp.verdict
+	read ci ch verdict < $tmp.verdict
+	printf "%-16s %-6s %12d %9s %10d %9s  %s\n" $test $output $instrs $ci \
+		$heap $ch "$verdict"
+	case "$verdict" in
+		REGRESSED*) status=1 ;;
+	esac
+	if [ $output = FAIL ]; then
+		diff $tmp.out $tmp.expected
+	fi
+done
+
+if [ $update = yes ]; then
+	mv $tmp.baseline $BASELINE
+fi
+rm -f $tmp.asm $tmp.errors $tmp.out $tmp.expected $tmp.counts $tmp.verdict
+exit $status
@@ -0,0 +1,110 @@
+/* File: runtime.c
+ * ---------------
+ * The Decaf runtime routines for programs compiled to native code (see
+ * x86.h and csource.h), which take the place of the ones SPIM loads from
+ * its trap handler file. They are linked with the program's assembly or
+ * C source:
+ *
+ *     gcc -no-pie -o prog prog.s runtime.c
+ *
+ * A Decaf program's words are 32 bits, addresses included, so every
+ * value passed in or out is an int, and an address is only good as one
+ * if it is below 4GB. The program is linked there (-no-pie), and the heap
+ * is a static array, so it is too.
+ *
+ * The routines behave as SPIM's do: strings read are at most 127
+ * characters, and memory is allocated from a heap that is never freed.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HEAP_SIZE (64 * 1024 * 1024)
+#define READ_LINE_SIZE 128
+
+static char heap[HEAP_SIZE];
+static int heapUsed;
+
+// The entry to the program, see X86::EmitPreamble and CSource::EmitPreamble
+extern void _DecafStart(void);
+
+static char *Pointer(int address)
+{
+    return (char *)(unsigned long)(unsigned)address;
+}
+
+static int Address(char *p)
+{
+    return (int)(unsigned long)p;
+}
+
+int _Alloc(int size)
+{
+    char *p = heap + heapUsed;
+    if (size < 0 || size > HEAP_SIZE - heapUsed) {
+        printf("Can't expand data segment by %d bytes to %d bytes\n",
+               size, heapUsed + size);
+        exit(1);
+    }
+    heapUsed += (size + 3) & ~3;
+    return Address(p);
+}
+
+int _ReadLine(void)
+{
+    char *buffer = Pointer(_Alloc(READ_LINE_SIZE));
+    fflush(stdout);
+    if (fgets(buffer, READ_LINE_SIZE, stdin) == NULL)
+        buffer[0] = '\0';
+    buffer[strcspn(buffer, "\n")] = '\0';
+    return Address(buffer);
+}
+
+int _ReadInteger(void)
+{
+    char line[256];
+    fflush(stdout);
+    if (fgets(line, sizeof(line), stdin) == NULL)
+        return 0;
+    return atoi(line);
+}
+
+int _StringEqual(int s1, int s2)
+{
+    return strcmp(Pointer(s1), Pointer(s2)) == 0;
+}
+
+void _PrintInt(int n)
+{
+    printf("%d", n);
+}
+
+void _PrintString(int s)
+{
+    fputs(Pointer(s), stdout);
+}
+
+void _PrintBool(int b)
+{
+    fputs(b ? "true" : "false", stdout);
+}
+
+void _Halt(void)
+{
+    exit(0);
+}
+
+// Called on a division by zero, which SPIM reports as an exception
+void _DivideByZero(void)
+{
+    printf("Exception occurred\n  Divide by zero\n");
+    fflush(stdout);
+    exit(1);
+}
+
+int main(void)
+{
+    _DecafStart();
+    return 0;
+}
@@ -3,6 +3,10 @@
  * You should not need to modify this file. It declare a few constants,
  * types, variables,and functions that are used and/or exported by
  * the lex-generated scanner.
+ *
+ * The scanner is reentrant: all of its state is kept in the scanner
+ * object returned by InitScanner (a flex yyscan_t) rather than in
+ * globals, so any number of scanners can be active at once.
  */
 
 #ifndef _H_scanner
@@ -12,12 +16,8 @@
 
 #define MaxIdentLen 31    // Maximum length for identifiers
 
-extern char *yytext;      // Text of lexeme just scanned
-
-
-int yylex();              // Defined in the generated lex.yy.c file
-
-void InitScanner();                 // Defined in scanner.l user subroutines
-const char *GetLineNumbered(int n); // ditto
+void *InitScanner(FILE *in);                       // Defined in scanner.l user subroutines
+void FreeScanner(void *scanner);                   // ditto
+const char *GetLineNumbered(void *scanner, int n); // ditto
  
 #endif
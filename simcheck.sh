@@ -0,0 +1,86 @@
+#! /bin/sh
+#
+# Runs the regression suite like check.sh, but on the built-in MIPS
+# simulator instead of SPIM, and reports how many instructions each test
+# executed: in all, loads, stores, branches, calls (including calls to
+# the builtins) and the loads and stores that move variables between
+# registers and the stack frame or globals (spill traffic).
+#
+# The expected outputs were made with SPIM, so they start with its
+# banner, which the simulator doesn't print; those lines are skipped.
+
+[ -x dcc ] || { echo "Error: dcc not executable"; exit 1; }
+[ -x mipssim ] || { echo "Error: mipssim not executable"; exit 1; }
+
+DIR="samples"
+
+LIST=
+if [ "$#" = "0" ]; then
+	LIST=`ls $DIR/*.out`
+else
+	for test in "$@"; do
+		LIST="$LIST $DIR/$test.out"
+	done
+fi
+
+tmp=${TMP:-"/tmp"}/simcheck
+status=0
+
+printf "%-36s %-6s %10s %8s %8s %8s %8s %8s\n" test result instrs loads \
+	stores branches calls spills
+for file in $LIST; do
+	base=`echo $file | sed 's/\(.*\)\.out/\1/'`
+
+	ext=''
+	if [ -r $base.frag ]; then
+		ext='frag'
+	elif [ -r $base.decaf ]; then
+		ext='decaf'
+	else
+		echo "Error: Input file for base: $base not found"
+		continue
+	fi
+
+	flags=
+	[ -r $base.flags ] && flags=`cat $base.flags`
+
+	rm -f $tmp.counts
+	./dcc $flags < $base.$ext > $tmp.asm 2> $tmp.errors
+	if [ $? -ne 0 -o -s $tmp.errors ]; then
+		cp $tmp.errors $tmp.out
+	elif [ -r $base.in ]; then
+		./mipssim -s $tmp.asm < $base.in > $tmp.out 2> $tmp.counts
+	else
+		./mipssim -s $tmp.asm < /dev/null > $tmp.out 2> $tmp.counts
+	fi
+
+	if head -1 $file | grep -q '^SPIM Version'; then
+		tail -n +6 $file > $tmp.expected
+	else
+		cp $file $tmp.expected
+	fi
+
+	result=PASS
+	if ! cmp -s $tmp.out $tmp.expected; then
+		result=FAIL
+		status=1
+	fi
+
+	if [ -r $tmp.counts ]; then
+		awk -v test=$file -v result=$result '
+			/^  [a-z]/ { name = $1; for (i = 2; i < NF; i++) name = name " " $i
+				     count[name] = $NF }
+			END { printf "%-36s %-6s %10d %8d %8d %8d %8d %8d\n", test,
+				result, count["instructions"], count["loads"],
+				count["stores"], count["branches"], count["calls"],
+				count["spill loads"] + count["spill stores"] }' $tmp.counts
+	else
+		printf "%-36s %-6s\n" $file $result
+	fi
+	if [ $result = FAIL ]; then
+		diff $tmp.out $tmp.expected
+	fi
+done
+
+rm -f $tmp.asm $tmp.errors $tmp.out $tmp.expected $tmp.counts
+exit $status
@@ -0,0 +1,52 @@
+/* File: simmain.cc
+ * ----------------
+ * This file defines the main() routine for the MIPS simulator (see
+ * mipssim.h), which assembles a file of the code dcc writes and runs it
+ * with this process's stdin and stdout as its console. With -s, it then
+ * reports on stderr how many instructions were executed, by class.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "mipssim.h"
+
+static void PrintUsage() {
+    fprintf(stderr, "Correct Usage:   mipssim [-s] <file>\n");
+}
+
+int main(int argc, char *argv[]) {
+    bool report = false;
+    const char *path = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-s") == 0 && path == NULL)
+            report = true;
+        else if (argv[i][0] != '-' && path == NULL)
+            path = argv[i];
+        else {
+            PrintUsage();
+            return 2;
+        }
+    }
+    if (path == NULL) {
+        PrintUsage();
+        return 2;
+    }
+
+    FILE *in = fopen(path, "r");
+    if (in == NULL) {
+        fprintf(stderr, "*** Cannot open %s\n", path);
+        return 2;
+    }
+
+    MipsSimulator sim;
+    bool ok = sim.Assemble(in, path);
+    fclose(in);
+    if (!ok)
+        return 2;
+
+    int status = sim.Run();
+    if (report)
+        sim.Report(stderr, path);
+    return status;
+}
@@ -0,0 +1,247 @@
+/* File: ssa.cc
+ * ------------
+ * Implementation of the SSAForm class. The phis are placed at the
+ * iterated dominance frontiers of the assignments to each variable
+ * (Cytron et al.), only for the variables that are used in some block
+ * before being assigned in it (semi-pruned form).
+ */
+
+#include "ssa.h"
+#include "cfg.h"
+#include <algorithm>
+
+SSAForm::SSAForm(FlowGraph *g) {
+  graph = g;
+  phis.resize(graph->blocks.size());
+  FindVariables();
+  PlacePhis();
+  Rename();
+}
+
+int SSAForm::VarFor(Location *loc) {
+  std::pair<int,int> key(loc->GetSegment(), loc->GetOffset());
+  std::map<std::pair<int,int>, int>::iterator i = varIndex.find(key);
+  if (i != varIndex.end())
+    return i->second;
+  int var = vars.size();
+  varIndex[key] = var;
+  vars.push_back(loc);
+  if (loc->GetSegment() == gpRelative)
+    globalVars.push_back(var);
+  return var;
+}
+
+bool SSAForm::IsCall(Instruction *instr) {
+  return dynamic_cast<LCall*>(instr) != NULL || dynamic_cast<ACall*>(instr) != NULL;
+}
+
+void SSAForm::FindVariables() {
+  for (size_t i = 0; i < graph->rpo.size(); i++) {
+    BasicBlock *b = graph->rpo[i];
+    for (size_t j = 0; j < b->code.size(); j++) {
+      List<Location*> srcs;
+      b->code[j]->GetSrcs(&srcs);
+      for (int s = 0; s < srcs.NumElements(); s++)
+        VarFor(srcs.Nth(s));
+      if (b->code[j]->GetDst() != NULL)
+        VarFor(b->code[j]->GetDst());
+    }
+  }
+}
+
+void SSAForm::PlacePhis() {
+  int numVars = vars.size();
+  std::vector<bool> nonLocal(numVars, false);
+  std::vector<std::vector<BasicBlock*> > defBlocks(numVars);
+
+  for (size_t i = 0; i < graph->rpo.size(); i++) {
+    BasicBlock *b = graph->rpo[i];
+    std::vector<bool> assigned(numVars, false);
+    for (size_t j = 0; j < b->code.size(); j++) {
+      Instruction *instr = b->code[j];
+      List<Location*> srcs;
+      instr->GetSrcs(&srcs);
+      for (int s = 0; s < srcs.NumElements(); s++) {
+        int var = VarFor(srcs.Nth(s));
+        if (!assigned[var])
+          nonLocal[var] = true;
+      }
+      std::vector<int> dsts;
+      if (instr->GetDst() != NULL)
+        dsts.push_back(VarFor(instr->GetDst()));
+      if (IsCall(instr))
+        dsts.insert(dsts.end(), globalVars.begin(), globalVars.end());
+      for (size_t d = 0; d < dsts.size(); d++) {
+        if (!assigned[dsts[d]])
+          defBlocks[dsts[d]].push_back(b);
+        assigned[dsts[d]] = true;
+      }
+    }
+  }
+
+  std::vector<int> hasPhi(graph->blocks.size(), -1);
+  std::vector<int> queued(graph->blocks.size(), -1);
+  for (int var = 0; var < numVars; var++) {
+    if (!nonLocal[var])
+      continue;
+    std::vector<BasicBlock*> work = defBlocks[var];
+    work.push_back(graph->GetEntry());
+    for (size_t w = 0; w < work.size(); w++)
+      queued[work[w]->id] = var;
+    while (!work.empty()) {
+      BasicBlock *b = work.back();
+      work.pop_back();
+      for (size_t f = 0; f < b->frontier.size(); f++) {
+        BasicBlock *join = b->frontier[f];
+        if (hasPhi[join->id] == var)
+          continue;
+        hasPhi[join->id] = var;
+        Value phi;
+        phi.kind = PhiValue;
+        phi.var = var;
+        phi.block = join;
+        phi.instr = NULL;
+        phi.args.assign(join->preds.size(), -1);
+        phis[join->id].push_back(values.size());
+        values.push_back(phi);
+        if (queued[join->id] != var) {
+          queued[join->id] = var;
+          work.push_back(join);
+        }
+      }
+    }
+  }
+}
+
+/* Method: Rename
+ * --------------
+ * Walks the dominator tree (with a stack of its own, since the tree can
+ * be as deep as the function is long), keeping the Value of each variable
+ * that reaches the current point on top of its stack.
+ */
+void SSAForm::Rename() {
+  int numVars = vars.size();
+  std::vector<std::vector<int> > current(numVars);
+  std::vector<int> pushed;        // the variables pushed, in order
+
+  BasicBlock *entry = graph->GetEntry();
+  for (int var = 0; var < numVars; var++) {
+    Value v;
+    v.kind = EntryValue;
+    v.var = var;
+    v.block = entry;
+    v.instr = NULL;
+    current[var].push_back(values.size());
+    values.push_back(v);
+  }
+
+  // Each block is visited twice: once on the way down, when its values
+  // are pushed, and once on the way back up, when they are popped
+  std::vector<std::pair<BasicBlock*, size_t> > stack;
+  stack.push_back(std::make_pair(entry, (size_t)0));
+  std::vector<size_t> marks;
+  while (!stack.empty()) {
+    BasicBlock *b = stack.back().first;
+    size_t child = stack.back().second;
+    if (child == 0) {
+      marks.push_back(pushed.size());
+      for (size_t p = 0; p < phis[b->id].size(); p++) {
+        int v = phis[b->id][p];
+        current[values[v].var].push_back(v);
+        pushed.push_back(values[v].var);
+      }
+      for (size_t j = 0; j < b->code.size(); j++) {
+        Instruction *instr = b->code[j];
+        List<Location*> srcs;
+        instr->GetSrcs(&srcs);
+        std::vector<int> &u = uses[instr];
+        for (int s = 0; s < srcs.NumElements(); s++)
+          u.push_back(current[VarFor(srcs.Nth(s))].back());
+        if (instr->GetDst() != NULL) {
+          Value v;
+          v.kind = DefValue;
+          v.var = VarFor(instr->GetDst());
+          v.block = b;
+          v.instr = instr;
+          defs[instr] = values.size();
+          current[v.var].push_back(values.size());
+          pushed.push_back(v.var);
+          values.push_back(v);
+        }
+        if (IsCall(instr)) {
+          std::vector<int> &c = clobbers[instr];
+          for (size_t g = 0; g < globalVars.size(); g++) {
+            Value v;
+            v.kind = CallValue;
+            v.var = globalVars[g];
+            v.block = b;
+            v.instr = instr;
+            c.push_back(values.size());
+            current[v.var].push_back(values.size());
+            pushed.push_back(v.var);
+            values.push_back(v);
+          }
+        }
+      }
+      for (size_t s = 0; s < b->succs.size(); s++) {
+        BasicBlock *succ = b->succs[s];
+        int pred = succ->PredIndex(b);
+        for (size_t p = 0; p < phis[succ->id].size(); p++) {
+          Value &phi = values[phis[succ->id][p]];
+          phi.args[pred] = current[phi.var].back();
+        }
+      }
+    }
+    if (child < b->children.size()) {
+      stack.back().second++;
+      stack.push_back(std::make_pair(b->children[child], (size_t)0));
+    } else {
+      for (size_t mark = marks.back(); pushed.size() > mark; pushed.pop_back())
+        current[pushed.back()].pop_back();
+      marks.pop_back();
+      stack.pop_back();
+    }
+  }
+}
+
+static void PrintValue(FILE *out, SSAForm *ssa, int v) {
+  fprintf(out, "%s.%d", ssa->vars[ssa->values[v].var]->GetName(), v);
+}
+
+void SSAForm::Print(FILE *out) {
+  for (size_t i = 0; i < graph->rpo.size(); i++) {
+    BasicBlock *b = graph->rpo[i];
+    fprintf(out, "block %d (preds", b->id);
+    for (size_t p = 0; p < b->preds.size(); p++)
+      fprintf(out, " %d", b->preds[p]->id);
+    fprintf(out, ")\n");
+    for (size_t p = 0; p < phis[b->id].size(); p++) {
+      Value &phi = values[phis[b->id][p]];
+      fprintf(out, "\t");
+      PrintValue(out, this, phis[b->id][p]);
+      fprintf(out, " = phi");
+      for (size_t a = 0; a < phi.args.size(); a++) {
+        fprintf(out, " ");
+        PrintValue(out, this, phi.args[a]);
+      }
+      fprintf(out, "\n");
+    }
+    for (size_t j = 0; j < b->code.size(); j++) {
+      Instruction *instr = b->code[j];
+      instr->Print(out);
+      std::vector<int> &u = uses[instr];
+      if (u.empty() && defs.count(instr) == 0)
+        continue;
+      fprintf(out, "\t\t#");
+      for (size_t s = 0; s < u.size(); s++) {
+        fprintf(out, " ");
+        PrintValue(out, this, u[s]);
+      }
+      if (defs.count(instr) != 0) {
+        fprintf(out, " -> ");
+        PrintValue(out, this, defs[instr]);
+      }
+      fprintf(out, "\n");
+    }
+  }
+}
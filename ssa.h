@@ -0,0 +1,74 @@
+/* File: ssa.h
+ * -----------
+ * The SSAForm class puts the variables of a function into static single
+ * assignment form, for the analyses that are simpler (and sparse) on it,
+ * such as constant propagation (see optimizer.h).
+ *
+ * The form is kept on the side rather than in the code: each assignment
+ * to a variable makes a new Value, phis are Values that merge those of a
+ * block's preds, and each use of a variable in the code is mapped to the
+ * Value that reaches it. The instructions keep their Locations, so going
+ * out of SSA is just a matter of dropping the SSAForm, as long as the
+ * code is only rewritten in ways that keep the Values of a variable from
+ * being live at the same time (replacing an assignment by one of a
+ * constant, or deleting branches, is fine).
+ *
+ * The variables are the locals, temps and params of the function, which
+ * nothing else can get at, and the globals, which are assigned anew
+ * (to an unknown value) by every call as well.
+ */
+
+#ifndef _H_ssa
+#define _H_ssa
+
+#include <stdio.h>
+#include <map>
+#include <utility>
+#include <vector>
+#include "tac.h"
+class FlowGraph;
+class BasicBlock;
+
+class SSAForm {
+  public:
+    typedef enum { EntryValue, DefValue, PhiValue, CallValue } Kind;
+
+    struct Value {
+      Kind kind;
+      int var;
+      BasicBlock *block;
+      Instruction *instr;             // the assignment or call, if any
+      std::vector<int> args;          // of a phi, one for each pred
+    };
+
+  private:
+    FlowGraph *graph;
+    std::map<std::pair<int,int>, int> varIndex;   // by segment and offset
+    std::vector<int> globalVars;
+
+    void FindVariables();
+    void PlacePhis();
+    void Rename();
+
+  public:
+    std::vector<Location*> vars;
+    std::vector<Value> values;
+    std::vector<std::vector<int> > phis;          // by block id
+    std::map<Instruction*, std::vector<int> > uses;  // in GetSrcs order
+    std::map<Instruction*, int> defs;             // of the dst
+    std::map<Instruction*, std::vector<int> > clobbers; // of globals, by calls
+
+         // The graph's dominators must have been computed
+    SSAForm(FlowGraph *graph);
+
+         // Returns the index of the variable at loc
+    int VarFor(Location *loc);
+
+    static bool IsCall(Instruction *instr);
+
+         // Prints the blocks with their phis and the Values used and
+         // assigned by each instruction (for -d ssa)
+    void Print(FILE *out);
+};
+
+#endif
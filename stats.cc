@@ -0,0 +1,168 @@
+/* File: stats.cc
+ * --------------
+ * Implementation of the Stats, TraceSpan and PhaseTimer classes.
+ */
+
+#include "stats.h"
+#include "context.h"
+#include "utility.h"
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <sys/resource.h>
+
+const char * const Stats::phaseNames[NumPhases] =
+  {"scan", "parse", "check", "preemit", "emit", "final codegen"};
+
+const char * const Stats::counterNames[NumCounters] =
+  {"ast nodes", "tac instructions", "temps", "labels", "spills",
+   "hashtable lookups", "expressions folded", "tail calls eliminated",
+   "loops unrolled", "bounds checks removed",
+   "constants folded", "branches folded",
+   "values reused", "copies propagated", "copies coalesced",
+   "instructions hoisted", "addresses reduced",
+   "dead instructions", "blocks moved",
+   "variables kept across calls",
+   "loads after stores removed", "branches to next removed",
+   "self moves removed", "branches over branches removed",
+   "constant moves removed"};
+
+Stats::Stats() {
+    for (int i = 0; i < NumPhases; i++)
+        phaseTimes[i] = 0;
+    for (int i = 0; i < NumCounters; i++)
+        counts[i] = 0;
+}
+
+void Stats::Count(Counter c, long n) {
+    Stats *s = CompilationContext::CurrentStats();
+    if (s != NULL)
+        s->counts[c] += n;
+}
+
+void Stats::CountTac(const char *opName) {
+    counts[TacInstructions]++;
+    std::lock_guard<std::mutex> guard(lock);
+    tacCounts[opName]++;
+}
+
+void Stats::AddTime(Phase p, long long nanos) {
+    phaseTimes[p] += nanos;
+}
+
+long long Stats::Now() {
+    using namespace std::chrono;
+    return duration_cast<nanoseconds>(
+        steady_clock::now().time_since_epoch()).count();
+}
+
+/* Method: Report
+ * --------------
+ * The scanner is driven by yyparse, and the later phases are run from
+ * the parser action for the whole program, so their times are taken out
+ * of the parse time to leave just the time spent parsing. When functions
+ * are translated in parallel, the emit time is the wall time until all
+ * of them were written out, not the sum over the threads.
+ */
+void Stats::Report(FILE *out, const char *srcName) {
+    long long parse = phaseTimes[Parse];
+    for (int p = Scan; p < NumPhases; p++)
+        if (p != Parse)
+            parse -= phaseTimes[p];
+
+    fprintf(out, "+++ timing for %s\n", srcName ? srcName : "stdin");
+    for (int p = 0; p < NumPhases; p++) {
+        long long t = (p == Parse ? parse : (long long)phaseTimes[p]);
+        fprintf(out, "  %-20s %10.3f ms\n", phaseNames[p], t / 1e6);
+    }
+    for (int c = 0; c < NumCounters; c++)
+        fprintf(out, "  %-20s %10ld\n", counterNames[c], (long)counts[c]);
+
+    std::lock_guard<std::mutex> guard(lock);
+    std::map<std::string, long>::iterator i;
+    for (i = tacCounts.begin(); i != tacCounts.end(); ++i)
+        fprintf(out, "    %-18s %10ld\n", i->first.c_str(), i->second);
+
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    fprintf(out, "  %-20s %10ld KB\n", "peak rss", (long)usage.ru_maxrss);
+}
+
+
+// The spans recorded for the timeline, shared by all threads
+struct Span {
+    std::string name;
+    const char *category;
+    long long start, duration;
+    int thread;
+};
+static std::mutex traceLock;
+static std::vector<Span> spans;
+static std::map<std::thread::id, int> threadNums;
+
+TraceSpan::TraceSpan(const char *n, const char *c) : category(c), start(0) {
+    if (IsDebugOn("trace")) {
+        name = n;
+        start = Stats::Now();
+    }
+}
+
+TraceSpan::~TraceSpan() {
+    if (start == 0)
+        return;
+
+    long long end = Stats::Now();
+    std::lock_guard<std::mutex> guard(traceLock);
+    std::thread::id id = std::this_thread::get_id();
+    if (threadNums.count(id) == 0) {
+        int num = threadNums.size();
+        threadNums[id] = num;
+    }
+    Span s = { name, category, start, end - start, threadNums[id] };
+    spans.push_back(s);
+}
+
+static void WriteJsonString(FILE *f, const std::string &s) {
+    fputc('"', f);
+    for (size_t i = 0; i < s.size(); i++) {
+        if (s[i] == '"' || s[i] == '\\')
+            fputc('\\', f);
+        fputc(s[i], f);
+    }
+    fputc('"', f);
+}
+
+void TraceSpan::WriteTrace(const char *path) {
+    FILE *f = fopen(path, "w");
+    if (f == NULL) {
+        fprintf(stderr, "*** Cannot open trace file %s\n", path);
+        return;
+    }
+
+    std::lock_guard<std::mutex> guard(traceLock);
+    fprintf(f, "{\"traceEvents\":[\n");
+    for (size_t i = 0; i < spans.size(); i++) {
+        fprintf(f, "{\"name\":");
+        WriteJsonString(f, spans[i].name);
+        // the trace-event format counts in microseconds
+        fprintf(f, ",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,"
+                "\"pid\":1,\"tid\":%d}%s\n", spans[i].category,
+                spans[i].start / 1e3, spans[i].duration / 1e3, spans[i].thread,
+                i + 1 < spans.size() ? "," : "");
+    }
+    fprintf(f, "]}\n");
+    fclose(f);
+}
+
+
+PhaseTimer::PhaseTimer(Stats::Phase p)
+  : stats(CompilationContext::CurrentStats()), phase(p), start(0),
+    span(Stats::PhaseName(p), "phase") {
+    if (stats != NULL)
+        start = Stats::Now();
+}
+
+PhaseTimer::~PhaseTimer() {
+    if (stats != NULL)
+        stats->AddTime(phase, Stats::Now() - start);
+}
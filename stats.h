@@ -0,0 +1,119 @@
+/* File: stats.h
+ * -------------
+ * Instrumentation for finding out where compile time and memory go.
+ *
+ * With -d timing, each compilation keeps a Stats object (see
+ * CompilationContext) with the wall time spent in each phase and counts
+ * of the interesting things done along the way, which is reported on
+ * stderr at the end. With -d trace, the phases and the translation of
+ * each function are also written out as a timeline (in the Chrome
+ * trace-event format, viewable in chrome://tracing or Perfetto) to the
+ * file dcc.trace.json.
+ *
+ * Sample usage:
+ *
+ *      Stats::Count(Stats::Temps);
+ *
+ *      {
+ *          PhaseTimer t(Stats::Check);
+ *          ...
+ *      }
+ *
+ * Both do nothing (beyond a check) when the instrumentation is off.
+ */
+
+#ifndef _H_stats
+#define _H_stats
+
+#include <stdio.h>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+
+class Stats
+{
+  public:
+    typedef enum { Scan, Parse, Check, PreEmit, Emit, FinalCodeGen,
+                   NumPhases } Phase;
+    typedef enum { AstNodes, TacInstructions, Temps, Labels, Spills,
+                   HashtableLookups, ExpressionsFolded, TailCallsEliminated,
+                   LoopsUnrolled, BoundsChecksRemoved,
+                   ConstantsFolded, BranchesFolded,
+                   ValuesReused, CopiesPropagated, CopiesCoalesced,
+                   InstructionsHoisted, AddressesReduced,
+                   DeadInstructions, BlocksMoved, VarsSaved,
+                   LoadsAfterStores, BranchesToNext, SelfMoves,
+                   BranchesOverBranches, ConstantMoves, NumCounters } Counter;
+
+  private:
+    static const char * const phaseNames[NumPhases];
+    static const char * const counterNames[NumCounters];
+
+    std::atomic<long long> phaseTimes[NumPhases]; // in nanoseconds
+    std::atomic<long> counts[NumCounters];
+    std::mutex lock;                              // guards tacCounts
+    std::map<std::string, long> tacCounts;
+
+  public:
+    Stats();
+
+         // Adds n to counter c of the calling thread's compilation, if it
+         // is keeping stats
+    static void Count(Counter c, long n = 1);
+
+         // Counts one Tac instruction with the given opcode name
+    void CountTac(const char *opName);
+
+    void AddTime(Phase p, long long nanos);
+
+         // Prints the report for the compilation of srcName (NULL for stdin)
+    void Report(FILE *out, const char *srcName);
+
+         // Returns the current time, in nanoseconds since some fixed point
+    static long long Now();
+
+    static const char *PhaseName(Phase p) { return phaseNames[p]; }
+};
+
+
+/* Class: TraceSpan
+ * ----------------
+ * Adds a span covering the lifetime of the object to the timeline, if a
+ * timeline is being written (-d trace). The name is copied.
+ */
+class TraceSpan
+{
+  private:
+    std::string name;
+    const char *category;
+    long long start;
+
+  public:
+    TraceSpan(const char *name, const char *category);
+    ~TraceSpan();
+
+         // Writes out all the spans recorded so far as a trace-event file
+    static void WriteTrace(const char *path);
+};
+
+
+/* Class: PhaseTimer
+ * -----------------
+ * Adds the time between its construction and destruction to a phase of
+ * the calling thread's compilation (and to the timeline).
+ */
+class PhaseTimer
+{
+  private:
+    Stats *stats;
+    Stats::Phase phase;
+    long long start;
+    TraceSpan span;
+
+  public:
+    PhaseTimer(Stats::Phase p);
+    ~PhaseTimer();
+};
+
+#endif
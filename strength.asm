@@ -0,0 +1,2279 @@
+	# standard Decaf preamble 
+	  .text
+	  .align 2
+	  .globl main
+  ____show:
+	# BeginFunc 400
+	  subu $sp, $sp, 8	# decrement sp to make space to save ra, fp
+	  sw $fp, 8($sp)	# save fp
+	  sw $ra, 4($sp)	# save ra
+	  addiu $fp, $sp, 8	# set up new fp
+	  subu $sp, $sp, 400	# decrement sp to make space for locals/temps
+	# PushParam x
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  lw $t0, 4($fp)	# load x from $fp+4 into $t0
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintInt
+	  jal _PrintInt      	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp0 = ": "
+	  .data			# create string constant marked with label
+	  ____show._string1: .asciiz ": "
+	  .text
+	  la $t0, ____show._string1	# load label
+	# PushParam _tmp0
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -8($fp)	# spill _tmp0 from $t0 to $fp-8
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp1 = 2
+	  li $t0, 2		# load constant value 2 into $t0
+	# _tmp2 = x * _tmp1
+	  lw $t1, 4($fp)	# load x from $fp+4 into $t1
+	  sll $t2, $t1, 1	# $t1 * 2 by shifting
+	# PushParam _tmp2
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t2, 4($sp)	# copy param value to stack
+	# LCall _PrintInt
+	# (save modified registers before flow of control change)
+	  sw $t0, -12($fp)	# spill _tmp1 from $t0 to $fp-12
+	  sw $t2, -16($fp)	# spill _tmp2 from $t2 to $fp-16
+	  jal _PrintInt      	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp3 = " "
+	  .data			# create string constant marked with label
+	  ____show._string2: .asciiz " "
+	  .text
+	  la $t0, ____show._string2	# load label
+	# PushParam _tmp3
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -20($fp)	# spill _tmp3 from $t0 to $fp-20
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp4 = 8
+	  li $t0, 8		# load constant value 8 into $t0
+	# _tmp5 = 0
+	  li $t1, 0		# load constant value 0 into $t1
+	# _tmp6 = _tmp5 - _tmp4
+	  sub $t2, $t1, $t0	
+	# _tmp7 = x * _tmp6
+	  lw $t3, 4($fp)	# load x from $fp+4 into $t3
+	  mul $t4, $t3, $t2	
+	# PushParam _tmp7
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t4, 4($sp)	# copy param value to stack
+	# LCall _PrintInt
+	# (save modified registers before flow of control change)
+	  sw $t0, -24($fp)	# spill _tmp4 from $t0 to $fp-24
+	  sw $t1, -28($fp)	# spill _tmp5 from $t1 to $fp-28
+	  sw $t2, -32($fp)	# spill _tmp6 from $t2 to $fp-32
+	  sw $t4, -36($fp)	# spill _tmp7 from $t4 to $fp-36
+	  jal _PrintInt      	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp8 = " "
+	  .data			# create string constant marked with label
+	  ____show._string3: .asciiz " "
+	  .text
+	  la $t0, ____show._string3	# load label
+	# PushParam _tmp8
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -40($fp)	# spill _tmp8 from $t0 to $fp-40
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp9 = 10
+	  li $t0, 10		# load constant value 10 into $t0
+	# _tmp10 = x * _tmp9
+	  lw $t1, 4($fp)	# load x from $fp+4 into $t1
+	  sll $v1, $t1, 3	# $t1 * 10 by shifting and adding
+	  sll $t2, $t1, 1
+	  addu $t2, $v1, $t2
+	# PushParam _tmp10
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t2, 4($sp)	# copy param value to stack
+	# LCall _PrintInt
+	# (save modified registers before flow of control change)
+	  sw $t0, -44($fp)	# spill _tmp9 from $t0 to $fp-44
+	  sw $t2, -48($fp)	# spill _tmp10 from $t2 to $fp-48
+	  jal _PrintInt      	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp11 = " "
+	  .data			# create string constant marked with label
+	  ____show._string4: .asciiz " "
+	  .text
+	  la $t0, ____show._string4	# load label
+	# PushParam _tmp11
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -52($fp)	# spill _tmp11 from $t0 to $fp-52
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp12 = 7
+	  li $t0, 7		# load constant value 7 into $t0
+	# _tmp13 = x * _tmp12
+	  lw $t1, 4($fp)	# load x from $fp+4 into $t1
+	  sll $v1, $t1, 3	# $t1 * 7 by shifting and adding
+	  subu $t2, $v1, $t1
+	# PushParam _tmp13
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t2, 4($sp)	# copy param value to stack
+	# LCall _PrintInt
+	# (save modified registers before flow of control change)
+	  sw $t0, -56($fp)	# spill _tmp12 from $t0 to $fp-56
+	  sw $t2, -60($fp)	# spill _tmp13 from $t2 to $fp-60
+	  jal _PrintInt      	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp14 = " "
+	  .data			# create string constant marked with label
+	  ____show._string5: .asciiz " "
+	  .text
+	  la $t0, ____show._string5	# load label
+	# PushParam _tmp14
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -64($fp)	# spill _tmp14 from $t0 to $fp-64
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp15 = 31
+	  li $t0, 31		# load constant value 31 into $t0
+	# _tmp16 = 0
+	  li $t1, 0		# load constant value 0 into $t1
+	# _tmp17 = _tmp16 - _tmp15
+	  sub $t2, $t1, $t0	
+	# _tmp18 = x * _tmp17
+	  lw $t3, 4($fp)	# load x from $fp+4 into $t3
+	  mul $t4, $t3, $t2	
+	# PushParam _tmp18
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t4, 4($sp)	# copy param value to stack
+	# LCall _PrintInt
+	# (save modified registers before flow of control change)
+	  sw $t0, -68($fp)	# spill _tmp15 from $t0 to $fp-68
+	  sw $t1, -72($fp)	# spill _tmp16 from $t1 to $fp-72
+	  sw $t2, -76($fp)	# spill _tmp17 from $t2 to $fp-76
+	  sw $t4, -80($fp)	# spill _tmp18 from $t4 to $fp-80
+	  jal _PrintInt      	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp19 = " "
+	  .data			# create string constant marked with label
+	  ____show._string6: .asciiz " "
+	  .text
+	  la $t0, ____show._string6	# load label
+	# PushParam _tmp19
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -84($fp)	# spill _tmp19 from $t0 to $fp-84
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp20 = 0
+	  li $t0, 0		# load constant value 0 into $t0
+	# _tmp21 = x * _tmp20
+	  lw $t1, 4($fp)	# load x from $fp+4 into $t1
+	  li $t2, 0		# $t1 * 0
+	# PushParam _tmp21
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t2, 4($sp)	# copy param value to stack
+	# LCall _PrintInt
+	# (save modified registers before flow of control change)
+	  sw $t0, -88($fp)	# spill _tmp20 from $t0 to $fp-88
+	  sw $t2, -92($fp)	# spill _tmp21 from $t2 to $fp-92
+	  jal _PrintInt      	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp22 = " "
+	  .data			# create string constant marked with label
+	  ____show._string7: .asciiz " "
+	  .text
+	  la $t0, ____show._string7	# load label
+	# PushParam _tmp22
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -96($fp)	# spill _tmp22 from $t0 to $fp-96
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp23 = 1
+	  li $t0, 1		# load constant value 1 into $t0
+	# _tmp24 = 0
+	  li $t1, 0		# load constant value 0 into $t1
+	# _tmp25 = _tmp24 - _tmp23
+	  sub $t2, $t1, $t0	
+	# _tmp26 = x * _tmp25
+	  lw $t3, 4($fp)	# load x from $fp+4 into $t3
+	  mul $t4, $t3, $t2	
+	# PushParam _tmp26
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t4, 4($sp)	# copy param value to stack
+	# LCall _PrintInt
+	# (save modified registers before flow of control change)
+	  sw $t0, -100($fp)	# spill _tmp23 from $t0 to $fp-100
+	  sw $t1, -104($fp)	# spill _tmp24 from $t1 to $fp-104
+	  sw $t2, -108($fp)	# spill _tmp25 from $t2 to $fp-108
+	  sw $t4, -112($fp)	# spill _tmp26 from $t4 to $fp-112
+	  jal _PrintInt      	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp27 = "\n"
+	  .data			# create string constant marked with label
+	  ____show._string8: .asciiz "\n"
+	  .text
+	  la $t0, ____show._string8	# load label
+	# PushParam _tmp27
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -116($fp)	# spill _tmp27 from $t0 to $fp-116
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp28 = "  /: "
+	  .data			# create string constant marked with label
+	  ____show._string9: .asciiz "  /: "
+	  .text
+	  la $t0, ____show._string9	# load label
+	# PushParam _tmp28
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -120($fp)	# spill _tmp28 from $t0 to $fp-120
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp29 = 2
+	  li $t0, 2		# load constant value 2 into $t0
+	# _tmp30 = x / _tmp29
+	  lw $t1, 4($fp)	# load x from $fp+4 into $t1
+	  srl $v1, $t1, 31	# $t1 / 2 by shifting
+	  addu $v1, $t1, $v1
+	  sra $t2, $v1, 1
+	# PushParam _tmp30
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t2, 4($sp)	# copy param value to stack
+	# LCall _PrintInt
+	# (save modified registers before flow of control change)
+	  sw $t0, -124($fp)	# spill _tmp29 from $t0 to $fp-124
+	  sw $t2, -128($fp)	# spill _tmp30 from $t2 to $fp-128
+	  jal _PrintInt      	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp31 = " "
+	  .data			# create string constant marked with label
+	  ____show._string10: .asciiz " "
+	  .text
+	  la $t0, ____show._string10	# load label
+	# PushParam _tmp31
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -132($fp)	# spill _tmp31 from $t0 to $fp-132
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp32 = 4
+	  li $t0, 4		# load constant value 4 into $t0
+	# _tmp33 = x / _tmp32
+	  lw $t1, 4($fp)	# load x from $fp+4 into $t1
+	  sra $v1, $t1, 31	# $t1 / 4 by shifting
+	  srl $v1, $v1, 30
+	  addu $v1, $t1, $v1
+	  sra $t2, $v1, 2
+	# PushParam _tmp33
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t2, 4($sp)	# copy param value to stack
+	# LCall _PrintInt
+	# (save modified registers before flow of control change)
+	  sw $t0, -136($fp)	# spill _tmp32 from $t0 to $fp-136
+	  sw $t2, -140($fp)	# spill _tmp33 from $t2 to $fp-140
+	  jal _PrintInt      	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp34 = " "
+	  .data			# create string constant marked with label
+	  ____show._string11: .asciiz " "
+	  .text
+	  la $t0, ____show._string11	# load label
+	# PushParam _tmp34
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -144($fp)	# spill _tmp34 from $t0 to $fp-144
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp35 = 8
+	  li $t0, 8		# load constant value 8 into $t0
+	# _tmp36 = 0
+	  li $t1, 0		# load constant value 0 into $t1
+	# _tmp37 = _tmp36 - _tmp35
+	  sub $t2, $t1, $t0	
+	# _tmp38 = x / _tmp37
+	  lw $t3, 4($fp)	# load x from $fp+4 into $t3
+	  div $t4, $t3, $t2	
+	# PushParam _tmp38
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t4, 4($sp)	# copy param value to stack
+	# LCall _PrintInt
+	# (save modified registers before flow of control change)
+	  sw $t0, -148($fp)	# spill _tmp35 from $t0 to $fp-148
+	  sw $t1, -152($fp)	# spill _tmp36 from $t1 to $fp-152
+	  sw $t2, -156($fp)	# spill _tmp37 from $t2 to $fp-156
+	  sw $t4, -160($fp)	# spill _tmp38 from $t4 to $fp-160
+	  jal _PrintInt      	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp39 = " "
+	  .data			# create string constant marked with label
+	  ____show._string12: .asciiz " "
+	  .text
+	  la $t0, ____show._string12	# load label
+	# PushParam _tmp39
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -164($fp)	# spill _tmp39 from $t0 to $fp-164
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp40 = 3
+	  li $t0, 3		# load constant value 3 into $t0
+	# _tmp41 = x / _tmp40
+	  lw $t1, 4($fp)	# load x from $fp+4 into $t1
+	  li $v1, 1431655766	# $t1 / 3 by multiplying by its reciprocal
+	  mult $t1, $v1
+	  mfhi $v1
+	  srl $v0, $v1, 31	# round a negative quotient toward zero
+	  addu $t2, $v1, $v0
+	# PushParam _tmp41
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t2, 4($sp)	# copy param value to stack
+	# LCall _PrintInt
+	# (save modified registers before flow of control change)
+	  sw $t0, -168($fp)	# spill _tmp40 from $t0 to $fp-168
+	  sw $t2, -172($fp)	# spill _tmp41 from $t2 to $fp-172
+	  jal _PrintInt      	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp42 = " "
+	  .data			# create string constant marked with label
+	  ____show._string13: .asciiz " "
+	  .text
+	  la $t0, ____show._string13	# load label
+	# PushParam _tmp42
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -176($fp)	# spill _tmp42 from $t0 to $fp-176
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp43 = 10
+	  li $t0, 10		# load constant value 10 into $t0
+	# _tmp44 = x / _tmp43
+	  lw $t1, 4($fp)	# load x from $fp+4 into $t1
+	  li $v1, 1717986919	# $t1 / 10 by multiplying by its reciprocal
+	  mult $t1, $v1
+	  mfhi $v1
+	  sra $v1, $v1, 2
+	  srl $v0, $v1, 31	# round a negative quotient toward zero
+	  addu $t2, $v1, $v0
+	# PushParam _tmp44
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t2, 4($sp)	# copy param value to stack
+	# LCall _PrintInt
+	# (save modified registers before flow of control change)
+	  sw $t0, -180($fp)	# spill _tmp43 from $t0 to $fp-180
+	  sw $t2, -184($fp)	# spill _tmp44 from $t2 to $fp-184
+	  jal _PrintInt      	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp45 = " "
+	  .data			# create string constant marked with label
+	  ____show._string14: .asciiz " "
+	  .text
+	  la $t0, ____show._string14	# load label
+	# PushParam _tmp45
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -188($fp)	# spill _tmp45 from $t0 to $fp-188
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp46 = 7
+	  li $t0, 7		# load constant value 7 into $t0
+	# _tmp47 = x / _tmp46
+	  lw $t1, 4($fp)	# load x from $fp+4 into $t1
+	  li $v1, -1840700269	# $t1 / 7 by multiplying by its reciprocal
+	  mult $t1, $v1
+	  mfhi $v1
+	  addu $v1, $v1, $t1
+	  sra $v1, $v1, 2
+	  srl $v0, $v1, 31	# round a negative quotient toward zero
+	  addu $t2, $v1, $v0
+	# PushParam _tmp47
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t2, 4($sp)	# copy param value to stack
+	# LCall _PrintInt
+	# (save modified registers before flow of control change)
+	  sw $t0, -192($fp)	# spill _tmp46 from $t0 to $fp-192
+	  sw $t2, -196($fp)	# spill _tmp47 from $t2 to $fp-196
+	  jal _PrintInt      	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp48 = " "
+	  .data			# create string constant marked with label
+	  ____show._string15: .asciiz " "
+	  .text
+	  la $t0, ____show._string15	# load label
+	# PushParam _tmp48
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -200($fp)	# spill _tmp48 from $t0 to $fp-200
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp49 = 7
+	  li $t0, 7		# load constant value 7 into $t0
+	# _tmp50 = 0
+	  li $t1, 0		# load constant value 0 into $t1
+	# _tmp51 = _tmp50 - _tmp49
+	  sub $t2, $t1, $t0	
+	# _tmp52 = x / _tmp51
+	  lw $t3, 4($fp)	# load x from $fp+4 into $t3
+	  div $t4, $t3, $t2	
+	# PushParam _tmp52
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t4, 4($sp)	# copy param value to stack
+	# LCall _PrintInt
+	# (save modified registers before flow of control change)
+	  sw $t0, -204($fp)	# spill _tmp49 from $t0 to $fp-204
+	  sw $t1, -208($fp)	# spill _tmp50 from $t1 to $fp-208
+	  sw $t2, -212($fp)	# spill _tmp51 from $t2 to $fp-212
+	  sw $t4, -216($fp)	# spill _tmp52 from $t4 to $fp-216
+	  jal _PrintInt      	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp53 = " "
+	  .data			# create string constant marked with label
+	  ____show._string16: .asciiz " "
+	  .text
+	  la $t0, ____show._string16	# load label
+	# PushParam _tmp53
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -220($fp)	# spill _tmp53 from $t0 to $fp-220
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp54 = 31
+	  li $t0, 31		# load constant value 31 into $t0
+	# _tmp55 = x / _tmp54
+	  lw $t1, 4($fp)	# load x from $fp+4 into $t1
+	  li $v1, -2078209981	# $t1 / 31 by multiplying by its reciprocal
+	  mult $t1, $v1
+	  mfhi $v1
+	  addu $v1, $v1, $t1
+	  sra $v1, $v1, 4
+	  srl $v0, $v1, 31	# round a negative quotient toward zero
+	  addu $t2, $v1, $v0
+	# PushParam _tmp55
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t2, 4($sp)	# copy param value to stack
+	# LCall _PrintInt
+	# (save modified registers before flow of control change)
+	  sw $t0, -224($fp)	# spill _tmp54 from $t0 to $fp-224
+	  sw $t2, -228($fp)	# spill _tmp55 from $t2 to $fp-228
+	  jal _PrintInt      	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp56 = " "
+	  .data			# create string constant marked with label
+	  ____show._string17: .asciiz " "
+	  .text
+	  la $t0, ____show._string17	# load label
+	# PushParam _tmp56
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -232($fp)	# spill _tmp56 from $t0 to $fp-232
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp57 = 10007
+	  li $t0, 10007		# load constant value 10007 into $t0
+	# _tmp58 = x / _tmp57
+	  lw $t1, 4($fp)	# load x from $fp+4 into $t1
+	  li $v1, 1757988013	# $t1 / 10007 by multiplying by its reciprocal
+	  mult $t1, $v1
+	  mfhi $v1
+	  sra $v1, $v1, 12
+	  srl $v0, $v1, 31	# round a negative quotient toward zero
+	  addu $t2, $v1, $v0
+	# PushParam _tmp58
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t2, 4($sp)	# copy param value to stack
+	# LCall _PrintInt
+	# (save modified registers before flow of control change)
+	  sw $t0, -236($fp)	# spill _tmp57 from $t0 to $fp-236
+	  sw $t2, -240($fp)	# spill _tmp58 from $t2 to $fp-240
+	  jal _PrintInt      	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp59 = " "
+	  .data			# create string constant marked with label
+	  ____show._string18: .asciiz " "
+	  .text
+	  la $t0, ____show._string18	# load label
+	# PushParam _tmp59
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -244($fp)	# spill _tmp59 from $t0 to $fp-244
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp60 = 1
+	  li $t0, 1		# load constant value 1 into $t0
+	# _tmp61 = 0
+	  li $t1, 0		# load constant value 0 into $t1
+	# _tmp62 = _tmp61 - _tmp60
+	  sub $t2, $t1, $t0	
+	# _tmp63 = x / _tmp62
+	  lw $t3, 4($fp)	# load x from $fp+4 into $t3
+	  div $t4, $t3, $t2	
+	# PushParam _tmp63
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t4, 4($sp)	# copy param value to stack
+	# LCall _PrintInt
+	# (save modified registers before flow of control change)
+	  sw $t0, -248($fp)	# spill _tmp60 from $t0 to $fp-248
+	  sw $t1, -252($fp)	# spill _tmp61 from $t1 to $fp-252
+	  sw $t2, -256($fp)	# spill _tmp62 from $t2 to $fp-256
+	  sw $t4, -260($fp)	# spill _tmp63 from $t4 to $fp-260
+	  jal _PrintInt      	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp64 = "\n"
+	  .data			# create string constant marked with label
+	  ____show._string19: .asciiz "\n"
+	  .text
+	  la $t0, ____show._string19	# load label
+	# PushParam _tmp64
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -264($fp)	# spill _tmp64 from $t0 to $fp-264
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp65 = "  %: "
+	  .data			# create string constant marked with label
+	  ____show._string20: .asciiz "  %: "
+	  .text
+	  la $t0, ____show._string20	# load label
+	# PushParam _tmp65
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -268($fp)	# spill _tmp65 from $t0 to $fp-268
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp66 = 2
+	  li $t0, 2		# load constant value 2 into $t0
+	# _tmp67 = x % _tmp66
+	  lw $t1, 4($fp)	# load x from $fp+4 into $t1
+	  srl $v1, $t1, 31	# $t1 / 2 by shifting
+	  addu $v1, $t1, $v1
+	  sra $v1, $v1, 1
+	  sll $v1, $v1, 1
+	  subu $t2, $t1, $v1	# $t1 % 2
+	# PushParam _tmp67
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t2, 4($sp)	# copy param value to stack
+	# LCall _PrintInt
+	# (save modified registers before flow of control change)
+	  sw $t0, -272($fp)	# spill _tmp66 from $t0 to $fp-272
+	  sw $t2, -276($fp)	# spill _tmp67 from $t2 to $fp-276
+	  jal _PrintInt      	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp68 = " "
+	  .data			# create string constant marked with label
+	  ____show._string21: .asciiz " "
+	  .text
+	  la $t0, ____show._string21	# load label
+	# PushParam _tmp68
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -280($fp)	# spill _tmp68 from $t0 to $fp-280
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp69 = 4
+	  li $t0, 4		# load constant value 4 into $t0
+	# _tmp70 = x % _tmp69
+	  lw $t1, 4($fp)	# load x from $fp+4 into $t1
+	  sra $v1, $t1, 31	# $t1 / 4 by shifting
+	  srl $v1, $v1, 30
+	  addu $v1, $t1, $v1
+	  sra $v1, $v1, 2
+	  sll $v1, $v1, 2
+	  subu $t2, $t1, $v1	# $t1 % 4
+	# PushParam _tmp70
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t2, 4($sp)	# copy param value to stack
+	# LCall _PrintInt
+	# (save modified registers before flow of control change)
+	  sw $t0, -284($fp)	# spill _tmp69 from $t0 to $fp-284
+	  sw $t2, -288($fp)	# spill _tmp70 from $t2 to $fp-288
+	  jal _PrintInt      	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp71 = " "
+	  .data			# create string constant marked with label
+	  ____show._string22: .asciiz " "
+	  .text
+	  la $t0, ____show._string22	# load label
+	# PushParam _tmp71
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -292($fp)	# spill _tmp71 from $t0 to $fp-292
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp72 = 8
+	  li $t0, 8		# load constant value 8 into $t0
+	# _tmp73 = 0
+	  li $t1, 0		# load constant value 0 into $t1
+	# _tmp74 = _tmp73 - _tmp72
+	  sub $t2, $t1, $t0	
+	# _tmp75 = x % _tmp74
+	  lw $t3, 4($fp)	# load x from $fp+4 into $t3
+	  rem $t4, $t3, $t2	
+	# PushParam _tmp75
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t4, 4($sp)	# copy param value to stack
+	# LCall _PrintInt
+	# (save modified registers before flow of control change)
+	  sw $t0, -296($fp)	# spill _tmp72 from $t0 to $fp-296
+	  sw $t1, -300($fp)	# spill _tmp73 from $t1 to $fp-300
+	  sw $t2, -304($fp)	# spill _tmp74 from $t2 to $fp-304
+	  sw $t4, -308($fp)	# spill _tmp75 from $t4 to $fp-308
+	  jal _PrintInt      	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp76 = " "
+	  .data			# create string constant marked with label
+	  ____show._string23: .asciiz " "
+	  .text
+	  la $t0, ____show._string23	# load label
+	# PushParam _tmp76
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -312($fp)	# spill _tmp76 from $t0 to $fp-312
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp77 = 3
+	  li $t0, 3		# load constant value 3 into $t0
+	# _tmp78 = x % _tmp77
+	  lw $t1, 4($fp)	# load x from $fp+4 into $t1
+	  li $v1, 1431655766	# $t1 / 3 by multiplying by its reciprocal
+	  mult $t1, $v1
+	  mfhi $v1
+	  srl $v0, $v1, 31	# round a negative quotient toward zero
+	  addu $v1, $v1, $v0
+	  mul $v1, $v1, $t0
+	  subu $t2, $t1, $v1	# $t1 % 3
+	# PushParam _tmp78
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t2, 4($sp)	# copy param value to stack
+	# LCall _PrintInt
+	# (save modified registers before flow of control change)
+	  sw $t0, -316($fp)	# spill _tmp77 from $t0 to $fp-316
+	  sw $t2, -320($fp)	# spill _tmp78 from $t2 to $fp-320
+	  jal _PrintInt      	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp79 = " "
+	  .data			# create string constant marked with label
+	  ____show._string24: .asciiz " "
+	  .text
+	  la $t0, ____show._string24	# load label
+	# PushParam _tmp79
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -324($fp)	# spill _tmp79 from $t0 to $fp-324
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp80 = 10
+	  li $t0, 10		# load constant value 10 into $t0
+	# _tmp81 = x % _tmp80
+	  lw $t1, 4($fp)	# load x from $fp+4 into $t1
+	  li $v1, 1717986919	# $t1 / 10 by multiplying by its reciprocal
+	  mult $t1, $v1
+	  mfhi $v1
+	  sra $v1, $v1, 2
+	  srl $v0, $v1, 31	# round a negative quotient toward zero
+	  addu $v1, $v1, $v0
+	  mul $v1, $v1, $t0
+	  subu $t2, $t1, $v1	# $t1 % 10
+	# PushParam _tmp81
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t2, 4($sp)	# copy param value to stack
+	# LCall _PrintInt
+	# (save modified registers before flow of control change)
+	  sw $t0, -328($fp)	# spill _tmp80 from $t0 to $fp-328
+	  sw $t2, -332($fp)	# spill _tmp81 from $t2 to $fp-332
+	  jal _PrintInt      	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp82 = " "
+	  .data			# create string constant marked with label
+	  ____show._string25: .asciiz " "
+	  .text
+	  la $t0, ____show._string25	# load label
+	# PushParam _tmp82
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -336($fp)	# spill _tmp82 from $t0 to $fp-336
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp83 = 7
+	  li $t0, 7		# load constant value 7 into $t0
+	# _tmp84 = x % _tmp83
+	  lw $t1, 4($fp)	# load x from $fp+4 into $t1
+	  li $v1, -1840700269	# $t1 / 7 by multiplying by its reciprocal
+	  mult $t1, $v1
+	  mfhi $v1
+	  addu $v1, $v1, $t1
+	  sra $v1, $v1, 2
+	  srl $v0, $v1, 31	# round a negative quotient toward zero
+	  addu $v1, $v1, $v0
+	  mul $v1, $v1, $t0
+	  subu $t2, $t1, $v1	# $t1 % 7
+	# PushParam _tmp84
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t2, 4($sp)	# copy param value to stack
+	# LCall _PrintInt
+	# (save modified registers before flow of control change)
+	  sw $t0, -340($fp)	# spill _tmp83 from $t0 to $fp-340
+	  sw $t2, -344($fp)	# spill _tmp84 from $t2 to $fp-344
+	  jal _PrintInt      	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp85 = " "
+	  .data			# create string constant marked with label
+	  ____show._string26: .asciiz " "
+	  .text
+	  la $t0, ____show._string26	# load label
+	# PushParam _tmp85
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -348($fp)	# spill _tmp85 from $t0 to $fp-348
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp86 = 7
+	  li $t0, 7		# load constant value 7 into $t0
+	# _tmp87 = 0
+	  li $t1, 0		# load constant value 0 into $t1
+	# _tmp88 = _tmp87 - _tmp86
+	  sub $t2, $t1, $t0	
+	# _tmp89 = x % _tmp88
+	  lw $t3, 4($fp)	# load x from $fp+4 into $t3
+	  rem $t4, $t3, $t2	
+	# PushParam _tmp89
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t4, 4($sp)	# copy param value to stack
+	# LCall _PrintInt
+	# (save modified registers before flow of control change)
+	  sw $t0, -352($fp)	# spill _tmp86 from $t0 to $fp-352
+	  sw $t1, -356($fp)	# spill _tmp87 from $t1 to $fp-356
+	  sw $t2, -360($fp)	# spill _tmp88 from $t2 to $fp-360
+	  sw $t4, -364($fp)	# spill _tmp89 from $t4 to $fp-364
+	  jal _PrintInt      	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp90 = " "
+	  .data			# create string constant marked with label
+	  ____show._string27: .asciiz " "
+	  .text
+	  la $t0, ____show._string27	# load label
+	# PushParam _tmp90
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -368($fp)	# spill _tmp90 from $t0 to $fp-368
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp91 = 31
+	  li $t0, 31		# load constant value 31 into $t0
+	# _tmp92 = x % _tmp91
+	  lw $t1, 4($fp)	# load x from $fp+4 into $t1
+	  li $v1, -2078209981	# $t1 / 31 by multiplying by its reciprocal
+	  mult $t1, $v1
+	  mfhi $v1
+	  addu $v1, $v1, $t1
+	  sra $v1, $v1, 4
+	  srl $v0, $v1, 31	# round a negative quotient toward zero
+	  addu $v1, $v1, $v0
+	  mul $v1, $v1, $t0
+	  subu $t2, $t1, $v1	# $t1 % 31
+	# PushParam _tmp92
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t2, 4($sp)	# copy param value to stack
+	# LCall _PrintInt
+	# (save modified registers before flow of control change)
+	  sw $t0, -372($fp)	# spill _tmp91 from $t0 to $fp-372
+	  sw $t2, -376($fp)	# spill _tmp92 from $t2 to $fp-376
+	  jal _PrintInt      	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp93 = " "
+	  .data			# create string constant marked with label
+	  ____show._string28: .asciiz " "
+	  .text
+	  la $t0, ____show._string28	# load label
+	# PushParam _tmp93
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -380($fp)	# spill _tmp93 from $t0 to $fp-380
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp94 = 10007
+	  li $t0, 10007		# load constant value 10007 into $t0
+	# _tmp95 = x % _tmp94
+	  lw $t1, 4($fp)	# load x from $fp+4 into $t1
+	  li $v1, 1757988013	# $t1 / 10007 by multiplying by its reciprocal
+	  mult $t1, $v1
+	  mfhi $v1
+	  sra $v1, $v1, 12
+	  srl $v0, $v1, 31	# round a negative quotient toward zero
+	  addu $v1, $v1, $v0
+	  mul $v1, $v1, $t0
+	  subu $t2, $t1, $v1	# $t1 % 10007
+	# PushParam _tmp95
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t2, 4($sp)	# copy param value to stack
+	# LCall _PrintInt
+	# (save modified registers before flow of control change)
+	  sw $t0, -384($fp)	# spill _tmp94 from $t0 to $fp-384
+	  sw $t2, -388($fp)	# spill _tmp95 from $t2 to $fp-388
+	  jal _PrintInt      	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp96 = " "
+	  .data			# create string constant marked with label
+	  ____show._string29: .asciiz " "
+	  .text
+	  la $t0, ____show._string29	# load label
+	# PushParam _tmp96
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -392($fp)	# spill _tmp96 from $t0 to $fp-392
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp97 = 1
+	  li $t0, 1		# load constant value 1 into $t0
+	# _tmp98 = x % _tmp97
+	  lw $t1, 4($fp)	# load x from $fp+4 into $t1
+	  li $t2, 0		# $t1 % 1
+	# PushParam _tmp98
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t2, 4($sp)	# copy param value to stack
+	# LCall _PrintInt
+	# (save modified registers before flow of control change)
+	  sw $t0, -396($fp)	# spill _tmp97 from $t0 to $fp-396
+	  sw $t2, -400($fp)	# spill _tmp98 from $t2 to $fp-400
+	  jal _PrintInt      	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp99 = "\n"
+	  .data			# create string constant marked with label
+	  ____show._string30: .asciiz "\n"
+	  .text
+	  la $t0, ____show._string30	# load label
+	# PushParam _tmp99
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -404($fp)	# spill _tmp99 from $t0 to $fp-404
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# EndFunc
+	# (below handles reaching end of fn body with no explicit return)
+	  move $sp, $fp		# pop callee frame off stack
+	  lw $ra, -4($fp)	# restore saved ra
+	  lw $fp, 0($fp)	# restore saved fp
+	  jr $ra		# return from function
+  main:
+	# BeginFunc 1212
+	  subu $sp, $sp, 8	# decrement sp to make space to save ra, fp
+	  sw $fp, 8($sp)	# save fp
+	  sw $ra, 4($sp)	# save ra
+	  addiu $fp, $sp, 8	# set up new fp
+	  subu $sp, $sp, 1212	# decrement sp to make space for locals/temps
+	# _tmp0 = 14
+	  li $t0, 14		# load constant value 14 into $t0
+	# _tmp1 = 4
+	  li $t1, 4		# load constant value 4 into $t1
+	# _tmp2 = 0
+	  li $t2, 0		# load constant value 0 into $t2
+	# _tmp3 = _tmp0 < _tmp2
+	  slt $t3, $t0, $t2	
+	# _tmp4 = _tmp0 == _tmp2
+	  seq $t4, $t0, $t2	
+	# _tmp5 = _tmp3 || _tmp4
+	  or $t5, $t3, $t4	
+	# IfZ _tmp5 Goto main._L0
+	# (save modified registers before flow of control change)
+	  sw $t0, -20($fp)	# spill _tmp0 from $t0 to $fp-20
+	  sw $t1, -24($fp)	# spill _tmp1 from $t1 to $fp-24
+	  sw $t2, -28($fp)	# spill _tmp2 from $t2 to $fp-28
+	  sw $t3, -32($fp)	# spill _tmp3 from $t3 to $fp-32
+	  sw $t4, -36($fp)	# spill _tmp4 from $t4 to $fp-36
+	  sw $t5, -40($fp)	# spill _tmp5 from $t5 to $fp-40
+	  beqz $t5, main._L0	# branch if _tmp5 is zero 
+	# _tmp6 = "Decaf runtime error: Array size is <= 0\n"
+	  .data			# create string constant marked with label
+	  main._string1: .asciiz "Decaf runtime error: Array size is <= 0\n"
+	  .text
+	  la $t0, main._string1	# load label
+	# PushParam _tmp6
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -44($fp)	# spill _tmp6 from $t0 to $fp-44
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# LCall _Halt
+	  jal _Halt          	# jump to function
+  main._L0:
+	# _tmp7 = _tmp0 * _tmp1
+	  lw $t0, -20($fp)	# load _tmp0 from $fp-20 into $t0
+	  lw $t1, -24($fp)	# load _tmp1 from $fp-24 into $t1
+	  mul $t2, $t0, $t1	
+	# _tmp8 = _tmp1 + _tmp7
+	  add $t3, $t1, $t2	
+	# PushParam _tmp8
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t3, 4($sp)	# copy param value to stack
+	# _tmp9 = LCall _Alloc
+	# (save modified registers before flow of control change)
+	  sw $t2, -48($fp)	# spill _tmp7 from $t2 to $fp-48
+	  sw $t3, -52($fp)	# spill _tmp8 from $t3 to $fp-52
+	  jal _Alloc         	# jump to function
+	  move $t0, $v0		# copy function return value from $v0
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# *(_tmp9) = _tmp0
+	  lw $t1, -20($fp)	# load _tmp0 from $fp-20 into $t1
+	  sw $t1, 0($t0) 	# store with offset
+	# xs = _tmp9
+	  sw $t0, -56($fp)	# spill _tmp9 from $t0 to $fp-56
+	# _tmp10 = 0
+	  li $t2, 0		# load constant value 0 into $t2
+	# _tmp11 = 0
+	  li $t3, 0		# load constant value 0 into $t3
+	# _tmp12 = 0
+	  li $t4, 0		# load constant value 0 into $t4
+	# _tmp13 = *(xs)
+	  lw $t5, 0($t0) 	# load with offset
+	# _tmp14 = _tmp11 < _tmp12
+	  slt $t6, $t3, $t4	
+	# _tmp15 = _tmp13 < _tmp11
+	  slt $t7, $t5, $t3	
+	# _tmp16 = _tmp13 == _tmp11
+	  seq $s0, $t5, $t3	
+	# _tmp17 = _tmp15 || _tmp16
+	  or $s1, $t7, $s0	
+	# _tmp18 = _tmp17 || _tmp14
+	  or $s2, $s1, $t6	
+	# IfZ _tmp18 Goto main._L1
+	# (save modified registers before flow of control change)
+	  sw $t0, -8($fp)	# spill xs from $t0 to $fp-8
+	  sw $t2, -60($fp)	# spill _tmp10 from $t2 to $fp-60
+	  sw $t3, -64($fp)	# spill _tmp11 from $t3 to $fp-64
+	  sw $t4, -68($fp)	# spill _tmp12 from $t4 to $fp-68
+	  sw $t5, -72($fp)	# spill _tmp13 from $t5 to $fp-72
+	  sw $t6, -76($fp)	# spill _tmp14 from $t6 to $fp-76
+	  sw $t7, -80($fp)	# spill _tmp15 from $t7 to $fp-80
+	  sw $s0, -84($fp)	# spill _tmp16 from $s0 to $fp-84
+	  sw $s1, -88($fp)	# spill _tmp17 from $s1 to $fp-88
+	  sw $s2, -92($fp)	# spill _tmp18 from $s2 to $fp-92
+	  beqz $s2, main._L1	# branch if _tmp18 is zero 
+	# _tmp19 = "Decaf runtime error: Array subscript out of bound..."
+	  .data			# create string constant marked with label
+	  main._string2: .asciiz "Decaf runtime error: Array subscript out of bounds\n"
+	  .text
+	  la $t0, main._string2	# load label
+	# PushParam _tmp19
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -96($fp)	# spill _tmp19 from $t0 to $fp-96
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# LCall _Halt
+	  jal _Halt          	# jump to function
+  main._L1:
+	# _tmp20 = 4
+	  li $t0, 4		# load constant value 4 into $t0
+	# _tmp21 = _tmp11 * _tmp20
+	  lw $t1, -64($fp)	# load _tmp11 from $fp-64 into $t1
+	  sll $t2, $t1, 2	# $t1 * 4 by shifting
+	# _tmp22 = _tmp21 + _tmp20
+	  add $t3, $t2, $t0	
+	# _tmp23 = xs + _tmp22
+	  lw $t4, -8($fp)	# load xs from $fp-8 into $t4
+	  add $t5, $t4, $t3	
+	# *(_tmp23) = _tmp10
+	  lw $t6, -60($fp)	# load _tmp10 from $fp-60 into $t6
+	  sw $t6, 0($t5) 	# store with offset
+	# _tmp24 = *(_tmp23)
+	  lw $t7, 0($t5) 	# load with offset
+	# _tmp25 = 1
+	  li $s0, 1		# load constant value 1 into $s0
+	# _tmp26 = 1
+	  li $s1, 1		# load constant value 1 into $s1
+	# _tmp27 = 0
+	  li $s2, 0		# load constant value 0 into $s2
+	# _tmp28 = *(xs)
+	  lw $s3, 0($t4) 	# load with offset
+	# _tmp29 = _tmp26 < _tmp27
+	  slt $s4, $s1, $s2	
+	# _tmp30 = _tmp28 < _tmp26
+	  slt $s5, $s3, $s1	
+	# _tmp31 = _tmp28 == _tmp26
+	  seq $s6, $s3, $s1	
+	# _tmp32 = _tmp30 || _tmp31
+	  or $s7, $s5, $s6	
+	# _tmp33 = _tmp32 || _tmp29
+	  or $t8, $s7, $s4	
+	# IfZ _tmp33 Goto main._L2
+	# (save modified registers before flow of control change)
+	  sw $t0, -100($fp)	# spill _tmp20 from $t0 to $fp-100
+	  sw $t2, -104($fp)	# spill _tmp21 from $t2 to $fp-104
+	  sw $t3, -108($fp)	# spill _tmp22 from $t3 to $fp-108
+	  sw $t5, -112($fp)	# spill _tmp23 from $t5 to $fp-112
+	  sw $t7, -116($fp)	# spill _tmp24 from $t7 to $fp-116
+	  sw $s0, -120($fp)	# spill _tmp25 from $s0 to $fp-120
+	  sw $s1, -124($fp)	# spill _tmp26 from $s1 to $fp-124
+	  sw $s2, -128($fp)	# spill _tmp27 from $s2 to $fp-128
+	  sw $s3, -132($fp)	# spill _tmp28 from $s3 to $fp-132
+	  sw $s4, -136($fp)	# spill _tmp29 from $s4 to $fp-136
+	  sw $s5, -140($fp)	# spill _tmp30 from $s5 to $fp-140
+	  sw $s6, -144($fp)	# spill _tmp31 from $s6 to $fp-144
+	  sw $s7, -148($fp)	# spill _tmp32 from $s7 to $fp-148
+	  sw $t8, -152($fp)	# spill _tmp33 from $t8 to $fp-152
+	  beqz $t8, main._L2	# branch if _tmp33 is zero 
+	# _tmp34 = "Decaf runtime error: Array subscript out of bound..."
+	  .data			# create string constant marked with label
+	  main._string3: .asciiz "Decaf runtime error: Array subscript out of bounds\n"
+	  .text
+	  la $t0, main._string3	# load label
+	# PushParam _tmp34
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -156($fp)	# spill _tmp34 from $t0 to $fp-156
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# LCall _Halt
+	  jal _Halt          	# jump to function
+  main._L2:
+	# _tmp35 = 4
+	  li $t0, 4		# load constant value 4 into $t0
+	# _tmp36 = _tmp26 * _tmp35
+	  lw $t1, -124($fp)	# load _tmp26 from $fp-124 into $t1
+	  sll $t2, $t1, 2	# $t1 * 4 by shifting
+	# _tmp37 = _tmp36 + _tmp35
+	  add $t3, $t2, $t0	
+	# _tmp38 = xs + _tmp37
+	  lw $t4, -8($fp)	# load xs from $fp-8 into $t4
+	  add $t5, $t4, $t3	
+	# *(_tmp38) = _tmp25
+	  lw $t6, -120($fp)	# load _tmp25 from $fp-120 into $t6
+	  sw $t6, 0($t5) 	# store with offset
+	# _tmp39 = *(_tmp38)
+	  lw $t7, 0($t5) 	# load with offset
+	# _tmp40 = 1
+	  li $s0, 1		# load constant value 1 into $s0
+	# _tmp41 = 0
+	  li $s1, 0		# load constant value 0 into $s1
+	# _tmp42 = _tmp41 - _tmp40
+	  sub $s2, $s1, $s0	
+	# _tmp43 = 2
+	  li $s3, 2		# load constant value 2 into $s3
+	# _tmp44 = 0
+	  li $s4, 0		# load constant value 0 into $s4
+	# _tmp45 = *(xs)
+	  lw $s5, 0($t4) 	# load with offset
+	# _tmp46 = _tmp43 < _tmp44
+	  slt $s6, $s3, $s4	
+	# _tmp47 = _tmp45 < _tmp43
+	  slt $s7, $s5, $s3	
+	# _tmp48 = _tmp45 == _tmp43
+	  seq $t8, $s5, $s3	
+	# _tmp49 = _tmp47 || _tmp48
+	  or $t9, $s7, $t8	
+	# _tmp50 = _tmp49 || _tmp46
+	  or $t1, $t9, $s6	
+	# IfZ _tmp50 Goto main._L3
+	# (save modified registers before flow of control change)
+	  sw $t0, -160($fp)	# spill _tmp35 from $t0 to $fp-160
+	  sw $t1, -220($fp)	# spill _tmp50 from $t1 to $fp-220
+	  sw $t2, -164($fp)	# spill _tmp36 from $t2 to $fp-164
+	  sw $t3, -168($fp)	# spill _tmp37 from $t3 to $fp-168
+	  sw $t5, -172($fp)	# spill _tmp38 from $t5 to $fp-172
+	  sw $t7, -176($fp)	# spill _tmp39 from $t7 to $fp-176
+	  sw $s0, -180($fp)	# spill _tmp40 from $s0 to $fp-180
+	  sw $s1, -184($fp)	# spill _tmp41 from $s1 to $fp-184
+	  sw $s2, -188($fp)	# spill _tmp42 from $s2 to $fp-188
+	  sw $s3, -192($fp)	# spill _tmp43 from $s3 to $fp-192
+	  sw $s4, -196($fp)	# spill _tmp44 from $s4 to $fp-196
+	  sw $s5, -200($fp)	# spill _tmp45 from $s5 to $fp-200
+	  sw $s6, -204($fp)	# spill _tmp46 from $s6 to $fp-204
+	  sw $s7, -208($fp)	# spill _tmp47 from $s7 to $fp-208
+	  sw $t8, -212($fp)	# spill _tmp48 from $t8 to $fp-212
+	  sw $t9, -216($fp)	# spill _tmp49 from $t9 to $fp-216
+	  beqz $t1, main._L3	# branch if _tmp50 is zero 
+	# _tmp51 = "Decaf runtime error: Array subscript out of bound..."
+	  .data			# create string constant marked with label
+	  main._string4: .asciiz "Decaf runtime error: Array subscript out of bounds\n"
+	  .text
+	  la $t0, main._string4	# load label
+	# PushParam _tmp51
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -224($fp)	# spill _tmp51 from $t0 to $fp-224
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# LCall _Halt
+	  jal _Halt          	# jump to function
+  main._L3:
+	# _tmp52 = 4
+	  li $t0, 4		# load constant value 4 into $t0
+	# _tmp53 = _tmp43 * _tmp52
+	  lw $t1, -192($fp)	# load _tmp43 from $fp-192 into $t1
+	  sll $t2, $t1, 2	# $t1 * 4 by shifting
+	# _tmp54 = _tmp53 + _tmp52
+	  add $t3, $t2, $t0	
+	# _tmp55 = xs + _tmp54
+	  lw $t4, -8($fp)	# load xs from $fp-8 into $t4
+	  add $t5, $t4, $t3	
+	# *(_tmp55) = _tmp42
+	  lw $t6, -188($fp)	# load _tmp42 from $fp-188 into $t6
+	  sw $t6, 0($t5) 	# store with offset
+	# _tmp56 = *(_tmp55)
+	  lw $t7, 0($t5) 	# load with offset
+	# _tmp57 = 7
+	  li $s0, 7		# load constant value 7 into $s0
+	# _tmp58 = 3
+	  li $s1, 3		# load constant value 3 into $s1
+	# _tmp59 = 0
+	  li $s2, 0		# load constant value 0 into $s2
+	# _tmp60 = *(xs)
+	  lw $s3, 0($t4) 	# load with offset
+	# _tmp61 = _tmp58 < _tmp59
+	  slt $s4, $s1, $s2	
+	# _tmp62 = _tmp60 < _tmp58
+	  slt $s5, $s3, $s1	
+	# _tmp63 = _tmp60 == _tmp58
+	  seq $s6, $s3, $s1	
+	# _tmp64 = _tmp62 || _tmp63
+	  or $s7, $s5, $s6	
+	# _tmp65 = _tmp64 || _tmp61
+	  or $t8, $s7, $s4	
+	# IfZ _tmp65 Goto main._L4
+	# (save modified registers before flow of control change)
+	  sw $t0, -228($fp)	# spill _tmp52 from $t0 to $fp-228
+	  sw $t2, -232($fp)	# spill _tmp53 from $t2 to $fp-232
+	  sw $t3, -236($fp)	# spill _tmp54 from $t3 to $fp-236
+	  sw $t5, -240($fp)	# spill _tmp55 from $t5 to $fp-240
+	  sw $t7, -244($fp)	# spill _tmp56 from $t7 to $fp-244
+	  sw $s0, -248($fp)	# spill _tmp57 from $s0 to $fp-248
+	  sw $s1, -252($fp)	# spill _tmp58 from $s1 to $fp-252
+	  sw $s2, -256($fp)	# spill _tmp59 from $s2 to $fp-256
+	  sw $s3, -260($fp)	# spill _tmp60 from $s3 to $fp-260
+	  sw $s4, -264($fp)	# spill _tmp61 from $s4 to $fp-264
+	  sw $s5, -268($fp)	# spill _tmp62 from $s5 to $fp-268
+	  sw $s6, -272($fp)	# spill _tmp63 from $s6 to $fp-272
+	  sw $s7, -276($fp)	# spill _tmp64 from $s7 to $fp-276
+	  sw $t8, -280($fp)	# spill _tmp65 from $t8 to $fp-280
+	  beqz $t8, main._L4	# branch if _tmp65 is zero 
+	# _tmp66 = "Decaf runtime error: Array subscript out of bound..."
+	  .data			# create string constant marked with label
+	  main._string5: .asciiz "Decaf runtime error: Array subscript out of bounds\n"
+	  .text
+	  la $t0, main._string5	# load label
+	# PushParam _tmp66
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -284($fp)	# spill _tmp66 from $t0 to $fp-284
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# LCall _Halt
+	  jal _Halt          	# jump to function
+  main._L4:
+	# _tmp67 = 4
+	  li $t0, 4		# load constant value 4 into $t0
+	# _tmp68 = _tmp58 * _tmp67
+	  lw $t1, -252($fp)	# load _tmp58 from $fp-252 into $t1
+	  sll $t2, $t1, 2	# $t1 * 4 by shifting
+	# _tmp69 = _tmp68 + _tmp67
+	  add $t3, $t2, $t0	
+	# _tmp70 = xs + _tmp69
+	  lw $t4, -8($fp)	# load xs from $fp-8 into $t4
+	  add $t5, $t4, $t3	
+	# *(_tmp70) = _tmp57
+	  lw $t6, -248($fp)	# load _tmp57 from $fp-248 into $t6
+	  sw $t6, 0($t5) 	# store with offset
+	# _tmp71 = *(_tmp70)
+	  lw $t7, 0($t5) 	# load with offset
+	# _tmp72 = 7
+	  li $s0, 7		# load constant value 7 into $s0
+	# _tmp73 = 0
+	  li $s1, 0		# load constant value 0 into $s1
+	# _tmp74 = _tmp73 - _tmp72
+	  sub $s2, $s1, $s0	
+	# _tmp75 = 4
+	  li $s3, 4		# load constant value 4 into $s3
+	# _tmp76 = 0
+	  li $s4, 0		# load constant value 0 into $s4
+	# _tmp77 = *(xs)
+	  lw $s5, 0($t4) 	# load with offset
+	# _tmp78 = _tmp75 < _tmp76
+	  slt $s6, $s3, $s4	
+	# _tmp79 = _tmp77 < _tmp75
+	  slt $s7, $s5, $s3	
+	# _tmp80 = _tmp77 == _tmp75
+	  seq $t8, $s5, $s3	
+	# _tmp81 = _tmp79 || _tmp80
+	  or $t9, $s7, $t8	
+	# _tmp82 = _tmp81 || _tmp78
+	  or $t1, $t9, $s6	
+	# IfZ _tmp82 Goto main._L5
+	# (save modified registers before flow of control change)
+	  sw $t0, -288($fp)	# spill _tmp67 from $t0 to $fp-288
+	  sw $t1, -348($fp)	# spill _tmp82 from $t1 to $fp-348
+	  sw $t2, -292($fp)	# spill _tmp68 from $t2 to $fp-292
+	  sw $t3, -296($fp)	# spill _tmp69 from $t3 to $fp-296
+	  sw $t5, -300($fp)	# spill _tmp70 from $t5 to $fp-300
+	  sw $t7, -304($fp)	# spill _tmp71 from $t7 to $fp-304
+	  sw $s0, -308($fp)	# spill _tmp72 from $s0 to $fp-308
+	  sw $s1, -312($fp)	# spill _tmp73 from $s1 to $fp-312
+	  sw $s2, -316($fp)	# spill _tmp74 from $s2 to $fp-316
+	  sw $s3, -320($fp)	# spill _tmp75 from $s3 to $fp-320
+	  sw $s4, -324($fp)	# spill _tmp76 from $s4 to $fp-324
+	  sw $s5, -328($fp)	# spill _tmp77 from $s5 to $fp-328
+	  sw $s6, -332($fp)	# spill _tmp78 from $s6 to $fp-332
+	  sw $s7, -336($fp)	# spill _tmp79 from $s7 to $fp-336
+	  sw $t8, -340($fp)	# spill _tmp80 from $t8 to $fp-340
+	  sw $t9, -344($fp)	# spill _tmp81 from $t9 to $fp-344
+	  beqz $t1, main._L5	# branch if _tmp82 is zero 
+	# _tmp83 = "Decaf runtime error: Array subscript out of bound..."
+	  .data			# create string constant marked with label
+	  main._string6: .asciiz "Decaf runtime error: Array subscript out of bounds\n"
+	  .text
+	  la $t0, main._string6	# load label
+	# PushParam _tmp83
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -352($fp)	# spill _tmp83 from $t0 to $fp-352
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# LCall _Halt
+	  jal _Halt          	# jump to function
+  main._L5:
+	# _tmp84 = 4
+	  li $t0, 4		# load constant value 4 into $t0
+	# _tmp85 = _tmp75 * _tmp84
+	  lw $t1, -320($fp)	# load _tmp75 from $fp-320 into $t1
+	  sll $t2, $t1, 2	# $t1 * 4 by shifting
+	# _tmp86 = _tmp85 + _tmp84
+	  add $t3, $t2, $t0	
+	# _tmp87 = xs + _tmp86
+	  lw $t4, -8($fp)	# load xs from $fp-8 into $t4
+	  add $t5, $t4, $t3	
+	# *(_tmp87) = _tmp74
+	  lw $t6, -316($fp)	# load _tmp74 from $fp-316 into $t6
+	  sw $t6, 0($t5) 	# store with offset
+	# _tmp88 = *(_tmp87)
+	  lw $t7, 0($t5) 	# load with offset
+	# _tmp89 = 100
+	  li $s0, 100		# load constant value 100 into $s0
+	# _tmp90 = 5
+	  li $s1, 5		# load constant value 5 into $s1
+	# _tmp91 = 0
+	  li $s2, 0		# load constant value 0 into $s2
+	# _tmp92 = *(xs)
+	  lw $s3, 0($t4) 	# load with offset
+	# _tmp93 = _tmp90 < _tmp91
+	  slt $s4, $s1, $s2	
+	# _tmp94 = _tmp92 < _tmp90
+	  slt $s5, $s3, $s1	
+	# _tmp95 = _tmp92 == _tmp90
+	  seq $s6, $s3, $s1	
+	# _tmp96 = _tmp94 || _tmp95
+	  or $s7, $s5, $s6	
+	# _tmp97 = _tmp96 || _tmp93
+	  or $t8, $s7, $s4	
+	# IfZ _tmp97 Goto main._L6
+	# (save modified registers before flow of control change)
+	  sw $t0, -356($fp)	# spill _tmp84 from $t0 to $fp-356
+	  sw $t2, -360($fp)	# spill _tmp85 from $t2 to $fp-360
+	  sw $t3, -364($fp)	# spill _tmp86 from $t3 to $fp-364
+	  sw $t5, -368($fp)	# spill _tmp87 from $t5 to $fp-368
+	  sw $t7, -372($fp)	# spill _tmp88 from $t7 to $fp-372
+	  sw $s0, -376($fp)	# spill _tmp89 from $s0 to $fp-376
+	  sw $s1, -380($fp)	# spill _tmp90 from $s1 to $fp-380
+	  sw $s2, -384($fp)	# spill _tmp91 from $s2 to $fp-384
+	  sw $s3, -388($fp)	# spill _tmp92 from $s3 to $fp-388
+	  sw $s4, -392($fp)	# spill _tmp93 from $s4 to $fp-392
+	  sw $s5, -396($fp)	# spill _tmp94 from $s5 to $fp-396
+	  sw $s6, -400($fp)	# spill _tmp95 from $s6 to $fp-400
+	  sw $s7, -404($fp)	# spill _tmp96 from $s7 to $fp-404
+	  sw $t8, -408($fp)	# spill _tmp97 from $t8 to $fp-408
+	  beqz $t8, main._L6	# branch if _tmp97 is zero 
+	# _tmp98 = "Decaf runtime error: Array subscript out of bound..."
+	  .data			# create string constant marked with label
+	  main._string7: .asciiz "Decaf runtime error: Array subscript out of bounds\n"
+	  .text
+	  la $t0, main._string7	# load label
+	# PushParam _tmp98
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -412($fp)	# spill _tmp98 from $t0 to $fp-412
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# LCall _Halt
+	  jal _Halt          	# jump to function
+  main._L6:
+	# _tmp99 = 4
+	  li $t0, 4		# load constant value 4 into $t0
+	# _tmp100 = _tmp90 * _tmp99
+	  lw $t1, -380($fp)	# load _tmp90 from $fp-380 into $t1
+	  sll $t2, $t1, 2	# $t1 * 4 by shifting
+	# _tmp101 = _tmp100 + _tmp99
+	  add $t3, $t2, $t0	
+	# _tmp102 = xs + _tmp101
+	  lw $t4, -8($fp)	# load xs from $fp-8 into $t4
+	  add $t5, $t4, $t3	
+	# *(_tmp102) = _tmp89
+	  lw $t6, -376($fp)	# load _tmp89 from $fp-376 into $t6
+	  sw $t6, 0($t5) 	# store with offset
+	# _tmp103 = *(_tmp102)
+	  lw $t7, 0($t5) 	# load with offset
+	# _tmp104 = 100
+	  li $s0, 100		# load constant value 100 into $s0
+	# _tmp105 = 0
+	  li $s1, 0		# load constant value 0 into $s1
+	# _tmp106 = _tmp105 - _tmp104
+	  sub $s2, $s1, $s0	
+	# _tmp107 = 6
+	  li $s3, 6		# load constant value 6 into $s3
+	# _tmp108 = 0
+	  li $s4, 0		# load constant value 0 into $s4
+	# _tmp109 = *(xs)
+	  lw $s5, 0($t4) 	# load with offset
+	# _tmp110 = _tmp107 < _tmp108
+	  slt $s6, $s3, $s4	
+	# _tmp111 = _tmp109 < _tmp107
+	  slt $s7, $s5, $s3	
+	# _tmp112 = _tmp109 == _tmp107
+	  seq $t8, $s5, $s3	
+	# _tmp113 = _tmp111 || _tmp112
+	  or $t9, $s7, $t8	
+	# _tmp114 = _tmp113 || _tmp110
+	  or $t1, $t9, $s6	
+	# IfZ _tmp114 Goto main._L7
+	# (save modified registers before flow of control change)
+	  sw $t0, -416($fp)	# spill _tmp99 from $t0 to $fp-416
+	  sw $t1, -476($fp)	# spill _tmp114 from $t1 to $fp-476
+	  sw $t2, -420($fp)	# spill _tmp100 from $t2 to $fp-420
+	  sw $t3, -424($fp)	# spill _tmp101 from $t3 to $fp-424
+	  sw $t5, -428($fp)	# spill _tmp102 from $t5 to $fp-428
+	  sw $t7, -432($fp)	# spill _tmp103 from $t7 to $fp-432
+	  sw $s0, -436($fp)	# spill _tmp104 from $s0 to $fp-436
+	  sw $s1, -440($fp)	# spill _tmp105 from $s1 to $fp-440
+	  sw $s2, -444($fp)	# spill _tmp106 from $s2 to $fp-444
+	  sw $s3, -448($fp)	# spill _tmp107 from $s3 to $fp-448
+	  sw $s4, -452($fp)	# spill _tmp108 from $s4 to $fp-452
+	  sw $s5, -456($fp)	# spill _tmp109 from $s5 to $fp-456
+	  sw $s6, -460($fp)	# spill _tmp110 from $s6 to $fp-460
+	  sw $s7, -464($fp)	# spill _tmp111 from $s7 to $fp-464
+	  sw $t8, -468($fp)	# spill _tmp112 from $t8 to $fp-468
+	  sw $t9, -472($fp)	# spill _tmp113 from $t9 to $fp-472
+	  beqz $t1, main._L7	# branch if _tmp114 is zero 
+	# _tmp115 = "Decaf runtime error: Array subscript out of bound..."
+	  .data			# create string constant marked with label
+	  main._string8: .asciiz "Decaf runtime error: Array subscript out of bounds\n"
+	  .text
+	  la $t0, main._string8	# load label
+	# PushParam _tmp115
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -480($fp)	# spill _tmp115 from $t0 to $fp-480
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# LCall _Halt
+	  jal _Halt          	# jump to function
+  main._L7:
+	# _tmp116 = 4
+	  li $t0, 4		# load constant value 4 into $t0
+	# _tmp117 = _tmp107 * _tmp116
+	  lw $t1, -448($fp)	# load _tmp107 from $fp-448 into $t1
+	  sll $t2, $t1, 2	# $t1 * 4 by shifting
+	# _tmp118 = _tmp117 + _tmp116
+	  add $t3, $t2, $t0	
+	# _tmp119 = xs + _tmp118
+	  lw $t4, -8($fp)	# load xs from $fp-8 into $t4
+	  add $t5, $t4, $t3	
+	# *(_tmp119) = _tmp106
+	  lw $t6, -444($fp)	# load _tmp106 from $fp-444 into $t6
+	  sw $t6, 0($t5) 	# store with offset
+	# _tmp120 = *(_tmp119)
+	  lw $t7, 0($t5) 	# load with offset
+	# _tmp121 = 10007
+	  li $s0, 10007		# load constant value 10007 into $s0
+	# _tmp122 = 7
+	  li $s1, 7		# load constant value 7 into $s1
+	# _tmp123 = 0
+	  li $s2, 0		# load constant value 0 into $s2
+	# _tmp124 = *(xs)
+	  lw $s3, 0($t4) 	# load with offset
+	# _tmp125 = _tmp122 < _tmp123
+	  slt $s4, $s1, $s2	
+	# _tmp126 = _tmp124 < _tmp122
+	  slt $s5, $s3, $s1	
+	# _tmp127 = _tmp124 == _tmp122
+	  seq $s6, $s3, $s1	
+	# _tmp128 = _tmp126 || _tmp127
+	  or $s7, $s5, $s6	
+	# _tmp129 = _tmp128 || _tmp125
+	  or $t8, $s7, $s4	
+	# IfZ _tmp129 Goto main._L8
+	# (save modified registers before flow of control change)
+	  sw $t0, -484($fp)	# spill _tmp116 from $t0 to $fp-484
+	  sw $t2, -488($fp)	# spill _tmp117 from $t2 to $fp-488
+	  sw $t3, -492($fp)	# spill _tmp118 from $t3 to $fp-492
+	  sw $t5, -496($fp)	# spill _tmp119 from $t5 to $fp-496
+	  sw $t7, -500($fp)	# spill _tmp120 from $t7 to $fp-500
+	  sw $s0, -504($fp)	# spill _tmp121 from $s0 to $fp-504
+	  sw $s1, -508($fp)	# spill _tmp122 from $s1 to $fp-508
+	  sw $s2, -512($fp)	# spill _tmp123 from $s2 to $fp-512
+	  sw $s3, -516($fp)	# spill _tmp124 from $s3 to $fp-516
+	  sw $s4, -520($fp)	# spill _tmp125 from $s4 to $fp-520
+	  sw $s5, -524($fp)	# spill _tmp126 from $s5 to $fp-524
+	  sw $s6, -528($fp)	# spill _tmp127 from $s6 to $fp-528
+	  sw $s7, -532($fp)	# spill _tmp128 from $s7 to $fp-532
+	  sw $t8, -536($fp)	# spill _tmp129 from $t8 to $fp-536
+	  beqz $t8, main._L8	# branch if _tmp129 is zero 
+	# _tmp130 = "Decaf runtime error: Array subscript out of bound..."
+	  .data			# create string constant marked with label
+	  main._string9: .asciiz "Decaf runtime error: Array subscript out of bounds\n"
+	  .text
+	  la $t0, main._string9	# load label
+	# PushParam _tmp130
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -540($fp)	# spill _tmp130 from $t0 to $fp-540
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# LCall _Halt
+	  jal _Halt          	# jump to function
+  main._L8:
+	# _tmp131 = 4
+	  li $t0, 4		# load constant value 4 into $t0
+	# _tmp132 = _tmp122 * _tmp131
+	  lw $t1, -508($fp)	# load _tmp122 from $fp-508 into $t1
+	  sll $t2, $t1, 2	# $t1 * 4 by shifting
+	# _tmp133 = _tmp132 + _tmp131
+	  add $t3, $t2, $t0	
+	# _tmp134 = xs + _tmp133
+	  lw $t4, -8($fp)	# load xs from $fp-8 into $t4
+	  add $t5, $t4, $t3	
+	# *(_tmp134) = _tmp121
+	  lw $t6, -504($fp)	# load _tmp121 from $fp-504 into $t6
+	  sw $t6, 0($t5) 	# store with offset
+	# _tmp135 = *(_tmp134)
+	  lw $t7, 0($t5) 	# load with offset
+	# _tmp136 = 20015
+	  li $s0, 20015		# load constant value 20015 into $s0
+	# _tmp137 = 0
+	  li $s1, 0		# load constant value 0 into $s1
+	# _tmp138 = _tmp137 - _tmp136
+	  sub $s2, $s1, $s0	
+	# _tmp139 = 8
+	  li $s3, 8		# load constant value 8 into $s3
+	# _tmp140 = 0
+	  li $s4, 0		# load constant value 0 into $s4
+	# _tmp141 = *(xs)
+	  lw $s5, 0($t4) 	# load with offset
+	# _tmp142 = _tmp139 < _tmp140
+	  slt $s6, $s3, $s4	
+	# _tmp143 = _tmp141 < _tmp139
+	  slt $s7, $s5, $s3	
+	# _tmp144 = _tmp141 == _tmp139
+	  seq $t8, $s5, $s3	
+	# _tmp145 = _tmp143 || _tmp144
+	  or $t9, $s7, $t8	
+	# _tmp146 = _tmp145 || _tmp142
+	  or $t1, $t9, $s6	
+	# IfZ _tmp146 Goto main._L9
+	# (save modified registers before flow of control change)
+	  sw $t0, -544($fp)	# spill _tmp131 from $t0 to $fp-544
+	  sw $t1, -604($fp)	# spill _tmp146 from $t1 to $fp-604
+	  sw $t2, -548($fp)	# spill _tmp132 from $t2 to $fp-548
+	  sw $t3, -552($fp)	# spill _tmp133 from $t3 to $fp-552
+	  sw $t5, -556($fp)	# spill _tmp134 from $t5 to $fp-556
+	  sw $t7, -560($fp)	# spill _tmp135 from $t7 to $fp-560
+	  sw $s0, -564($fp)	# spill _tmp136 from $s0 to $fp-564
+	  sw $s1, -568($fp)	# spill _tmp137 from $s1 to $fp-568
+	  sw $s2, -572($fp)	# spill _tmp138 from $s2 to $fp-572
+	  sw $s3, -576($fp)	# spill _tmp139 from $s3 to $fp-576
+	  sw $s4, -580($fp)	# spill _tmp140 from $s4 to $fp-580
+	  sw $s5, -584($fp)	# spill _tmp141 from $s5 to $fp-584
+	  sw $s6, -588($fp)	# spill _tmp142 from $s6 to $fp-588
+	  sw $s7, -592($fp)	# spill _tmp143 from $s7 to $fp-592
+	  sw $t8, -596($fp)	# spill _tmp144 from $t8 to $fp-596
+	  sw $t9, -600($fp)	# spill _tmp145 from $t9 to $fp-600
+	  beqz $t1, main._L9	# branch if _tmp146 is zero 
+	# _tmp147 = "Decaf runtime error: Array subscript out of bound..."
+	  .data			# create string constant marked with label
+	  main._string10: .asciiz "Decaf runtime error: Array subscript out of bounds\n"
+	  .text
+	  la $t0, main._string10	# load label
+	# PushParam _tmp147
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -608($fp)	# spill _tmp147 from $t0 to $fp-608
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# LCall _Halt
+	  jal _Halt          	# jump to function
+  main._L9:
+	# _tmp148 = 4
+	  li $t0, 4		# load constant value 4 into $t0
+	# _tmp149 = _tmp139 * _tmp148
+	  lw $t1, -576($fp)	# load _tmp139 from $fp-576 into $t1
+	  sll $t2, $t1, 2	# $t1 * 4 by shifting
+	# _tmp150 = _tmp149 + _tmp148
+	  add $t3, $t2, $t0	
+	# _tmp151 = xs + _tmp150
+	  lw $t4, -8($fp)	# load xs from $fp-8 into $t4
+	  add $t5, $t4, $t3	
+	# *(_tmp151) = _tmp138
+	  lw $t6, -572($fp)	# load _tmp138 from $fp-572 into $t6
+	  sw $t6, 0($t5) 	# store with offset
+	# _tmp152 = *(_tmp151)
+	  lw $t7, 0($t5) 	# load with offset
+	# _tmp153 = 123456789
+	  li $s0, 123456789		# load constant value 123456789 into $s0
+	# _tmp154 = 9
+	  li $s1, 9		# load constant value 9 into $s1
+	# _tmp155 = 0
+	  li $s2, 0		# load constant value 0 into $s2
+	# _tmp156 = *(xs)
+	  lw $s3, 0($t4) 	# load with offset
+	# _tmp157 = _tmp154 < _tmp155
+	  slt $s4, $s1, $s2	
+	# _tmp158 = _tmp156 < _tmp154
+	  slt $s5, $s3, $s1	
+	# _tmp159 = _tmp156 == _tmp154
+	  seq $s6, $s3, $s1	
+	# _tmp160 = _tmp158 || _tmp159
+	  or $s7, $s5, $s6	
+	# _tmp161 = _tmp160 || _tmp157
+	  or $t8, $s7, $s4	
+	# IfZ _tmp161 Goto main._L10
+	# (save modified registers before flow of control change)
+	  sw $t0, -612($fp)	# spill _tmp148 from $t0 to $fp-612
+	  sw $t2, -616($fp)	# spill _tmp149 from $t2 to $fp-616
+	  sw $t3, -620($fp)	# spill _tmp150 from $t3 to $fp-620
+	  sw $t5, -624($fp)	# spill _tmp151 from $t5 to $fp-624
+	  sw $t7, -628($fp)	# spill _tmp152 from $t7 to $fp-628
+	  sw $s0, -632($fp)	# spill _tmp153 from $s0 to $fp-632
+	  sw $s1, -636($fp)	# spill _tmp154 from $s1 to $fp-636
+	  sw $s2, -640($fp)	# spill _tmp155 from $s2 to $fp-640
+	  sw $s3, -644($fp)	# spill _tmp156 from $s3 to $fp-644
+	  sw $s4, -648($fp)	# spill _tmp157 from $s4 to $fp-648
+	  sw $s5, -652($fp)	# spill _tmp158 from $s5 to $fp-652
+	  sw $s6, -656($fp)	# spill _tmp159 from $s6 to $fp-656
+	  sw $s7, -660($fp)	# spill _tmp160 from $s7 to $fp-660
+	  sw $t8, -664($fp)	# spill _tmp161 from $t8 to $fp-664
+	  beqz $t8, main._L10	# branch if _tmp161 is zero 
+	# _tmp162 = "Decaf runtime error: Array subscript out of bound..."
+	  .data			# create string constant marked with label
+	  main._string11: .asciiz "Decaf runtime error: Array subscript out of bounds\n"
+	  .text
+	  la $t0, main._string11	# load label
+	# PushParam _tmp162
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -668($fp)	# spill _tmp162 from $t0 to $fp-668
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# LCall _Halt
+	  jal _Halt          	# jump to function
+  main._L10:
+	# _tmp163 = 4
+	  li $t0, 4		# load constant value 4 into $t0
+	# _tmp164 = _tmp154 * _tmp163
+	  lw $t1, -636($fp)	# load _tmp154 from $fp-636 into $t1
+	  sll $t2, $t1, 2	# $t1 * 4 by shifting
+	# _tmp165 = _tmp164 + _tmp163
+	  add $t3, $t2, $t0	
+	# _tmp166 = xs + _tmp165
+	  lw $t4, -8($fp)	# load xs from $fp-8 into $t4
+	  add $t5, $t4, $t3	
+	# *(_tmp166) = _tmp153
+	  lw $t6, -632($fp)	# load _tmp153 from $fp-632 into $t6
+	  sw $t6, 0($t5) 	# store with offset
+	# _tmp167 = *(_tmp166)
+	  lw $t7, 0($t5) 	# load with offset
+	# _tmp168 = 987654321
+	  li $s0, 987654321		# load constant value 987654321 into $s0
+	# _tmp169 = 0
+	  li $s1, 0		# load constant value 0 into $s1
+	# _tmp170 = _tmp169 - _tmp168
+	  sub $s2, $s1, $s0	
+	# _tmp171 = 10
+	  li $s3, 10		# load constant value 10 into $s3
+	# _tmp172 = 0
+	  li $s4, 0		# load constant value 0 into $s4
+	# _tmp173 = *(xs)
+	  lw $s5, 0($t4) 	# load with offset
+	# _tmp174 = _tmp171 < _tmp172
+	  slt $s6, $s3, $s4	
+	# _tmp175 = _tmp173 < _tmp171
+	  slt $s7, $s5, $s3	
+	# _tmp176 = _tmp173 == _tmp171
+	  seq $t8, $s5, $s3	
+	# _tmp177 = _tmp175 || _tmp176
+	  or $t9, $s7, $t8	
+	# _tmp178 = _tmp177 || _tmp174
+	  or $t1, $t9, $s6	
+	# IfZ _tmp178 Goto main._L11
+	# (save modified registers before flow of control change)
+	  sw $t0, -672($fp)	# spill _tmp163 from $t0 to $fp-672
+	  sw $t1, -732($fp)	# spill _tmp178 from $t1 to $fp-732
+	  sw $t2, -676($fp)	# spill _tmp164 from $t2 to $fp-676
+	  sw $t3, -680($fp)	# spill _tmp165 from $t3 to $fp-680
+	  sw $t5, -684($fp)	# spill _tmp166 from $t5 to $fp-684
+	  sw $t7, -688($fp)	# spill _tmp167 from $t7 to $fp-688
+	  sw $s0, -692($fp)	# spill _tmp168 from $s0 to $fp-692
+	  sw $s1, -696($fp)	# spill _tmp169 from $s1 to $fp-696
+	  sw $s2, -700($fp)	# spill _tmp170 from $s2 to $fp-700
+	  sw $s3, -704($fp)	# spill _tmp171 from $s3 to $fp-704
+	  sw $s4, -708($fp)	# spill _tmp172 from $s4 to $fp-708
+	  sw $s5, -712($fp)	# spill _tmp173 from $s5 to $fp-712
+	  sw $s6, -716($fp)	# spill _tmp174 from $s6 to $fp-716
+	  sw $s7, -720($fp)	# spill _tmp175 from $s7 to $fp-720
+	  sw $t8, -724($fp)	# spill _tmp176 from $t8 to $fp-724
+	  sw $t9, -728($fp)	# spill _tmp177 from $t9 to $fp-728
+	  beqz $t1, main._L11	# branch if _tmp178 is zero 
+	# _tmp179 = "Decaf runtime error: Array subscript out of bound..."
+	  .data			# create string constant marked with label
+	  main._string12: .asciiz "Decaf runtime error: Array subscript out of bounds\n"
+	  .text
+	  la $t0, main._string12	# load label
+	# PushParam _tmp179
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -736($fp)	# spill _tmp179 from $t0 to $fp-736
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# LCall _Halt
+	  jal _Halt          	# jump to function
+  main._L11:
+	# _tmp180 = 4
+	  li $t0, 4		# load constant value 4 into $t0
+	# _tmp181 = _tmp171 * _tmp180
+	  lw $t1, -704($fp)	# load _tmp171 from $fp-704 into $t1
+	  sll $t2, $t1, 2	# $t1 * 4 by shifting
+	# _tmp182 = _tmp181 + _tmp180
+	  add $t3, $t2, $t0	
+	# _tmp183 = xs + _tmp182
+	  lw $t4, -8($fp)	# load xs from $fp-8 into $t4
+	  add $t5, $t4, $t3	
+	# *(_tmp183) = _tmp170
+	  lw $t6, -700($fp)	# load _tmp170 from $fp-700 into $t6
+	  sw $t6, 0($t5) 	# store with offset
+	# _tmp184 = *(_tmp183)
+	  lw $t7, 0($t5) 	# load with offset
+	# _tmp185 = 2147483647
+	  li $s0, 2147483647		# load constant value 2147483647 into $s0
+	# _tmp186 = 11
+	  li $s1, 11		# load constant value 11 into $s1
+	# _tmp187 = 0
+	  li $s2, 0		# load constant value 0 into $s2
+	# _tmp188 = *(xs)
+	  lw $s3, 0($t4) 	# load with offset
+	# _tmp189 = _tmp186 < _tmp187
+	  slt $s4, $s1, $s2	
+	# _tmp190 = _tmp188 < _tmp186
+	  slt $s5, $s3, $s1	
+	# _tmp191 = _tmp188 == _tmp186
+	  seq $s6, $s3, $s1	
+	# _tmp192 = _tmp190 || _tmp191
+	  or $s7, $s5, $s6	
+	# _tmp193 = _tmp192 || _tmp189
+	  or $t8, $s7, $s4	
+	# IfZ _tmp193 Goto main._L12
+	# (save modified registers before flow of control change)
+	  sw $t0, -740($fp)	# spill _tmp180 from $t0 to $fp-740
+	  sw $t2, -744($fp)	# spill _tmp181 from $t2 to $fp-744
+	  sw $t3, -748($fp)	# spill _tmp182 from $t3 to $fp-748
+	  sw $t5, -752($fp)	# spill _tmp183 from $t5 to $fp-752
+	  sw $t7, -756($fp)	# spill _tmp184 from $t7 to $fp-756
+	  sw $s0, -760($fp)	# spill _tmp185 from $s0 to $fp-760
+	  sw $s1, -764($fp)	# spill _tmp186 from $s1 to $fp-764
+	  sw $s2, -768($fp)	# spill _tmp187 from $s2 to $fp-768
+	  sw $s3, -772($fp)	# spill _tmp188 from $s3 to $fp-772
+	  sw $s4, -776($fp)	# spill _tmp189 from $s4 to $fp-776
+	  sw $s5, -780($fp)	# spill _tmp190 from $s5 to $fp-780
+	  sw $s6, -784($fp)	# spill _tmp191 from $s6 to $fp-784
+	  sw $s7, -788($fp)	# spill _tmp192 from $s7 to $fp-788
+	  sw $t8, -792($fp)	# spill _tmp193 from $t8 to $fp-792
+	  beqz $t8, main._L12	# branch if _tmp193 is zero 
+	# _tmp194 = "Decaf runtime error: Array subscript out of bound..."
+	  .data			# create string constant marked with label
+	  main._string13: .asciiz "Decaf runtime error: Array subscript out of bounds\n"
+	  .text
+	  la $t0, main._string13	# load label
+	# PushParam _tmp194
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -796($fp)	# spill _tmp194 from $t0 to $fp-796
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# LCall _Halt
+	  jal _Halt          	# jump to function
+  main._L12:
+	# _tmp195 = 4
+	  li $t0, 4		# load constant value 4 into $t0
+	# _tmp196 = _tmp186 * _tmp195
+	  lw $t1, -764($fp)	# load _tmp186 from $fp-764 into $t1
+	  sll $t2, $t1, 2	# $t1 * 4 by shifting
+	# _tmp197 = _tmp196 + _tmp195
+	  add $t3, $t2, $t0	
+	# _tmp198 = xs + _tmp197
+	  lw $t4, -8($fp)	# load xs from $fp-8 into $t4
+	  add $t5, $t4, $t3	
+	# *(_tmp198) = _tmp185
+	  lw $t6, -760($fp)	# load _tmp185 from $fp-760 into $t6
+	  sw $t6, 0($t5) 	# store with offset
+	# _tmp199 = *(_tmp198)
+	  lw $t7, 0($t5) 	# load with offset
+	# _tmp200 = 2147483647
+	  li $s0, 2147483647		# load constant value 2147483647 into $s0
+	# _tmp201 = 0
+	  li $s1, 0		# load constant value 0 into $s1
+	# _tmp202 = _tmp201 - _tmp200
+	  sub $s2, $s1, $s0	
+	# _tmp203 = 12
+	  li $s3, 12		# load constant value 12 into $s3
+	# _tmp204 = 0
+	  li $s4, 0		# load constant value 0 into $s4
+	# _tmp205 = *(xs)
+	  lw $s5, 0($t4) 	# load with offset
+	# _tmp206 = _tmp203 < _tmp204
+	  slt $s6, $s3, $s4	
+	# _tmp207 = _tmp205 < _tmp203
+	  slt $s7, $s5, $s3	
+	# _tmp208 = _tmp205 == _tmp203
+	  seq $t8, $s5, $s3	
+	# _tmp209 = _tmp207 || _tmp208
+	  or $t9, $s7, $t8	
+	# _tmp210 = _tmp209 || _tmp206
+	  or $t1, $t9, $s6	
+	# IfZ _tmp210 Goto main._L13
+	# (save modified registers before flow of control change)
+	  sw $t0, -800($fp)	# spill _tmp195 from $t0 to $fp-800
+	  sw $t1, -860($fp)	# spill _tmp210 from $t1 to $fp-860
+	  sw $t2, -804($fp)	# spill _tmp196 from $t2 to $fp-804
+	  sw $t3, -808($fp)	# spill _tmp197 from $t3 to $fp-808
+	  sw $t5, -812($fp)	# spill _tmp198 from $t5 to $fp-812
+	  sw $t7, -816($fp)	# spill _tmp199 from $t7 to $fp-816
+	  sw $s0, -820($fp)	# spill _tmp200 from $s0 to $fp-820
+	  sw $s1, -824($fp)	# spill _tmp201 from $s1 to $fp-824
+	  sw $s2, -828($fp)	# spill _tmp202 from $s2 to $fp-828
+	  sw $s3, -832($fp)	# spill _tmp203 from $s3 to $fp-832
+	  sw $s4, -836($fp)	# spill _tmp204 from $s4 to $fp-836
+	  sw $s5, -840($fp)	# spill _tmp205 from $s5 to $fp-840
+	  sw $s6, -844($fp)	# spill _tmp206 from $s6 to $fp-844
+	  sw $s7, -848($fp)	# spill _tmp207 from $s7 to $fp-848
+	  sw $t8, -852($fp)	# spill _tmp208 from $t8 to $fp-852
+	  sw $t9, -856($fp)	# spill _tmp209 from $t9 to $fp-856
+	  beqz $t1, main._L13	# branch if _tmp210 is zero 
+	# _tmp211 = "Decaf runtime error: Array subscript out of bound..."
+	  .data			# create string constant marked with label
+	  main._string14: .asciiz "Decaf runtime error: Array subscript out of bounds\n"
+	  .text
+	  la $t0, main._string14	# load label
+	# PushParam _tmp211
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -864($fp)	# spill _tmp211 from $t0 to $fp-864
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# LCall _Halt
+	  jal _Halt          	# jump to function
+  main._L13:
+	# _tmp212 = 4
+	  li $t0, 4		# load constant value 4 into $t0
+	# _tmp213 = _tmp203 * _tmp212
+	  lw $t1, -832($fp)	# load _tmp203 from $fp-832 into $t1
+	  sll $t2, $t1, 2	# $t1 * 4 by shifting
+	# _tmp214 = _tmp213 + _tmp212
+	  add $t3, $t2, $t0	
+	# _tmp215 = xs + _tmp214
+	  lw $t4, -8($fp)	# load xs from $fp-8 into $t4
+	  add $t5, $t4, $t3	
+	# *(_tmp215) = _tmp202
+	  lw $t6, -828($fp)	# load _tmp202 from $fp-828 into $t6
+	  sw $t6, 0($t5) 	# store with offset
+	# _tmp216 = *(_tmp215)
+	  lw $t7, 0($t5) 	# load with offset
+	# _tmp217 = 2147483647
+	  li $s0, 2147483647		# load constant value 2147483647 into $s0
+	# _tmp218 = 0
+	  li $s1, 0		# load constant value 0 into $s1
+	# _tmp219 = _tmp218 - _tmp217
+	  sub $s2, $s1, $s0	
+	# _tmp220 = 1
+	  li $s3, 1		# load constant value 1 into $s3
+	# _tmp221 = _tmp219 - _tmp220
+	  sub $s4, $s2, $s3	
+	# _tmp222 = 13
+	  li $s5, 13		# load constant value 13 into $s5
+	# _tmp223 = 0
+	  li $s6, 0		# load constant value 0 into $s6
+	# _tmp224 = *(xs)
+	  lw $s7, 0($t4) 	# load with offset
+	# _tmp225 = _tmp222 < _tmp223
+	  slt $t8, $s5, $s6	
+	# _tmp226 = _tmp224 < _tmp222
+	  slt $t9, $s7, $s5	
+	# _tmp227 = _tmp224 == _tmp222
+	  seq $t1, $s7, $s5	
+	# _tmp228 = _tmp226 || _tmp227
+	  or $t4, $t9, $t1	
+	# _tmp229 = _tmp228 || _tmp225
+	  or $t6, $t4, $t8	
+	# IfZ _tmp229 Goto main._L14
+	# (save modified registers before flow of control change)
+	  sw $t0, -868($fp)	# spill _tmp212 from $t0 to $fp-868
+	  sw $t1, -928($fp)	# spill _tmp227 from $t1 to $fp-928
+	  sw $t2, -872($fp)	# spill _tmp213 from $t2 to $fp-872
+	  sw $t3, -876($fp)	# spill _tmp214 from $t3 to $fp-876
+	  sw $t4, -932($fp)	# spill _tmp228 from $t4 to $fp-932
+	  sw $t5, -880($fp)	# spill _tmp215 from $t5 to $fp-880
+	  sw $t6, -936($fp)	# spill _tmp229 from $t6 to $fp-936
+	  sw $t7, -884($fp)	# spill _tmp216 from $t7 to $fp-884
+	  sw $s0, -888($fp)	# spill _tmp217 from $s0 to $fp-888
+	  sw $s1, -892($fp)	# spill _tmp218 from $s1 to $fp-892
+	  sw $s2, -896($fp)	# spill _tmp219 from $s2 to $fp-896
+	  sw $s3, -900($fp)	# spill _tmp220 from $s3 to $fp-900
+	  sw $s4, -904($fp)	# spill _tmp221 from $s4 to $fp-904
+	  sw $s5, -908($fp)	# spill _tmp222 from $s5 to $fp-908
+	  sw $s6, -912($fp)	# spill _tmp223 from $s6 to $fp-912
+	  sw $s7, -916($fp)	# spill _tmp224 from $s7 to $fp-916
+	  sw $t8, -920($fp)	# spill _tmp225 from $t8 to $fp-920
+	  sw $t9, -924($fp)	# spill _tmp226 from $t9 to $fp-924
+	  beqz $t6, main._L14	# branch if _tmp229 is zero 
+	# _tmp230 = "Decaf runtime error: Array subscript out of bound..."
+	  .data			# create string constant marked with label
+	  main._string15: .asciiz "Decaf runtime error: Array subscript out of bounds\n"
+	  .text
+	  la $t0, main._string15	# load label
+	# PushParam _tmp230
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -940($fp)	# spill _tmp230 from $t0 to $fp-940
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# LCall _Halt
+	  jal _Halt          	# jump to function
+  main._L14:
+	# _tmp231 = 4
+	  li $t0, 4		# load constant value 4 into $t0
+	# _tmp232 = _tmp222 * _tmp231
+	  lw $t1, -908($fp)	# load _tmp222 from $fp-908 into $t1
+	  sll $t2, $t1, 2	# $t1 * 4 by shifting
+	# _tmp233 = _tmp232 + _tmp231
+	  add $t3, $t2, $t0	
+	# _tmp234 = xs + _tmp233
+	  lw $t4, -8($fp)	# load xs from $fp-8 into $t4
+	  add $t5, $t4, $t3	
+	# *(_tmp234) = _tmp221
+	  lw $t6, -904($fp)	# load _tmp221 from $fp-904 into $t6
+	  sw $t6, 0($t5) 	# store with offset
+	# _tmp235 = *(_tmp234)
+	  lw $t7, 0($t5) 	# load with offset
+	# _tmp236 = 0
+	  li $s0, 0		# load constant value 0 into $s0
+	# i = _tmp236
+	  sw $s0, -964($fp)	# spill _tmp236 from $s0 to $fp-964
+	# (save modified registers before flow of control change)
+	  sw $t0, -944($fp)	# spill _tmp231 from $t0 to $fp-944
+	  sw $t2, -948($fp)	# spill _tmp232 from $t2 to $fp-948
+	  sw $t3, -952($fp)	# spill _tmp233 from $t3 to $fp-952
+	  sw $t5, -956($fp)	# spill _tmp234 from $t5 to $fp-956
+	  sw $t7, -960($fp)	# spill _tmp235 from $t7 to $fp-960
+	  sw $s0, -12($fp)	# spill i from $s0 to $fp-12
+  main._L15:
+	# _tmp237 = *(xs)
+	  lw $t0, -8($fp)	# load xs from $fp-8 into $t0
+	  lw $t1, 0($t0) 	# load with offset
+	# _tmp238 = i < _tmp237
+	  lw $t2, -12($fp)	# load i from $fp-12 into $t2
+	  slt $t3, $t2, $t1	
+	# IfZ _tmp238 Goto main._L16
+	# (save modified registers before flow of control change)
+	  sw $t1, -968($fp)	# spill _tmp237 from $t1 to $fp-968
+	  sw $t3, -972($fp)	# spill _tmp238 from $t3 to $fp-972
+	  beqz $t3, main._L16	# branch if _tmp238 is zero 
+	# _tmp239 = 0
+	  li $t0, 0		# load constant value 0 into $t0
+	# _tmp240 = *(xs)
+	  lw $t1, -8($fp)	# load xs from $fp-8 into $t1
+	  lw $t2, 0($t1) 	# load with offset
+	# _tmp241 = i < _tmp239
+	  lw $t3, -12($fp)	# load i from $fp-12 into $t3
+	  slt $t4, $t3, $t0	
+	# _tmp242 = _tmp240 < i
+	  slt $t5, $t2, $t3	
+	# _tmp243 = _tmp240 == i
+	  seq $t6, $t2, $t3	
+	# _tmp244 = _tmp242 || _tmp243
+	  or $t7, $t5, $t6	
+	# _tmp245 = _tmp244 || _tmp241
+	  or $s0, $t7, $t4	
+	# IfZ _tmp245 Goto main._L17
+	# (save modified registers before flow of control change)
+	  sw $t0, -976($fp)	# spill _tmp239 from $t0 to $fp-976
+	  sw $t2, -980($fp)	# spill _tmp240 from $t2 to $fp-980
+	  sw $t4, -984($fp)	# spill _tmp241 from $t4 to $fp-984
+	  sw $t5, -988($fp)	# spill _tmp242 from $t5 to $fp-988
+	  sw $t6, -992($fp)	# spill _tmp243 from $t6 to $fp-992
+	  sw $t7, -996($fp)	# spill _tmp244 from $t7 to $fp-996
+	  sw $s0, -1000($fp)	# spill _tmp245 from $s0 to $fp-1000
+	  beqz $s0, main._L17	# branch if _tmp245 is zero 
+	# _tmp246 = "Decaf runtime error: Array subscript out of bound..."
+	  .data			# create string constant marked with label
+	  main._string16: .asciiz "Decaf runtime error: Array subscript out of bounds\n"
+	  .text
+	  la $t0, main._string16	# load label
+	# PushParam _tmp246
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -1004($fp)	# spill _tmp246 from $t0 to $fp-1004
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# LCall _Halt
+	  jal _Halt          	# jump to function
+  main._L17:
+	# _tmp247 = 4
+	  li $t0, 4		# load constant value 4 into $t0
+	# _tmp248 = i * _tmp247
+	  lw $t1, -12($fp)	# load i from $fp-12 into $t1
+	  sll $t2, $t1, 2	# $t1 * 4 by shifting
+	# _tmp249 = _tmp248 + _tmp247
+	  add $t3, $t2, $t0	
+	# _tmp250 = xs + _tmp249
+	  lw $t4, -8($fp)	# load xs from $fp-8 into $t4
+	  add $t5, $t4, $t3	
+	# _tmp251 = *(_tmp250)
+	  lw $t6, 0($t5) 	# load with offset
+	# PushParam _tmp251
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t6, 4($sp)	# copy param value to stack
+	# LCall ____show
+	# (save modified registers before flow of control change)
+	  sw $t0, -1008($fp)	# spill _tmp247 from $t0 to $fp-1008
+	  sw $t2, -1012($fp)	# spill _tmp248 from $t2 to $fp-1012
+	  sw $t3, -1016($fp)	# spill _tmp249 from $t3 to $fp-1016
+	  sw $t5, -1020($fp)	# spill _tmp250 from $t5 to $fp-1020
+	  sw $t6, -1024($fp)	# spill _tmp251 from $t6 to $fp-1024
+	  jal ____show       	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp252 = 1
+	  li $t0, 1		# load constant value 1 into $t0
+	# _tmp253 = i + _tmp252
+	  lw $t1, -12($fp)	# load i from $fp-12 into $t1
+	  add $t2, $t1, $t0	
+	# i = _tmp253
+	  sw $t2, -1032($fp)	# spill _tmp253 from $t2 to $fp-1032
+	# Goto main._L15
+	# (save modified registers before flow of control change)
+	  sw $t0, -1028($fp)	# spill _tmp252 from $t0 to $fp-1028
+	  sw $t2, -12($fp)	# spill i from $t2 to $fp-12
+	  b main._L15		# unconditional branch
+  main._L16:
+	# _tmp254 = 0
+	  li $t0, 0		# load constant value 0 into $t0
+	# h = _tmp254
+	  sw $t0, -1036($fp)	# spill _tmp254 from $t0 to $fp-1036
+	# _tmp255 = 0
+	  li $t1, 0		# load constant value 0 into $t1
+	# i = _tmp255
+	  sw $t1, -1040($fp)	# spill _tmp255 from $t1 to $fp-1040
+	# (save modified registers before flow of control change)
+	  sw $t0, -16($fp)	# spill h from $t0 to $fp-16
+	  sw $t1, -12($fp)	# spill i from $t1 to $fp-12
+  main._L18:
+	# _tmp256 = 1000
+	  li $t0, 1000		# load constant value 1000 into $t0
+	# _tmp257 = i < _tmp256
+	  lw $t1, -12($fp)	# load i from $fp-12 into $t1
+	  slt $t2, $t1, $t0	
+	# IfZ _tmp257 Goto main._L19
+	# (save modified registers before flow of control change)
+	  sw $t0, -1044($fp)	# spill _tmp256 from $t0 to $fp-1044
+	  sw $t2, -1048($fp)	# spill _tmp257 from $t2 to $fp-1048
+	  beqz $t2, main._L19	# branch if _tmp257 is zero 
+	# _tmp258 = 31
+	  li $t0, 31		# load constant value 31 into $t0
+	# _tmp259 = h * _tmp258
+	  lw $t1, -16($fp)	# load h from $fp-16 into $t1
+	  sll $v1, $t1, 5	# $t1 * 31 by shifting and adding
+	  subu $t2, $v1, $t1
+	# _tmp260 = _tmp259 + i
+	  lw $t3, -12($fp)	# load i from $fp-12 into $t3
+	  add $t4, $t2, $t3	
+	# _tmp261 = 10007
+	  li $t5, 10007		# load constant value 10007 into $t5
+	# _tmp262 = _tmp260 % _tmp261
+	  li $v1, 1757988013	# $t4 / 10007 by multiplying by its reciprocal
+	  mult $t4, $v1
+	  mfhi $v1
+	  sra $v1, $v1, 12
+	  srl $v0, $v1, 31	# round a negative quotient toward zero
+	  addu $v1, $v1, $v0
+	  mul $v1, $v1, $t5
+	  subu $t6, $t4, $v1	# $t4 % 10007
+	# h = _tmp262
+	  sw $t6, -1068($fp)	# spill _tmp262 from $t6 to $fp-1068
+	# _tmp263 = 1
+	  li $t1, 1		# load constant value 1 into $t1
+	# _tmp264 = i + _tmp263
+	  add $t7, $t3, $t1	
+	# i = _tmp264
+	  sw $t7, -1076($fp)	# spill _tmp264 from $t7 to $fp-1076
+	# Goto main._L18
+	# (save modified registers before flow of control change)
+	  sw $t0, -1052($fp)	# spill _tmp258 from $t0 to $fp-1052
+	  sw $t1, -1072($fp)	# spill _tmp263 from $t1 to $fp-1072
+	  sw $t2, -1056($fp)	# spill _tmp259 from $t2 to $fp-1056
+	  sw $t4, -1060($fp)	# spill _tmp260 from $t4 to $fp-1060
+	  sw $t5, -1064($fp)	# spill _tmp261 from $t5 to $fp-1064
+	  sw $t6, -16($fp)	# spill h from $t6 to $fp-16
+	  sw $t7, -12($fp)	# spill i from $t7 to $fp-12
+	  b main._L18		# unconditional branch
+  main._L19:
+	# PushParam h
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  lw $t0, -16($fp)	# load h from $fp-16 into $t0
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintInt
+	  jal _PrintInt      	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp265 = " "
+	  .data			# create string constant marked with label
+	  main._string17: .asciiz " "
+	  .text
+	  la $t0, main._string17	# load label
+	# PushParam _tmp265
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -1080($fp)	# spill _tmp265 from $t0 to $fp-1080
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp266 = 2147483647
+	  li $t0, 2147483647		# load constant value 2147483647 into $t0
+	# _tmp267 = 0
+	  li $t1, 0		# load constant value 0 into $t1
+	# _tmp268 = _tmp267 - _tmp266
+	  sub $t2, $t1, $t0	
+	# _tmp269 = 3
+	  li $t3, 3		# load constant value 3 into $t3
+	# _tmp270 = _tmp268 / _tmp269
+	  li $v1, 1431655766	# $t2 / 3 by multiplying by its reciprocal
+	  mult $t2, $v1
+	  mfhi $v1
+	  srl $v0, $v1, 31	# round a negative quotient toward zero
+	  addu $t4, $v1, $v0
+	# _tmp271 = 4
+	  li $t5, 4		# load constant value 4 into $t5
+	# _tmp272 = _tmp270 * _tmp271
+	  sll $t6, $t4, 2	# $t4 * 4 by shifting
+	# _tmp273 = 1000
+	  li $t7, 1000		# load constant value 1000 into $t7
+	# _tmp274 = _tmp272 % _tmp273
+	  li $v1, 274877907	# $t6 / 1000 by multiplying by its reciprocal
+	  mult $t6, $v1
+	  mfhi $v1
+	  sra $v1, $v1, 6
+	  srl $v0, $v1, 31	# round a negative quotient toward zero
+	  addu $v1, $v1, $v0
+	  mul $v1, $v1, $t7
+	  subu $s0, $t6, $v1	# $t6 % 1000
+	# PushParam _tmp274
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $s0, 4($sp)	# copy param value to stack
+	# LCall _PrintInt
+	# (save modified registers before flow of control change)
+	  sw $t0, -1084($fp)	# spill _tmp266 from $t0 to $fp-1084
+	  sw $t1, -1088($fp)	# spill _tmp267 from $t1 to $fp-1088
+	  sw $t2, -1092($fp)	# spill _tmp268 from $t2 to $fp-1092
+	  sw $t3, -1096($fp)	# spill _tmp269 from $t3 to $fp-1096
+	  sw $t4, -1100($fp)	# spill _tmp270 from $t4 to $fp-1100
+	  sw $t5, -1104($fp)	# spill _tmp271 from $t5 to $fp-1104
+	  sw $t6, -1108($fp)	# spill _tmp272 from $t6 to $fp-1108
+	  sw $t7, -1112($fp)	# spill _tmp273 from $t7 to $fp-1112
+	  sw $s0, -1116($fp)	# spill _tmp274 from $s0 to $fp-1116
+	  jal _PrintInt      	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp275 = "\n"
+	  .data			# create string constant marked with label
+	  main._string18: .asciiz "\n"
+	  .text
+	  la $t0, main._string18	# load label
+	# PushParam _tmp275
+	  subu $sp, $sp, 4	# decrement sp to make space for param
+	  sw $t0, 4($sp)	# copy param value to stack
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $t0, -1120($fp)	# spill _tmp275 from $t0 to $fp-1120
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# EndFunc
+	# (below handles reaching end of fn body with no explicit return)
+	  move $sp, $fp		# pop callee frame off stack
+	  lw $ra, -4($fp)	# restore saved ra
+	  lw $fp, 0($fp)	# restore saved fp
+	  jr $ra		# return from function
@@ -0,0 +1,1340 @@
+/* standard Decaf preamble */
+#define MEM(a, offset) (*(int *)(unsigned long)((unsigned)(a) + (offset)))
+
+int _Alloc(int size);
+int _ReadLine(void);
+int _ReadInteger(void);
+int _StringEqual(int s1, int s2);
+void _PrintInt(int n);
+void _PrintString(int s);
+void _PrintBool(int b);
+void _Halt(void);
+
+static int d_main();
+
+void _DecafStart(void)
+{
+  d_main();
+}
+
+static char d_____show_0_string10[] = " ";
+static char d_____show_0_string11[] = " ";
+static char d_____show_0_string12[] = " ";
+static char d_____show_0_string13[] = " ";
+static char d_____show_0_string14[] = " ";
+static char d_____show_0_string15[] = " ";
+static char d_____show_0_string16[] = " ";
+static char d_____show_0_string17[] = " ";
+static char d_____show_0_string18[] = " ";
+static char d_____show_0_string19[] = "\n";
+static char d_____show_0_string1[] = ": ";
+static char d_____show_0_string20[] = "  %: ";
+static char d_____show_0_string21[] = " ";
+static char d_____show_0_string22[] = " ";
+static char d_____show_0_string23[] = " ";
+static char d_____show_0_string24[] = " ";
+static char d_____show_0_string25[] = " ";
+static char d_____show_0_string26[] = " ";
+static char d_____show_0_string27[] = " ";
+static char d_____show_0_string28[] = " ";
+static char d_____show_0_string29[] = " ";
+static char d_____show_0_string2[] = " ";
+static char d_____show_0_string30[] = "\n";
+static char d_____show_0_string3[] = " ";
+static char d_____show_0_string4[] = " ";
+static char d_____show_0_string5[] = " ";
+static char d_____show_0_string6[] = " ";
+static char d_____show_0_string7[] = " ";
+static char d_____show_0_string8[] = "\n";
+static char d_____show_0_string9[] = "  /: ";
+
+static int d_____show(int p4)
+{
+  int l8 = 0;
+  int l12 = 0;
+  int l16 = 0;
+  int l20 = 0;
+  int l24 = 0;
+  int l28 = 0;
+  int l32 = 0;
+  int l36 = 0;
+  int l40 = 0;
+  int l44 = 0;
+  int l48 = 0;
+  int l52 = 0;
+  int l56 = 0;
+  int l60 = 0;
+  int l64 = 0;
+  int l68 = 0;
+  int l72 = 0;
+  int l76 = 0;
+  int l80 = 0;
+  int l84 = 0;
+  int l88 = 0;
+  int l92 = 0;
+  int l96 = 0;
+  int l100 = 0;
+  int l104 = 0;
+  int l108 = 0;
+  int l112 = 0;
+  int l116 = 0;
+  int l120 = 0;
+  int l124 = 0;
+  int l128 = 0;
+  int l132 = 0;
+  int l136 = 0;
+  int l140 = 0;
+  int l144 = 0;
+  int l148 = 0;
+  int l152 = 0;
+  int l156 = 0;
+  int l160 = 0;
+  int l164 = 0;
+  int l168 = 0;
+  int l172 = 0;
+  int l176 = 0;
+  int l180 = 0;
+  int l184 = 0;
+  int l188 = 0;
+  int l192 = 0;
+  int l196 = 0;
+  int l200 = 0;
+  int l204 = 0;
+  int l208 = 0;
+  int l212 = 0;
+  int l216 = 0;
+  int l220 = 0;
+  int l224 = 0;
+  int l228 = 0;
+  int l232 = 0;
+  int l236 = 0;
+  int l240 = 0;
+  int l244 = 0;
+  int l248 = 0;
+  int l252 = 0;
+  int l256 = 0;
+  int l260 = 0;
+  int l264 = 0;
+  int l268 = 0;
+  int l272 = 0;
+  int l276 = 0;
+  int l280 = 0;
+  int l284 = 0;
+  int l288 = 0;
+  int l292 = 0;
+  int l296 = 0;
+  int l300 = 0;
+  int l304 = 0;
+  int l308 = 0;
+  int l312 = 0;
+  int l316 = 0;
+  int l320 = 0;
+  int l324 = 0;
+  int l328 = 0;
+  int l332 = 0;
+  int l336 = 0;
+  int l340 = 0;
+  /* BeginFunc 336 */
+  /* PushParam x */
+  /* LCall _PrintInt */
+  _PrintInt(p4);
+  /* PopParams 4 */
+  /* _tmp0 = ": " */
+  l8 = (int)(unsigned long)d_____show_0_string1;
+  /* PushParam _tmp0 */
+  /* LCall _PrintString */
+  _PrintString(l8);
+  /* PopParams 4 */
+  /* _tmp1 = 2 */
+  l12 = 2;
+  /* _tmp2 = x * _tmp1 */
+  l16 = (int)((unsigned)p4 * (unsigned)l12);
+  /* PushParam _tmp2 */
+  /* LCall _PrintInt */
+  _PrintInt(l16);
+  /* PopParams 4 */
+  /* _tmp3 = " " */
+  l20 = (int)(unsigned long)d_____show_0_string2;
+  /* PushParam _tmp3 */
+  /* LCall _PrintString */
+  _PrintString(l20);
+  /* PopParams 4 */
+  /* _tmp6 = -8 */
+  l24 = -8;
+  /* _tmp7 = x * _tmp6 */
+  l28 = (int)((unsigned)p4 * (unsigned)l24);
+  /* PushParam _tmp7 */
+  /* LCall _PrintInt */
+  _PrintInt(l28);
+  /* PopParams 4 */
+  /* _tmp8 = " " */
+  l32 = (int)(unsigned long)d_____show_0_string3;
+  /* PushParam _tmp8 */
+  /* LCall _PrintString */
+  _PrintString(l32);
+  /* PopParams 4 */
+  /* _tmp9 = 10 */
+  l36 = 10;
+  /* _tmp10 = x * _tmp9 */
+  l40 = (int)((unsigned)p4 * (unsigned)l36);
+  /* PushParam _tmp10 */
+  /* LCall _PrintInt */
+  _PrintInt(l40);
+  /* PopParams 4 */
+  /* _tmp11 = " " */
+  l44 = (int)(unsigned long)d_____show_0_string4;
+  /* PushParam _tmp11 */
+  /* LCall _PrintString */
+  _PrintString(l44);
+  /* PopParams 4 */
+  /* _tmp12 = 7 */
+  l48 = 7;
+  /* _tmp13 = x * _tmp12 */
+  l52 = (int)((unsigned)p4 * (unsigned)l48);
+  /* PushParam _tmp13 */
+  /* LCall _PrintInt */
+  _PrintInt(l52);
+  /* PopParams 4 */
+  /* _tmp14 = " " */
+  l56 = (int)(unsigned long)d_____show_0_string5;
+  /* PushParam _tmp14 */
+  /* LCall _PrintString */
+  _PrintString(l56);
+  /* PopParams 4 */
+  /* _tmp17 = -31 */
+  l60 = -31;
+  /* _tmp18 = x * _tmp17 */
+  l64 = (int)((unsigned)p4 * (unsigned)l60);
+  /* PushParam _tmp18 */
+  /* LCall _PrintInt */
+  _PrintInt(l64);
+  /* PopParams 4 */
+  /* _tmp19 = " " */
+  l68 = (int)(unsigned long)d_____show_0_string6;
+  /* PushParam _tmp19 */
+  /* LCall _PrintString */
+  _PrintString(l68);
+  /* PopParams 4 */
+  /* _tmp20 = 0 */
+  l72 = 0;
+  /* _tmp21 = x * _tmp20 */
+  l76 = (int)((unsigned)p4 * (unsigned)l72);
+  /* PushParam _tmp21 */
+  /* LCall _PrintInt */
+  _PrintInt(l76);
+  /* PopParams 4 */
+  /* _tmp22 = " " */
+  l80 = (int)(unsigned long)d_____show_0_string7;
+  /* PushParam _tmp22 */
+  /* LCall _PrintString */
+  _PrintString(l80);
+  /* PopParams 4 */
+  /* _tmp25 = -1 */
+  l84 = -1;
+  /* _tmp26 = x * _tmp25 */
+  l88 = (int)((unsigned)p4 * (unsigned)l84);
+  /* PushParam _tmp26 */
+  /* LCall _PrintInt */
+  _PrintInt(l88);
+  /* PopParams 4 */
+  /* _tmp27 = "\n" */
+  l92 = (int)(unsigned long)d_____show_0_string8;
+  /* PushParam _tmp27 */
+  /* LCall _PrintString */
+  _PrintString(l92);
+  /* PopParams 4 */
+  /* _tmp28 = "  /: " */
+  l96 = (int)(unsigned long)d_____show_0_string9;
+  /* PushParam _tmp28 */
+  /* LCall _PrintString */
+  _PrintString(l96);
+  /* PopParams 4 */
+  /* _tmp29 = 2 */
+  l100 = 2;
+  /* _tmp30 = x / _tmp29 */
+  l104 = p4 / l100;
+  /* PushParam _tmp30 */
+  /* LCall _PrintInt */
+  _PrintInt(l104);
+  /* PopParams 4 */
+  /* _tmp31 = " " */
+  l108 = (int)(unsigned long)d_____show_0_string10;
+  /* PushParam _tmp31 */
+  /* LCall _PrintString */
+  _PrintString(l108);
+  /* PopParams 4 */
+  /* _tmp32 = 4 */
+  l112 = 4;
+  /* _tmp33 = x / _tmp32 */
+  l116 = p4 / l112;
+  /* PushParam _tmp33 */
+  /* LCall _PrintInt */
+  _PrintInt(l116);
+  /* PopParams 4 */
+  /* _tmp34 = " " */
+  l120 = (int)(unsigned long)d_____show_0_string11;
+  /* PushParam _tmp34 */
+  /* LCall _PrintString */
+  _PrintString(l120);
+  /* PopParams 4 */
+  /* _tmp37 = -8 */
+  l124 = -8;
+  /* _tmp38 = x / _tmp37 */
+  l128 = p4 / l124;
+  /* PushParam _tmp38 */
+  /* LCall _PrintInt */
+  _PrintInt(l128);
+  /* PopParams 4 */
+  /* _tmp39 = " " */
+  l132 = (int)(unsigned long)d_____show_0_string12;
+  /* PushParam _tmp39 */
+  /* LCall _PrintString */
+  _PrintString(l132);
+  /* PopParams 4 */
+  /* _tmp40 = 3 */
+  l136 = 3;
+  /* _tmp41 = x / _tmp40 */
+  l140 = p4 / l136;
+  /* PushParam _tmp41 */
+  /* LCall _PrintInt */
+  _PrintInt(l140);
+  /* PopParams 4 */
+  /* _tmp42 = " " */
+  l144 = (int)(unsigned long)d_____show_0_string13;
+  /* PushParam _tmp42 */
+  /* LCall _PrintString */
+  _PrintString(l144);
+  /* PopParams 4 */
+  /* _tmp43 = 10 */
+  l148 = 10;
+  /* _tmp44 = x / _tmp43 */
+  l152 = p4 / l148;
+  /* PushParam _tmp44 */
+  /* LCall _PrintInt */
+  _PrintInt(l152);
+  /* PopParams 4 */
+  /* _tmp45 = " " */
+  l156 = (int)(unsigned long)d_____show_0_string14;
+  /* PushParam _tmp45 */
+  /* LCall _PrintString */
+  _PrintString(l156);
+  /* PopParams 4 */
+  /* _tmp46 = 7 */
+  l160 = 7;
+  /* _tmp47 = x / _tmp46 */
+  l164 = p4 / l160;
+  /* PushParam _tmp47 */
+  /* LCall _PrintInt */
+  _PrintInt(l164);
+  /* PopParams 4 */
+  /* _tmp48 = " " */
+  l168 = (int)(unsigned long)d_____show_0_string15;
+  /* PushParam _tmp48 */
+  /* LCall _PrintString */
+  _PrintString(l168);
+  /* PopParams 4 */
+  /* _tmp51 = -7 */
+  l172 = -7;
+  /* _tmp52 = x / _tmp51 */
+  l176 = p4 / l172;
+  /* PushParam _tmp52 */
+  /* LCall _PrintInt */
+  _PrintInt(l176);
+  /* PopParams 4 */
+  /* _tmp53 = " " */
+  l180 = (int)(unsigned long)d_____show_0_string16;
+  /* PushParam _tmp53 */
+  /* LCall _PrintString */
+  _PrintString(l180);
+  /* PopParams 4 */
+  /* _tmp54 = 31 */
+  l184 = 31;
+  /* _tmp55 = x / _tmp54 */
+  l188 = p4 / l184;
+  /* PushParam _tmp55 */
+  /* LCall _PrintInt */
+  _PrintInt(l188);
+  /* PopParams 4 */
+  /* _tmp56 = " " */
+  l192 = (int)(unsigned long)d_____show_0_string17;
+  /* PushParam _tmp56 */
+  /* LCall _PrintString */
+  _PrintString(l192);
+  /* PopParams 4 */
+  /* _tmp57 = 10007 */
+  l196 = 10007;
+  /* _tmp58 = x / _tmp57 */
+  l200 = p4 / l196;
+  /* PushParam _tmp58 */
+  /* LCall _PrintInt */
+  _PrintInt(l200);
+  /* PopParams 4 */
+  /* _tmp59 = " " */
+  l204 = (int)(unsigned long)d_____show_0_string18;
+  /* PushParam _tmp59 */
+  /* LCall _PrintString */
+  _PrintString(l204);
+  /* PopParams 4 */
+  /* _tmp62 = -1 */
+  l208 = -1;
+  /* _tmp63 = x / _tmp62 */
+  l212 = p4 / l208;
+  /* PushParam _tmp63 */
+  /* LCall _PrintInt */
+  _PrintInt(l212);
+  /* PopParams 4 */
+  /* _tmp64 = "\n" */
+  l216 = (int)(unsigned long)d_____show_0_string19;
+  /* PushParam _tmp64 */
+  /* LCall _PrintString */
+  _PrintString(l216);
+  /* PopParams 4 */
+  /* _tmp65 = "  %: " */
+  l220 = (int)(unsigned long)d_____show_0_string20;
+  /* PushParam _tmp65 */
+  /* LCall _PrintString */
+  _PrintString(l220);
+  /* PopParams 4 */
+  /* _tmp66 = 2 */
+  l224 = 2;
+  /* _tmp67 = x % _tmp66 */
+  l228 = p4 % l224;
+  /* PushParam _tmp67 */
+  /* LCall _PrintInt */
+  _PrintInt(l228);
+  /* PopParams 4 */
+  /* _tmp68 = " " */
+  l232 = (int)(unsigned long)d_____show_0_string21;
+  /* PushParam _tmp68 */
+  /* LCall _PrintString */
+  _PrintString(l232);
+  /* PopParams 4 */
+  /* _tmp69 = 4 */
+  l236 = 4;
+  /* _tmp70 = x % _tmp69 */
+  l240 = p4 % l236;
+  /* PushParam _tmp70 */
+  /* LCall _PrintInt */
+  _PrintInt(l240);
+  /* PopParams 4 */
+  /* _tmp71 = " " */
+  l244 = (int)(unsigned long)d_____show_0_string22;
+  /* PushParam _tmp71 */
+  /* LCall _PrintString */
+  _PrintString(l244);
+  /* PopParams 4 */
+  /* _tmp74 = -8 */
+  l248 = -8;
+  /* _tmp75 = x % _tmp74 */
+  l252 = p4 % l248;
+  /* PushParam _tmp75 */
+  /* LCall _PrintInt */
+  _PrintInt(l252);
+  /* PopParams 4 */
+  /* _tmp76 = " " */
+  l256 = (int)(unsigned long)d_____show_0_string23;
+  /* PushParam _tmp76 */
+  /* LCall _PrintString */
+  _PrintString(l256);
+  /* PopParams 4 */
+  /* _tmp77 = 3 */
+  l260 = 3;
+  /* _tmp78 = x % _tmp77 */
+  l264 = p4 % l260;
+  /* PushParam _tmp78 */
+  /* LCall _PrintInt */
+  _PrintInt(l264);
+  /* PopParams 4 */
+  /* _tmp79 = " " */
+  l268 = (int)(unsigned long)d_____show_0_string24;
+  /* PushParam _tmp79 */
+  /* LCall _PrintString */
+  _PrintString(l268);
+  /* PopParams 4 */
+  /* _tmp80 = 10 */
+  l272 = 10;
+  /* _tmp81 = x % _tmp80 */
+  l276 = p4 % l272;
+  /* PushParam _tmp81 */
+  /* LCall _PrintInt */
+  _PrintInt(l276);
+  /* PopParams 4 */
+  /* _tmp82 = " " */
+  l280 = (int)(unsigned long)d_____show_0_string25;
+  /* PushParam _tmp82 */
+  /* LCall _PrintString */
+  _PrintString(l280);
+  /* PopParams 4 */
+  /* _tmp83 = 7 */
+  l284 = 7;
+  /* _tmp84 = x % _tmp83 */
+  l288 = p4 % l284;
+  /* PushParam _tmp84 */
+  /* LCall _PrintInt */
+  _PrintInt(l288);
+  /* PopParams 4 */
+  /* _tmp85 = " " */
+  l292 = (int)(unsigned long)d_____show_0_string26;
+  /* PushParam _tmp85 */
+  /* LCall _PrintString */
+  _PrintString(l292);
+  /* PopParams 4 */
+  /* _tmp88 = -7 */
+  l296 = -7;
+  /* _tmp89 = x % _tmp88 */
+  l300 = p4 % l296;
+  /* PushParam _tmp89 */
+  /* LCall _PrintInt */
+  _PrintInt(l300);
+  /* PopParams 4 */
+  /* _tmp90 = " " */
+  l304 = (int)(unsigned long)d_____show_0_string27;
+  /* PushParam _tmp90 */
+  /* LCall _PrintString */
+  _PrintString(l304);
+  /* PopParams 4 */
+  /* _tmp91 = 31 */
+  l308 = 31;
+  /* _tmp92 = x % _tmp91 */
+  l312 = p4 % l308;
+  /* PushParam _tmp92 */
+  /* LCall _PrintInt */
+  _PrintInt(l312);
+  /* PopParams 4 */
+  /* _tmp93 = " " */
+  l316 = (int)(unsigned long)d_____show_0_string28;
+  /* PushParam _tmp93 */
+  /* LCall _PrintString */
+  _PrintString(l316);
+  /* PopParams 4 */
+  /* _tmp94 = 10007 */
+  l320 = 10007;
+  /* _tmp95 = x % _tmp94 */
+  l324 = p4 % l320;
+  /* PushParam _tmp95 */
+  /* LCall _PrintInt */
+  _PrintInt(l324);
+  /* PopParams 4 */
+  /* _tmp96 = " " */
+  l328 = (int)(unsigned long)d_____show_0_string29;
+  /* PushParam _tmp96 */
+  /* LCall _PrintString */
+  _PrintString(l328);
+  /* PopParams 4 */
+  /* _tmp97 = 1 */
+  l332 = 1;
+  /* _tmp98 = x % _tmp97 */
+  l336 = p4 % l332;
+  /* PushParam _tmp98 */
+  /* LCall _PrintInt */
+  _PrintInt(l336);
+  /* PopParams 4 */
+  /* _tmp99 = "\n" */
+  l340 = (int)(unsigned long)d_____show_0_string30;
+  /* PushParam _tmp99 */
+  /* LCall _PrintString */
+  _PrintString(l340);
+  /* PopParams 4 */
+  /* EndFunc */
+  return 0;
+}
+
+static char d_main_0_string10[] = "Decaf runtime error: Array subscript out of bounds\n";
+static char d_main_0_string11[] = "Decaf runtime error: Array subscript out of bounds\n";
+static char d_main_0_string12[] = "Decaf runtime error: Array subscript out of bounds\n";
+static char d_main_0_string13[] = "Decaf runtime error: Array subscript out of bounds\n";
+static char d_main_0_string14[] = "Decaf runtime error: Array subscript out of bounds\n";
+static char d_main_0_string15[] = "Decaf runtime error: Array subscript out of bounds\n";
+static char d_main_0_string16[] = "Decaf runtime error: Array subscript out of bounds\n";
+static char d_main_0_string17[] = " ";
+static char d_main_0_string18[] = "\n";
+static char d_main_0_string2[] = "Decaf runtime error: Array subscript out of bounds\n";
+static char d_main_0_string3[] = "Decaf runtime error: Array subscript out of bounds\n";
+static char d_main_0_string4[] = "Decaf runtime error: Array subscript out of bounds\n";
+static char d_main_0_string5[] = "Decaf runtime error: Array subscript out of bounds\n";
+static char d_main_0_string6[] = "Decaf runtime error: Array subscript out of bounds\n";
+static char d_main_0_string7[] = "Decaf runtime error: Array subscript out of bounds\n";
+static char d_main_0_string8[] = "Decaf runtime error: Array subscript out of bounds\n";
+static char d_main_0_string9[] = "Decaf runtime error: Array subscript out of bounds\n";
+static int d_____show();
+
+static int d_main(void)
+{
+  int l8 = 0;
+  int l12 = 0;
+  int l16 = 0;
+  int l20 = 0;
+  int l24 = 0;
+  int l28 = 0;
+  int l32 = 0;
+  int l36 = 0;
+  int l40 = 0;
+  int l44 = 0;
+  int l48 = 0;
+  int l52 = 0;
+  int l56 = 0;
+  int l60 = 0;
+  int l64 = 0;
+  int l68 = 0;
+  int l72 = 0;
+  int l76 = 0;
+  int l80 = 0;
+  int l84 = 0;
+  int l88 = 0;
+  int l92 = 0;
+  int l96 = 0;
+  int l100 = 0;
+  int l104 = 0;
+  int l108 = 0;
+  int l112 = 0;
+  int l116 = 0;
+  int l120 = 0;
+  int l124 = 0;
+  int l128 = 0;
+  int l132 = 0;
+  int l136 = 0;
+  int l140 = 0;
+  int l144 = 0;
+  int l148 = 0;
+  int l152 = 0;
+  int l156 = 0;
+  int l160 = 0;
+  int l164 = 0;
+  int l168 = 0;
+  int l172 = 0;
+  int l176 = 0;
+  int l180 = 0;
+  int l184 = 0;
+  int l188 = 0;
+  int l192 = 0;
+  int l196 = 0;
+  int l200 = 0;
+  int l204 = 0;
+  int l208 = 0;
+  int l212 = 0;
+  int l216 = 0;
+  int l220 = 0;
+  int l224 = 0;
+  int l228 = 0;
+  int l232 = 0;
+  int l236 = 0;
+  int l240 = 0;
+  int l244 = 0;
+  int l248 = 0;
+  int l252 = 0;
+  int l256 = 0;
+  int l260 = 0;
+  int l264 = 0;
+  int l268 = 0;
+  int l272 = 0;
+  int l276 = 0;
+  int l280 = 0;
+  int l284 = 0;
+  int l288 = 0;
+  int l292 = 0;
+  int l296 = 0;
+  int l300 = 0;
+  int l304 = 0;
+  int l308 = 0;
+  int l312 = 0;
+  int l316 = 0;
+  int l320 = 0;
+  int l324 = 0;
+  int l328 = 0;
+  int l332 = 0;
+  int l336 = 0;
+  int l340 = 0;
+  int l344 = 0;
+  int l348 = 0;
+  int l352 = 0;
+  int l356 = 0;
+  int l360 = 0;
+  int l364 = 0;
+  int l368 = 0;
+  int l372 = 0;
+  int l376 = 0;
+  int l380 = 0;
+  int l384 = 0;
+  int l388 = 0;
+  int l392 = 0;
+  int l396 = 0;
+  int l400 = 0;
+  int l404 = 0;
+  int l408 = 0;
+  int l412 = 0;
+  int l416 = 0;
+  int l420 = 0;
+  int l424 = 0;
+  int l428 = 0;
+  int l432 = 0;
+  int l436 = 0;
+  int l440 = 0;
+  int l444 = 0;
+  int l448 = 0;
+  int l452 = 0;
+  int l456 = 0;
+  int l460 = 0;
+  int l464 = 0;
+  int l468 = 0;
+  int l472 = 0;
+  int l476 = 0;
+  int l480 = 0;
+  int l484 = 0;
+  int l488 = 0;
+  int l492 = 0;
+  int l496 = 0;
+  int l500 = 0;
+  int l504 = 0;
+  int l508 = 0;
+  int l512 = 0;
+  int l516 = 0;
+  int l520 = 0;
+  int l524 = 0;
+  int l528 = 0;
+  int l532 = 0;
+  int l536 = 0;
+  int l540 = 0;
+  int l544 = 0;
+  int l548 = 0;
+  int l552 = 0;
+  int l556 = 0;
+  int l560 = 0;
+  int l564 = 0;
+  int l568 = 0;
+  int l572 = 0;
+  int l576 = 0;
+  int l580 = 0;
+  int l584 = 0;
+  int l588 = 0;
+  int l592 = 0;
+  int l596 = 0;
+  int l600 = 0;
+  int l604 = 0;
+  int l608 = 0;
+  int l612 = 0;
+  int l616 = 0;
+  int l620 = 0;
+  int l624 = 0;
+  int l628 = 0;
+  int l632 = 0;
+  int l636 = 0;
+  int l640 = 0;
+  int l644 = 0;
+  int l648 = 0;
+  int l652 = 0;
+  int l656 = 0;
+  int l660 = 0;
+  int l664 = 0;
+  int l668 = 0;
+  int l672 = 0;
+  int l676 = 0;
+  int l680 = 0;
+  int l684 = 0;
+  int l688 = 0;
+  int l692 = 0;
+  int l696 = 0;
+  int l700 = 0;
+  int l704 = 0;
+  int l708 = 0;
+  int l712 = 0;
+  int l716 = 0;
+  int l720 = 0;
+  int l724 = 0;
+  int l728 = 0;
+  int l732 = 0;
+  int l736 = 0;
+  int l740 = 0;
+  int l744 = 0;
+  int l748 = 0;
+  int l752 = 0;
+  int l756 = 0;
+  /* BeginFunc 752 */
+  /* _tmp0 = 14 */
+  l20 = 14;
+  /* _tmp8 = 60 */
+  l24 = 60;
+  /* PushParam _tmp8 */
+  /* _tmp9 = LCall _Alloc */
+  l28 = _Alloc(l24);
+  /* PopParams 4 */
+  /* *(_tmp9) = _tmp0 */
+  MEM(l28, 0) = l20;
+  /* xs = _tmp9 */
+  l8 = l28;
+  /* _tmp10 = 0 */
+  l32 = 0;
+  /* _tmp11 = 0 */
+  l36 = 0;
+  /* _tmp13 = *(_tmp9) */
+  l40 = MEM(l28, 0);
+  /* _tmp14 = 0 */
+  l44 = 0;
+  /* _tmp15 = _tmp13 < _tmp11 */
+  l48 = l40 < l36;
+  /* _tmp16 = _tmp13 == _tmp11 */
+  l52 = l40 == l36;
+  /* _tmp17 = _tmp15 || _tmp16 */
+  l56 = l48 | l52;
+  /* _tmp18 = _tmp17 || _tmp14 */
+  l60 = l56 | l44;
+  /* IfZ _tmp18 Goto main._L1 */
+  if (l60 == 0) goto d_main_0_L1;
+  /* _tmp19 = "Decaf runtime error: Array subscript out of bound..." */
+  l64 = (int)(unsigned long)d_main_0_string2;
+  /* PushParam _tmp19 */
+  /* LCall _PrintString */
+  _PrintString(l64);
+  /* PopParams 4 */
+  /* LCall _Halt */
+  _Halt();
+  d_main_0_L1: ;
+  /* _tmp22 = 4 */
+  l68 = 4;
+  /* _tmp23 = xs + _tmp22 */
+  l72 = (int)((unsigned)l8 + (unsigned)l68);
+  /* *(_tmp23) = _tmp10 */
+  MEM(l72, 0) = l32;
+  /* _tmp25 = 1 */
+  l76 = 1;
+  /* _tmp26 = 1 */
+  l80 = 1;
+  /* _tmp28 = *(xs) */
+  l84 = MEM(l8, 0);
+  /* _tmp29 = 0 */
+  l88 = 0;
+  /* _tmp30 = _tmp28 < _tmp26 */
+  l92 = l84 < l80;
+  /* _tmp31 = _tmp28 == _tmp26 */
+  l96 = l84 == l80;
+  /* _tmp32 = _tmp30 || _tmp31 */
+  l100 = l92 | l96;
+  /* _tmp33 = _tmp32 || _tmp29 */
+  l104 = l100 | l88;
+  /* IfZ _tmp33 Goto main._L2 */
+  if (l104 == 0) goto d_main_0_L2;
+  /* _tmp34 = "Decaf runtime error: Array subscript out of bound..." */
+  l108 = (int)(unsigned long)d_main_0_string3;
+  /* PushParam _tmp34 */
+  /* LCall _PrintString */
+  _PrintString(l108);
+  /* PopParams 4 */
+  /* LCall _Halt */
+  _Halt();
+  d_main_0_L2: ;
+  /* _tmp37 = 8 */
+  l112 = 8;
+  /* _tmp38 = xs + _tmp37 */
+  l116 = (int)((unsigned)l8 + (unsigned)l112);
+  /* *(_tmp38) = _tmp25 */
+  MEM(l116, 0) = l76;
+  /* _tmp42 = -1 */
+  l120 = -1;
+  /* _tmp43 = 2 */
+  l124 = 2;
+  /* _tmp45 = *(xs) */
+  l128 = MEM(l8, 0);
+  /* _tmp46 = 0 */
+  l132 = 0;
+  /* _tmp47 = _tmp45 < _tmp43 */
+  l136 = l128 < l124;
+  /* _tmp48 = _tmp45 == _tmp43 */
+  l140 = l128 == l124;
+  /* _tmp49 = _tmp47 || _tmp48 */
+  l144 = l136 | l140;
+  /* _tmp50 = _tmp49 || _tmp46 */
+  l148 = l144 | l132;
+  /* IfZ _tmp50 Goto main._L3 */
+  if (l148 == 0) goto d_main_0_L3;
+  /* _tmp51 = "Decaf runtime error: Array subscript out of bound..." */
+  l152 = (int)(unsigned long)d_main_0_string4;
+  /* PushParam _tmp51 */
+  /* LCall _PrintString */
+  _PrintString(l152);
+  /* PopParams 4 */
+  /* LCall _Halt */
+  _Halt();
+  d_main_0_L3: ;
+  /* _tmp54 = 12 */
+  l156 = 12;
+  /* _tmp55 = xs + _tmp54 */
+  l160 = (int)((unsigned)l8 + (unsigned)l156);
+  /* *(_tmp55) = _tmp42 */
+  MEM(l160, 0) = l120;
+  /* _tmp57 = 7 */
+  l164 = 7;
+  /* _tmp58 = 3 */
+  l168 = 3;
+  /* _tmp60 = *(xs) */
+  l172 = MEM(l8, 0);
+  /* _tmp61 = 0 */
+  l176 = 0;
+  /* _tmp62 = _tmp60 < _tmp58 */
+  l180 = l172 < l168;
+  /* _tmp63 = _tmp60 == _tmp58 */
+  l184 = l172 == l168;
+  /* _tmp64 = _tmp62 || _tmp63 */
+  l188 = l180 | l184;
+  /* _tmp65 = _tmp64 || _tmp61 */
+  l192 = l188 | l176;
+  /* IfZ _tmp65 Goto main._L4 */
+  if (l192 == 0) goto d_main_0_L4;
+  /* _tmp66 = "Decaf runtime error: Array subscript out of bound..." */
+  l196 = (int)(unsigned long)d_main_0_string5;
+  /* PushParam _tmp66 */
+  /* LCall _PrintString */
+  _PrintString(l196);
+  /* PopParams 4 */
+  /* LCall _Halt */
+  _Halt();
+  d_main_0_L4: ;
+  /* _tmp69 = 16 */
+  l200 = 16;
+  /* _tmp70 = xs + _tmp69 */
+  l204 = (int)((unsigned)l8 + (unsigned)l200);
+  /* *(_tmp70) = _tmp57 */
+  MEM(l204, 0) = l164;
+  /* _tmp74 = -7 */
+  l208 = -7;
+  /* _tmp75 = 4 */
+  l212 = 4;
+  /* _tmp77 = *(xs) */
+  l216 = MEM(l8, 0);
+  /* _tmp78 = 0 */
+  l220 = 0;
+  /* _tmp79 = _tmp77 < _tmp75 */
+  l224 = l216 < l212;
+  /* _tmp80 = _tmp77 == _tmp75 */
+  l228 = l216 == l212;
+  /* _tmp81 = _tmp79 || _tmp80 */
+  l232 = l224 | l228;
+  /* _tmp82 = _tmp81 || _tmp78 */
+  l236 = l232 | l220;
+  /* IfZ _tmp82 Goto main._L5 */
+  if (l236 == 0) goto d_main_0_L5;
+  /* _tmp83 = "Decaf runtime error: Array subscript out of bound..." */
+  l240 = (int)(unsigned long)d_main_0_string6;
+  /* PushParam _tmp83 */
+  /* LCall _PrintString */
+  _PrintString(l240);
+  /* PopParams 4 */
+  /* LCall _Halt */
+  _Halt();
+  d_main_0_L5: ;
+  /* _tmp86 = 20 */
+  l244 = 20;
+  /* _tmp87 = xs + _tmp86 */
+  l248 = (int)((unsigned)l8 + (unsigned)l244);
+  /* *(_tmp87) = _tmp74 */
+  MEM(l248, 0) = l208;
+  /* _tmp89 = 100 */
+  l252 = 100;
+  /* _tmp90 = 5 */
+  l256 = 5;
+  /* _tmp92 = *(xs) */
+  l260 = MEM(l8, 0);
+  /* _tmp93 = 0 */
+  l264 = 0;
+  /* _tmp94 = _tmp92 < _tmp90 */
+  l268 = l260 < l256;
+  /* _tmp95 = _tmp92 == _tmp90 */
+  l272 = l260 == l256;
+  /* _tmp96 = _tmp94 || _tmp95 */
+  l276 = l268 | l272;
+  /* _tmp97 = _tmp96 || _tmp93 */
+  l280 = l276 | l264;
+  /* IfZ _tmp97 Goto main._L6 */
+  if (l280 == 0) goto d_main_0_L6;
+  /* _tmp98 = "Decaf runtime error: Array subscript out of bound..." */
+  l284 = (int)(unsigned long)d_main_0_string7;
+  /* PushParam _tmp98 */
+  /* LCall _PrintString */
+  _PrintString(l284);
+  /* PopParams 4 */
+  /* LCall _Halt */
+  _Halt();
+  d_main_0_L6: ;
+  /* _tmp101 = 24 */
+  l288 = 24;
+  /* _tmp102 = xs + _tmp101 */
+  l292 = (int)((unsigned)l8 + (unsigned)l288);
+  /* *(_tmp102) = _tmp89 */
+  MEM(l292, 0) = l252;
+  /* _tmp106 = -100 */
+  l296 = -100;
+  /* _tmp107 = 6 */
+  l300 = 6;
+  /* _tmp109 = *(xs) */
+  l304 = MEM(l8, 0);
+  /* _tmp110 = 0 */
+  l308 = 0;
+  /* _tmp111 = _tmp109 < _tmp107 */
+  l312 = l304 < l300;
+  /* _tmp112 = _tmp109 == _tmp107 */
+  l316 = l304 == l300;
+  /* _tmp113 = _tmp111 || _tmp112 */
+  l320 = l312 | l316;
+  /* _tmp114 = _tmp113 || _tmp110 */
+  l324 = l320 | l308;
+  /* IfZ _tmp114 Goto main._L7 */
+  if (l324 == 0) goto d_main_0_L7;
+  /* _tmp115 = "Decaf runtime error: Array subscript out of bound..." */
+  l328 = (int)(unsigned long)d_main_0_string8;
+  /* PushParam _tmp115 */
+  /* LCall _PrintString */
+  _PrintString(l328);
+  /* PopParams 4 */
+  /* LCall _Halt */
+  _Halt();
+  d_main_0_L7: ;
+  /* _tmp118 = 28 */
+  l332 = 28;
+  /* _tmp119 = xs + _tmp118 */
+  l336 = (int)((unsigned)l8 + (unsigned)l332);
+  /* *(_tmp119) = _tmp106 */
+  MEM(l336, 0) = l296;
+  /* _tmp121 = 10007 */
+  l340 = 10007;
+  /* _tmp122 = 7 */
+  l344 = 7;
+  /* _tmp124 = *(xs) */
+  l348 = MEM(l8, 0);
+  /* _tmp125 = 0 */
+  l352 = 0;
+  /* _tmp126 = _tmp124 < _tmp122 */
+  l356 = l348 < l344;
+  /* _tmp127 = _tmp124 == _tmp122 */
+  l360 = l348 == l344;
+  /* _tmp128 = _tmp126 || _tmp127 */
+  l364 = l356 | l360;
+  /* _tmp129 = _tmp128 || _tmp125 */
+  l368 = l364 | l352;
+  /* IfZ _tmp129 Goto main._L8 */
+  if (l368 == 0) goto d_main_0_L8;
+  /* _tmp130 = "Decaf runtime error: Array subscript out of bound..." */
+  l372 = (int)(unsigned long)d_main_0_string9;
+  /* PushParam _tmp130 */
+  /* LCall _PrintString */
+  _PrintString(l372);
+  /* PopParams 4 */
+  /* LCall _Halt */
+  _Halt();
+  d_main_0_L8: ;
+  /* _tmp133 = 32 */
+  l376 = 32;
+  /* _tmp134 = xs + _tmp133 */
+  l380 = (int)((unsigned)l8 + (unsigned)l376);
+  /* *(_tmp134) = _tmp121 */
+  MEM(l380, 0) = l340;
+  /* _tmp138 = -20015 */
+  l384 = -20015;
+  /* _tmp139 = 8 */
+  l388 = 8;
+  /* _tmp141 = *(xs) */
+  l392 = MEM(l8, 0);
+  /* _tmp142 = 0 */
+  l396 = 0;
+  /* _tmp143 = _tmp141 < _tmp139 */
+  l400 = l392 < l388;
+  /* _tmp144 = _tmp141 == _tmp139 */
+  l404 = l392 == l388;
+  /* _tmp145 = _tmp143 || _tmp144 */
+  l408 = l400 | l404;
+  /* _tmp146 = _tmp145 || _tmp142 */
+  l412 = l408 | l396;
+  /* IfZ _tmp146 Goto main._L9 */
+  if (l412 == 0) goto d_main_0_L9;
+  /* _tmp147 = "Decaf runtime error: Array subscript out of bound..." */
+  l416 = (int)(unsigned long)d_main_0_string10;
+  /* PushParam _tmp147 */
+  /* LCall _PrintString */
+  _PrintString(l416);
+  /* PopParams 4 */
+  /* LCall _Halt */
+  _Halt();
+  d_main_0_L9: ;
+  /* _tmp150 = 36 */
+  l420 = 36;
+  /* _tmp151 = xs + _tmp150 */
+  l424 = (int)((unsigned)l8 + (unsigned)l420);
+  /* *(_tmp151) = _tmp138 */
+  MEM(l424, 0) = l384;
+  /* _tmp153 = 123456789 */
+  l428 = 123456789;
+  /* _tmp154 = 9 */
+  l432 = 9;
+  /* _tmp156 = *(xs) */
+  l436 = MEM(l8, 0);
+  /* _tmp157 = 0 */
+  l440 = 0;
+  /* _tmp158 = _tmp156 < _tmp154 */
+  l444 = l436 < l432;
+  /* _tmp159 = _tmp156 == _tmp154 */
+  l448 = l436 == l432;
+  /* _tmp160 = _tmp158 || _tmp159 */
+  l452 = l444 | l448;
+  /* _tmp161 = _tmp160 || _tmp157 */
+  l456 = l452 | l440;
+  /* IfZ _tmp161 Goto main._L10 */
+  if (l456 == 0) goto d_main_0_L10;
+  /* _tmp162 = "Decaf runtime error: Array subscript out of bound..." */
+  l460 = (int)(unsigned long)d_main_0_string11;
+  /* PushParam _tmp162 */
+  /* LCall _PrintString */
+  _PrintString(l460);
+  /* PopParams 4 */
+  /* LCall _Halt */
+  _Halt();
+  d_main_0_L10: ;
+  /* _tmp165 = 40 */
+  l464 = 40;
+  /* _tmp166 = xs + _tmp165 */
+  l468 = (int)((unsigned)l8 + (unsigned)l464);
+  /* *(_tmp166) = _tmp153 */
+  MEM(l468, 0) = l428;
+  /* _tmp170 = -987654321 */
+  l472 = -987654321;
+  /* _tmp171 = 10 */
+  l476 = 10;
+  /* _tmp173 = *(xs) */
+  l480 = MEM(l8, 0);
+  /* _tmp174 = 0 */
+  l484 = 0;
+  /* _tmp175 = _tmp173 < _tmp171 */
+  l488 = l480 < l476;
+  /* _tmp176 = _tmp173 == _tmp171 */
+  l492 = l480 == l476;
+  /* _tmp177 = _tmp175 || _tmp176 */
+  l496 = l488 | l492;
+  /* _tmp178 = _tmp177 || _tmp174 */
+  l500 = l496 | l484;
+  /* IfZ _tmp178 Goto main._L11 */
+  if (l500 == 0) goto d_main_0_L11;
+  /* _tmp179 = "Decaf runtime error: Array subscript out of bound..." */
+  l504 = (int)(unsigned long)d_main_0_string12;
+  /* PushParam _tmp179 */
+  /* LCall _PrintString */
+  _PrintString(l504);
+  /* PopParams 4 */
+  /* LCall _Halt */
+  _Halt();
+  d_main_0_L11: ;
+  /* _tmp182 = 44 */
+  l508 = 44;
+  /* _tmp183 = xs + _tmp182 */
+  l512 = (int)((unsigned)l8 + (unsigned)l508);
+  /* *(_tmp183) = _tmp170 */
+  MEM(l512, 0) = l472;
+  /* _tmp185 = 2147483647 */
+  l516 = 2147483647;
+  /* _tmp186 = 11 */
+  l520 = 11;
+  /* _tmp188 = *(xs) */
+  l524 = MEM(l8, 0);
+  /* _tmp189 = 0 */
+  l528 = 0;
+  /* _tmp190 = _tmp188 < _tmp186 */
+  l532 = l524 < l520;
+  /* _tmp191 = _tmp188 == _tmp186 */
+  l536 = l524 == l520;
+  /* _tmp192 = _tmp190 || _tmp191 */
+  l540 = l532 | l536;
+  /* _tmp193 = _tmp192 || _tmp189 */
+  l544 = l540 | l528;
+  /* IfZ _tmp193 Goto main._L12 */
+  if (l544 == 0) goto d_main_0_L12;
+  /* _tmp194 = "Decaf runtime error: Array subscript out of bound..." */
+  l548 = (int)(unsigned long)d_main_0_string13;
+  /* PushParam _tmp194 */
+  /* LCall _PrintString */
+  _PrintString(l548);
+  /* PopParams 4 */
+  /* LCall _Halt */
+  _Halt();
+  d_main_0_L12: ;
+  /* _tmp197 = 48 */
+  l552 = 48;
+  /* _tmp198 = xs + _tmp197 */
+  l556 = (int)((unsigned)l8 + (unsigned)l552);
+  /* *(_tmp198) = _tmp185 */
+  MEM(l556, 0) = l516;
+  /* _tmp202 = -2147483647 */
+  l560 = -2147483647;
+  /* _tmp203 = 12 */
+  l564 = 12;
+  /* _tmp205 = *(xs) */
+  l568 = MEM(l8, 0);
+  /* _tmp206 = 0 */
+  l572 = 0;
+  /* _tmp207 = _tmp205 < _tmp203 */
+  l576 = l568 < l564;
+  /* _tmp208 = _tmp205 == _tmp203 */
+  l580 = l568 == l564;
+  /* _tmp209 = _tmp207 || _tmp208 */
+  l584 = l576 | l580;
+  /* _tmp210 = _tmp209 || _tmp206 */
+  l588 = l584 | l572;
+  /* IfZ _tmp210 Goto main._L13 */
+  if (l588 == 0) goto d_main_0_L13;
+  /* _tmp211 = "Decaf runtime error: Array subscript out of bound..." */
+  l592 = (int)(unsigned long)d_main_0_string14;
+  /* PushParam _tmp211 */
+  /* LCall _PrintString */
+  _PrintString(l592);
+  /* PopParams 4 */
+  /* LCall _Halt */
+  _Halt();
+  d_main_0_L13: ;
+  /* _tmp214 = 52 */
+  l596 = 52;
+  /* _tmp215 = xs + _tmp214 */
+  l600 = (int)((unsigned)l8 + (unsigned)l596);
+  /* *(_tmp215) = _tmp202 */
+  MEM(l600, 0) = l560;
+  /* _tmp221 = -2147483648 */
+  l604 = -2147483647 - 1;
+  /* _tmp222 = 13 */
+  l608 = 13;
+  /* _tmp224 = *(xs) */
+  l612 = MEM(l8, 0);
+  /* _tmp225 = 0 */
+  l616 = 0;
+  /* _tmp226 = _tmp224 < _tmp222 */
+  l620 = l612 < l608;
+  /* _tmp227 = _tmp224 == _tmp222 */
+  l624 = l612 == l608;
+  /* _tmp228 = _tmp226 || _tmp227 */
+  l628 = l620 | l624;
+  /* _tmp229 = _tmp228 || _tmp225 */
+  l632 = l628 | l616;
+  /* IfZ _tmp229 Goto main._L14 */
+  if (l632 == 0) goto d_main_0_L14;
+  /* _tmp230 = "Decaf runtime error: Array subscript out of bound..." */
+  l636 = (int)(unsigned long)d_main_0_string15;
+  /* PushParam _tmp230 */
+  /* LCall _PrintString */
+  _PrintString(l636);
+  /* PopParams 4 */
+  /* LCall _Halt */
+  _Halt();
+  d_main_0_L14: ;
+  /* _tmp233 = 56 */
+  l640 = 56;
+  /* _tmp234 = xs + _tmp233 */
+  l644 = (int)((unsigned)l8 + (unsigned)l640);
+  /* *(_tmp234) = _tmp221 */
+  MEM(l644, 0) = l604;
+  /* i = 0 */
+  l12 = 0;
+  /* _tmp277 = 4 */
+  l740 = 4;
+  /* _tmp279 = i * _tmp277 */
+  l748 = (int)((unsigned)l12 * (unsigned)l740);
+  /* _tmp278 = 4 */
+  l744 = 4;
+  /* _tmp280 = _tmp279 + _tmp278 */
+  l752 = (int)((unsigned)l748 + (unsigned)l744);
+  /* _tmp276 = xs + _tmp280 */
+  l736 = (int)((unsigned)l8 + (unsigned)l752);
+  /* _tmp281 = 4 */
+  l756 = 4;
+  d_main_0_L22: ;
+  /* _tmp237 = *(xs) */
+  l648 = MEM(l8, 0);
+  /* _tmp238 = i < _tmp237 */
+  l652 = l12 < l648;
+  /* IfZ _tmp238 Goto main._L16 */
+  if (l652 == 0) goto d_main_0_L16;
+  /* _tmp239 = 0 */
+  l656 = 0;
+  /* _tmp240 = *(xs) */
+  l660 = MEM(l8, 0);
+  /* _tmp241 = i < _tmp239 */
+  l664 = l12 < l656;
+  /* _tmp242 = _tmp240 < i */
+  l668 = l660 < l12;
+  /* _tmp243 = _tmp240 == i */
+  l672 = l660 == l12;
+  /* _tmp244 = _tmp242 || _tmp243 */
+  l676 = l668 | l672;
+  /* _tmp245 = _tmp244 || _tmp241 */
+  l680 = l676 | l664;
+  /* IfZ _tmp245 Goto main._L17 */
+  if (l680 == 0) goto d_main_0_L17;
+  /* _tmp246 = "Decaf runtime error: Array subscript out of bound..." */
+  l684 = (int)(unsigned long)d_main_0_string16;
+  /* PushParam _tmp246 */
+  /* LCall _PrintString */
+  _PrintString(l684);
+  /* PopParams 4 */
+  /* LCall _Halt */
+  _Halt();
+  d_main_0_L17: ;
+  /* _tmp251 = *(_tmp276) */
+  l688 = MEM(l736, 0);
+  /* PushParam _tmp251 */
+  /* LCall ____show */
+  ((int (*)(int))d_____show)(l688);
+  /* PopParams 4 */
+  /* _tmp252 = 1 */
+  l692 = 1;
+  /* i = i + _tmp252 */
+  l12 = (int)((unsigned)l12 + (unsigned)l692);
+  /* _tmp276 = _tmp276 + _tmp281 */
+  l736 = (int)((unsigned)l736 + (unsigned)l756);
+  /* Goto main._L22 */
+  goto d_main_0_L22;
+  d_main_0_L16: ;
+  /* h = 0 */
+  l16 = 0;
+  /* i = 0 */
+  l12 = 0;
+  d_main_0_L20: ;
+  /* _tmp256 = 1000 */
+  l696 = 1000;
+  /* _tmp257 = i < _tmp256 */
+  l700 = l12 < l696;
+  /* IfZ _tmp257 Goto main._L19 */
+  if (l700 == 0) goto d_main_0_L19;
+  /* _tmp258 = 31 */
+  l704 = 31;
+  /* _tmp259 = h * _tmp258 */
+  l708 = (int)((unsigned)l16 * (unsigned)l704);
+  /* _tmp260 = _tmp259 + i */
+  l712 = (int)((unsigned)l708 + (unsigned)l12);
+  /* _tmp261 = 10007 */
+  l716 = 10007;
+  /* h = _tmp260 % _tmp261 */
+  l16 = l712 % l716;
+  /* _tmp263 = 1 */
+  l720 = 1;
+  /* i = i + _tmp263 */
+  l12 = (int)((unsigned)l12 + (unsigned)l720);
+  /* Goto main._L20 */
+  goto d_main_0_L20;
+  d_main_0_L19: ;
+  /* PushParam h */
+  /* LCall _PrintInt */
+  _PrintInt(l16);
+  /* PopParams 4 */
+  /* _tmp265 = " " */
+  l724 = (int)(unsigned long)d_main_0_string17;
+  /* PushParam _tmp265 */
+  /* LCall _PrintString */
+  _PrintString(l724);
+  /* PopParams 4 */
+  /* _tmp274 = 768 */
+  l728 = 768;
+  /* PushParam _tmp274 */
+  /* LCall _PrintInt */
+  _PrintInt(l728);
+  /* PopParams 4 */
+  /* _tmp275 = "\n" */
+  l732 = (int)(unsigned long)d_main_0_string18;
+  /* PushParam _tmp275 */
+  /* LCall _PrintString */
+  _PrintString(l732);
+  /* PopParams 4 */
+  /* EndFunc */
+  return 0;
+}
+
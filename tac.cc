@@ -4,12 +4,18 @@
  */
 
 #include "tac.h"
-#include "mips.h"
+#include "target.h"
 #include <string.h>
+#include <stdlib.h>
+#include <limits.h>
 
 Location::Location(Segment s, int o, const char *name) :
   variableName(strdup(name)), segment(s), offset(o){}
 
+Location::~Location() {
+  free((char *)variableName);
+}
+
 ostream& operator<<(ostream& out, Location *loc) {
     out << loc->variableName << " ";
 
@@ -24,82 +30,137 @@ ostream& operator<<(ostream& out, Location *loc) {
     return out << loc->offset;
 }
 
-void Instruction::Print() {
-  printf("\t%s ;\n", printed);
+void Instruction::Print(FILE *out) {
+  fprintf(out, "\t%s ;\n", printed);
 }
 
-void Instruction::Emit(Mips *mips) {
+void Instruction::PrintKey(FILE *out) {
+  Print(out);
+  List<Location*> operands;
+  if (GetDst() != NULL)
+    operands.Append(GetDst());
+  GetSrcs(&operands);
+  for (int i = 0; i < operands.NumElements(); i++)
+    fprintf(out, "\t%s %d %d\n", operands.Nth(i)->GetName(),
+            operands.Nth(i)->GetSegment(), operands.Nth(i)->GetOffset());
+}
+
+void Instruction::Emit(Target *target) {
   if (*printed)
-    mips->Emit("# %s", printed);   // emit TAC as comment into assembly
-  EmitSpecific(mips);
+    target->EmitComment(printed);   // emit TAC as comment into assembly
+  EmitSpecific(target);
 }
 
 LoadConstant::LoadConstant(Location *d, int v)
   : dst(d), val(v) {
   Assert(dst != NULL);
+  Format();
+}
+void LoadConstant::Format() {
   sprintf(printed, "%s = %d", dst->GetName(), val);
 }
-void LoadConstant::EmitSpecific(Mips *mips) {
-  mips->EmitLoadConstant(dst, val);
+void LoadConstant::EmitSpecific(Target *target) {
+  target->EmitLoadConstant(dst, val);
 }
 
 
-LoadStringConstant::LoadStringConstant(Location *d, const char *s)
-  : dst(d) {
-  Assert(dst != NULL && s != NULL);
+LoadStringConstant::LoadStringConstant(Location *d, const char *s,
+                                       const char *l)
+  : dst(d), label(strdup(l)) {
+  Assert(dst != NULL && s != NULL && label != NULL);
   const char *quote = (*s == '"') ? "" : "\"";
   str = new char[strlen(s) + 2*strlen(quote) + 1];
   sprintf(str, "%s%s%s", quote, s, quote);
-  quote = (strlen(str) > 50) ? "...\"" : "";
+  Format();
+}
+void LoadStringConstant::Format() {
+  const char *quote = (strlen(str) > 50) ? "...\"" : "";
   sprintf(printed, "%s = %.50s%s", dst->GetName(), str, quote);
 }
-void LoadStringConstant::EmitSpecific(Mips *mips) {
-  mips->EmitLoadStringConstant(dst, str);
+LoadStringConstant::~LoadStringConstant() {
+  delete[] str;
+  free((char *)label);
+}
+void LoadStringConstant::EmitSpecific(Target *target) {
+  target->EmitLoadStringConstant(dst, label, str);
+}
+void LoadStringConstant::PrintKey(FILE *out) {
+  // printed only has the start of a long string
+  Instruction::PrintKey(out);
+  fprintf(out, "\t%s %s\n", label, str);
 }
 
 
 LoadLabel::LoadLabel(Location *d, const char *l)
   : dst(d), label(strdup(l)) {
   Assert(dst != NULL && label != NULL);
+  Format();
+}
+void LoadLabel::Format() {
   sprintf(printed, "%s = %s", dst->GetName(), label);
 }
-void LoadLabel::EmitSpecific(Mips *mips) {
-  mips->EmitLoadLabel(dst, label);
+LoadLabel::~LoadLabel() {
+  free((char *)label);
+}
+void LoadLabel::EmitSpecific(Target *target) {
+  target->EmitLoadLabel(dst, label);
 }
 
 
 Assign::Assign(Location *d, Location *s)
   : dst(d), src(s) {
   Assert(dst != NULL && src != NULL);
+  Format();
+}
+void Assign::Format() {
   sprintf(printed, "%s = %s", dst->GetName(), src->GetName());
 }
-void Assign::EmitSpecific(Mips *mips) {
-  mips->EmitCopy(dst, src);
+void Assign::SetSrcs(List<Location*> *srcs) {
+  src = srcs->Nth(0);
+  Format();
+}
+void Assign::EmitSpecific(Target *target) {
+  target->EmitCopy(dst, src);
 }
 
 
 Load::Load(Location *d, Location *s, int off)
   : dst(d), src(s), offset(off) {
   Assert(dst != NULL && src != NULL);
+  Format();
+}
+void Load::Format() {
   if (offset)
     sprintf(printed, "%s = *(%s + %d)", dst->GetName(), src->GetName(), offset);
   else
     sprintf(printed, "%s = *(%s)", dst->GetName(), src->GetName());
 }
-void Load::EmitSpecific(Mips *mips) {
-  mips->EmitLoad(dst, src, offset);
+void Load::SetSrcs(List<Location*> *srcs) {
+  src = srcs->Nth(0);
+  Format();
+}
+void Load::EmitSpecific(Target *target) {
+  target->EmitLoad(dst, src, offset);
 }
 
 Store::Store(Location *d, Location *s, int off)
   : dst(d), src(s), offset(off) {
   Assert(dst != NULL && src != NULL);
+  Format();
+}
+void Store::Format() {
   if (offset)
     sprintf(printed, "*(%s + %d) = %s", dst->GetName(), offset, src->GetName());
   else
     sprintf(printed, "*(%s) = %s", dst->GetName(), src->GetName());
 }
-void Store::EmitSpecific(Mips *mips) {
-  mips->EmitStore(dst, src, offset);
+void Store::SetSrcs(List<Location*> *srcs) {
+  dst = srcs->Nth(0);
+  src = srcs->Nth(1);
+  Format();
+}
+void Store::EmitSpecific(Target *target) {
+  target->EmitStore(dst, src, offset);
 }
 
 const char * const BinaryOp::opName[BinaryOp::NumOps] = {"+", "-", "*", "/", "%", "==", "<", "&&", "||"};
@@ -116,10 +177,46 @@ BinaryOp::BinaryOp(OpCode c, Location *d, Location *o1, Location *o2)
   : code(c), dst(d), op1(o1), op2(o2) {
   Assert(dst != NULL && op1 != NULL && op2 != NULL);
   Assert(code >= 0 && code < NumOps);
+  Format();
+}
+void BinaryOp::Format() {
   sprintf(printed, "%s = %s %s %s", dst->GetName(), op1->GetName(), opName[code], op2->GetName());
 }
-void BinaryOp::EmitSpecific(Mips *mips) {
-  mips->EmitBinaryOp(code, dst, op1, op2);
+void BinaryOp::SetSrcs(List<Location*> *srcs) {
+  op1 = srcs->Nth(0);
+  op2 = srcs->Nth(1);
+  Format();
+}
+void BinaryOp::EmitSpecific(Target *target) {
+  target->EmitBinaryOp(code, dst, op1, op2);
+}
+
+
+bool BinaryOp::Fold(OpCode code, int a, int b, int *result) {
+  // add and sub trap on overflow, so those are left to run time; mul
+  // wraps around, so it is done unsigned
+  long long wide;
+  switch (code) {
+    case Add:
+    case Sub:
+      wide = (code == Add ? (long long)a + b : (long long)a - b);
+      if (wide < INT_MIN || wide > INT_MAX)
+        return false;
+      *result = (int)wide;
+      return true;
+    case Mul:  *result = (int)((unsigned)a * (unsigned)b); return true;
+    case Div:
+    case Mod:
+      if (b == 0 || (a == INT_MIN && b == -1))
+        return false;
+      *result = (code == Div ? a / b : a % b);
+      return true;
+    case Eq:   *result = (a == b); return true;
+    case Less: *result = (a < b); return true;
+    case And:  *result = (a & b); return true;
+    case Or:   *result = (a | b); return true;
+    default:   return false;
+  }
 }
 
 
@@ -127,11 +224,14 @@ Label::Label(const char *l) : label(strdup(l)) {
   Assert(label != NULL);
   *printed = '\0';
 }
-void Label::Print() {
-  printf("%s:\n", label);
+Label::~Label() {
+  free((char *)label);
+}
+void Label::Print(FILE *out) {
+  fprintf(out, "%s:\n", label);
 }
-void Label::EmitSpecific(Mips *mips) {
-  mips->EmitLabel(label);
+void Label::EmitSpecific(Target *target) {
+  target->EmitLabel(label);
 }
 
 
@@ -139,83 +239,143 @@ Goto::Goto(const char *l) : label(strdup(l)) {
   Assert(label != NULL);
   sprintf(printed, "Goto %s", label);
 }
-void Goto::EmitSpecific(Mips *mips) {
-  mips->EmitGoto(label);
+Goto::~Goto() {
+  free((char *)label);
+}
+void Goto::EmitSpecific(Target *target) {
+  target->EmitGoto(label);
 }
 
-IfZ::IfZ(Location *te, const char *l)
-   : test(te), label(strdup(l)) {
+IfZ::IfZ(Location *te, const char *l, bool nz)
+   : test(te), label(strdup(l)), ifNonZero(nz) {
   Assert(test != NULL && label != NULL);
-  sprintf(printed, "IfZ %s Goto %s", test->GetName(), label);
+  Format();
+}
+void IfZ::Format() {
+  sprintf(printed, "%s %s Goto %s", GetOpName(), test->GetName(), label);
+}
+void IfZ::SetSrcs(List<Location*> *srcs) {
+  test = srcs->Nth(0);
+  Format();
 }
-void IfZ::EmitSpecific(Mips *mips) {
-  mips->EmitIfZ(test, label);
+IfZ::~IfZ() {
+  free((char *)label);
+}
+void IfZ::EmitSpecific(Target *target) {
+  if (ifNonZero)
+    target->EmitIfNZ(test, label);
+  else
+    target->EmitIfZ(test, label);
 }
 
 
 BeginFunc::BeginFunc() {
   sprintf(printed,"BeginFunc (unassigned)");
   frameSize = -555; // used as sentinel to recognized unassigned value
+  savedVars = new List<Location*>;
+}
+BeginFunc::~BeginFunc() {
+  delete savedVars;
 }
 void BeginFunc::SetFrameSize(int numBytesForAllLocalsAndTemps) {
   frameSize = numBytesForAllLocalsAndTemps;
   sprintf(printed,"BeginFunc %d", frameSize);
 }
-void BeginFunc::EmitSpecific(Mips *mips) {
-  mips->EmitBeginFunction(frameSize);
+void BeginFunc::SetSavedVars(List<Location*> *vars) {
+  delete savedVars;
+  savedVars = vars;
+}
+void BeginFunc::EmitSpecific(Target *target) {
+  if (savedVars->NumElements() > 0)
+    target->KeepAcrossCalls(savedVars);
+  target->EmitBeginFunction(frameSize);
+}
+void BeginFunc::PrintKey(FILE *out) {
+  Instruction::PrintKey(out);
+  for (int i = 0; i < savedVars->NumElements(); i++)
+    fprintf(out, "\tsaved %s %d %d\n", savedVars->Nth(i)->GetName(),
+            savedVars->Nth(i)->GetSegment(), savedVars->Nth(i)->GetOffset());
 }
 
 EndFunc::EndFunc() : Instruction() {
   sprintf(printed, "EndFunc");
 }
-void EndFunc::EmitSpecific(Mips *mips) {
-  mips->EmitEndFunction();
+void EndFunc::EmitSpecific(Target *target) {
+  target->EmitEndFunction();
 }
 
 
 Return::Return(Location *v) : val(v) {
+  Format();
+}
+void Return::Format() {
   sprintf(printed, "Return %s", val? val->GetName() : "");
 }
-void Return::EmitSpecific(Mips *mips) {
-  mips->EmitReturn(val);
+void Return::SetSrcs(List<Location*> *srcs) {
+  if (val)
+    val = srcs->Nth(0);
+  Format();
+}
+void Return::EmitSpecific(Target *target) {
+  target->EmitReturn(val);
 }
 
 
 PushParam::PushParam(Location *p)
   :  param(p) {
   Assert(param != NULL);
+  Format();
+}
+void PushParam::Format() {
   sprintf(printed, "PushParam %s", param->GetName());
 }
-void PushParam::EmitSpecific(Mips *mips) {
-  mips->EmitParam(param);
+void PushParam::SetSrcs(List<Location*> *srcs) {
+  param = srcs->Nth(0);
+  Format();
+}
+void PushParam::EmitSpecific(Target *target) {
+  target->EmitParam(param);
 }
 
 PopParams::PopParams(int nb)
   :  numBytes(nb) {
   sprintf(printed, "PopParams %d", numBytes);
 }
-void PopParams::EmitSpecific(Mips *mips) {
-  mips->EmitPopParams(numBytes);
+void PopParams::EmitSpecific(Target *target) {
+  target->EmitPopParams(numBytes);
 }
 
 
 
 LCall::LCall(const char *l, Location *d)
   :  label(strdup(l)), dst(d) {
+  Format();
+}
+void LCall::Format() {
   sprintf(printed, "%s%sLCall %s", dst? dst->GetName(): "", dst?" = ":"", label);
 }
-void LCall::EmitSpecific(Mips *mips) {
-  mips->EmitLCall(dst, label);
+LCall::~LCall() {
+  free((char *)label);
+}
+void LCall::EmitSpecific(Target *target) {
+  target->EmitLCall(dst, label);
 }
 
 ACall::ACall(Location *ma, Location *d)
   : dst(d), methodAddr(ma) {
   Assert(methodAddr != NULL);
+  Format();
+}
+void ACall::Format() {
   sprintf(printed, "%s%sACall %s", dst? dst->GetName(): "", dst?" = ":"",
 	    methodAddr->GetName());
 }
-void ACall::EmitSpecific(Mips *mips) {
-  mips->EmitACall(dst, methodAddr);
+void ACall::SetSrcs(List<Location*> *srcs) {
+  methodAddr = srcs->Nth(0);
+  Format();
+}
+void ACall::EmitSpecific(Target *target) {
+  target->EmitACall(dst, methodAddr);
 }
 
 
@@ -225,13 +385,18 @@ VTable::VTable(const char *l, List<const char *> *m)
   sprintf(printed, "VTable for class %s", l);
 }
 
-void VTable::Print() {
-  printf("VTable %s =\n", label);
+VTable::~VTable() {
+  free((char *)label);
+  delete methodLabels;
+}
+
+void VTable::Print(FILE *out) {
+  fprintf(out, "VTable %s =\n", label);
   for (int i = 0; i < methodLabels->NumElements(); i++)
-    printf("\t%s,\n", methodLabels->Nth(i));
-  printf("; \n");
+    fprintf(out, "\t%s,\n", methodLabels->Nth(i));
+  fprintf(out, "; \n");
 }
-void VTable::EmitSpecific(Mips *mips) {
-  mips->EmitVTable(label, methodLabels);
+void VTable::EmitSpecific(Target *target) {
+  target->EmitVTable(label, methodLabels);
 }
 
@@ -8,7 +8,8 @@
  * few fields, but each responds polymorphically to the methods
  * Print and Emit, the first is used to print out the TAC form of
  * the instruction (helpful when debugging) and the second to
- * convert to the appropriate MIPS assembly.
+ * hand it to a Target (see target.h), e.g. to convert to the
+ * appropriate MIPS assembly.
  *
  * The operands to each instruction are of Location class.
  * A Location object is a simple representation of where a variable
@@ -23,8 +24,9 @@
 #define _H_tac
 
 #include <iostream>
+#include <stdio.h>
 #include "list.h" // for VTable
-class Mips;
+class Target;
 
 
     // A Location object is used to identify the operands to the
@@ -46,11 +48,16 @@ class Location
 
   public:
     Location(Segment seg, int offset, const char *name);
+    ~Location();
 
     const char *GetName()           { return variableName; }
     Segment GetSegment()            { return segment; }
     int GetOffset()                 { return offset; }
 
+         // Used to move a local or temp when the frame is packed (see
+         // opt_dce.cc)
+    void SetOffset(int o)           { offset = o; }
+
     friend ostream& operator<<(ostream& out, Location *loc);
 };
 
@@ -65,9 +72,29 @@ class Instruction {
 
     public:
         virtual ~Instruction() {}
-	virtual void Print();
-	virtual void EmitSpecific(Mips *mips) = 0;
-	virtual void Emit(Mips *mips);
+	virtual void Print(FILE *out);
+	virtual void EmitSpecific(Target *target) = 0;
+	virtual void Emit(Target *target);
+
+	// A short name for the kind of instruction, e.g. "Goto" (for a
+	// BinaryOp, the operator), used when counting instructions
+	virtual const char *GetOpName() = 0;
+
+	// Writes out everything the MIPS translation of the instruction
+	// depends on: the printed form, plus where each operand lives.
+	// Used to key the cache of translated functions (see codegen.cc).
+	virtual void PrintKey(FILE *out);
+
+	// The Location the instruction assigns (if any), and the Locations
+	// whose values it reads
+	virtual Location *GetDst() { return NULL; }
+	virtual void GetSrcs(List<Location*> *srcs) {}
+
+	// Replace the Location assigned (only if there is one), and the
+	// Locations read (in the order GetSrcs lists them), as the
+	// optimizer rewrites the code
+	virtual void SetDst(Location *dst) {}
+	virtual void SetSrcs(List<Location*> *srcs) {}
 };
 
 
@@ -100,48 +127,88 @@ class Instruction {
 class LoadConstant: public Instruction {
     Location *dst;
     int val;
+    void Format();
   public:
     LoadConstant(Location *dst, int val);
-    void EmitSpecific(Mips *mips);
+    void EmitSpecific(Target *target);
+    const char *GetOpName() { return "LoadConstant"; }
+    Location *GetDst() { return dst; }
+    void SetDst(Location *d) { dst = d; Format(); }
+    int GetValue() { return val; }
 };
 
 class LoadStringConstant: public Instruction {
     Location *dst;
     char *str;
+    const char *label;
+    void Format();
   public:
-    LoadStringConstant(Location *dst, const char *s);
-    void EmitSpecific(Mips *mips);
+    LoadStringConstant(Location *dst, const char *s, const char *label);
+    ~LoadStringConstant();
+    void EmitSpecific(Target *target);
+    const char *GetOpName() { return "LoadStringConstant"; }
+    void PrintKey(FILE *out);
+    Location *GetDst() { return dst; }
+    void SetDst(Location *d) { dst = d; Format(); }
 };
 
 class LoadLabel: public Instruction {
     Location *dst;
     const char *label;
+    void Format();
   public:
     LoadLabel(Location *dst, const char *label);
-    void EmitSpecific(Mips *mips);
+    ~LoadLabel();
+    void EmitSpecific(Target *target);
+    const char *GetOpName() { return "LoadLabel"; }
+    Location *GetDst() { return dst; }
+    void SetDst(Location *d) { dst = d; Format(); }
 };
 
 class Assign: public Instruction {
     Location *dst, *src;
+    void Format();
   public:
     Assign(Location *dst, Location *src);
-    void EmitSpecific(Mips *mips);
+    void EmitSpecific(Target *target);
+    const char *GetOpName() { return "Assign"; }
+    Location *GetDst() { return dst; }
+    void SetDst(Location *d) { dst = d; Format(); }
+    Location *GetSrc() { return src; }
+    void GetSrcs(List<Location*> *srcs) { srcs->Append(src); }
+    void SetSrcs(List<Location*> *srcs);
 };
 
 class Load: public Instruction {
     Location *dst, *src;
     int offset;
+    void Format();
   public:
     Load(Location *dst, Location *src, int offset = 0);
-    void EmitSpecific(Mips *mips);
+    void EmitSpecific(Target *target);
+    const char *GetOpName() { return "Load"; }
+    Location *GetDst() { return dst; }
+    void SetDst(Location *d) { dst = d; Format(); }
+    Location *GetSrc() { return src; }
+    int GetOffset() { return offset; }
+    void GetSrcs(List<Location*> *srcs) { srcs->Append(src); }
+    void SetSrcs(List<Location*> *srcs);
 };
 
 class Store: public Instruction {
     Location *dst, *src;
     int offset;
+    void Format();
   public:
     Store(Location *d, Location *s, int offset = 0);
-    void EmitSpecific(Mips *mips);
+    void EmitSpecific(Target *target);
+    const char *GetOpName() { return "Store"; }
+    Location *GetAddr() { return dst; }
+    Location *GetSrc() { return src; }
+    int GetOffset() { return offset; }
+    // dst holds the address stored to, so it is read, not assigned
+    void GetSrcs(List<Location*> *srcs) { srcs->Append(dst); srcs->Append(src); }
+    void SetSrcs(List<Location*> *srcs);
 };
 
 class BinaryOp: public Instruction {
@@ -154,83 +221,145 @@ class BinaryOp: public Instruction {
   protected:
     OpCode code;
     Location *dst, *op1, *op2;
+    void Format();
   public:
     BinaryOp(OpCode c, Location *dst, Location *op1, Location *op2);
-    void EmitSpecific(Mips *mips);
+    void EmitSpecific(Target *target);
+    const char *GetOpName() { return opName[code]; }
+    Location *GetDst() { return dst; }
+    void SetDst(Location *d) { dst = d; Format(); }
+    OpCode GetOpCode() { return code; }
+    Location *GetOp1() { return op1; }
+    Location *GetOp2() { return op2; }
+
+    // Computes the result of the op on constant operands, as the MIPS
+    // code would. Returns false if that has to be left to run time
+    // (division by zero, or an overflow that would trap).
+    static bool Fold(OpCode code, int a, int b, int *result);
+    void GetSrcs(List<Location*> *srcs) { srcs->Append(op1); srcs->Append(op2); }
+    void SetSrcs(List<Location*> *srcs);
 };
 
 class Label: public Instruction {
     const char *label;
   public:
     Label(const char *label);
-    void Print();
-    void EmitSpecific(Mips *mips);
+    ~Label();
+    void Print(FILE *out);
+    void EmitSpecific(Target *target);
+    const char *GetOpName() { return "Label"; }
+    const char *GetLabel() { return label; }
 };
 
 class Goto: public Instruction {
     const char *label;
   public:
     Goto(const char *label);
-    void EmitSpecific(Mips *mips);
+    ~Goto();
+    void EmitSpecific(Target *target);
+    const char *GetOpName() { return "Goto"; }
+    const char *GetLabel() { return label; }
 };
 
+    // Branches if test is zero or, made with ifNonZero (printed as IfNZ),
+    // if it isn't
 class IfZ: public Instruction {
     Location *test;
     const char *label;
+    bool ifNonZero;
+    void Format();
   public:
-    IfZ(Location *test, const char *label);
-    void EmitSpecific(Mips *mips);
+    IfZ(Location *test, const char *label, bool ifNonZero = false);
+    ~IfZ();
+    void EmitSpecific(Target *target);
+    const char *GetOpName() { return ifNonZero ? "IfNZ" : "IfZ"; }
+    Location *GetTest() { return test; }
+    const char *GetLabel() { return label; }
+    bool IfNonZero() { return ifNonZero; }
+    bool IsTakenFor(int value) { return (value != 0) == ifNonZero; }
+    void GetSrcs(List<Location*> *srcs) { srcs->Append(test); }
+    void SetSrcs(List<Location*> *srcs);
 };
 
 class BeginFunc: public Instruction {
     int frameSize;
+    List<Location*> *savedVars;
   public:
     BeginFunc();
+    ~BeginFunc();
     // used to backpatch the instruction with frame size once known
     void SetFrameSize(int numBytesForAllLocalsAndTemps);
-    void EmitSpecific(Mips *mips);
+    int GetFrameSize() { return frameSize; }
+    // the variables worth keeping in registers that calls preserve,
+    // for the target (see opt_saved.cc)
+    void SetSavedVars(List<Location*> *vars);
+    void EmitSpecific(Target *target);
+    void PrintKey(FILE *out);
+    const char *GetOpName() { return "BeginFunc"; }
 };
 
 class EndFunc: public Instruction {
   public:
     EndFunc();
-    void EmitSpecific(Mips *mips);
+    void EmitSpecific(Target *target);
+    const char *GetOpName() { return "EndFunc"; }
 };
 
 class Return: public Instruction {
     Location *val;
+    void Format();
   public:
     Return(Location *val);
-    void EmitSpecific(Mips *mips);
+    void EmitSpecific(Target *target);
+    const char *GetOpName() { return "Return"; }
+    void GetSrcs(List<Location*> *srcs) { if (val) srcs->Append(val); }
+    void SetSrcs(List<Location*> *srcs);
 };
 
 class PushParam: public Instruction {
     Location *param;
+    void Format();
   public:
     PushParam(Location *param);
-    void EmitSpecific(Mips *mips);
+    void EmitSpecific(Target *target);
+    const char *GetOpName() { return "PushParam"; }
+    void GetSrcs(List<Location*> *srcs) { srcs->Append(param); }
+    void SetSrcs(List<Location*> *srcs);
 };
 
 class PopParams: public Instruction {
     int numBytes;
   public:
     PopParams(int numBytesOfParamsToRemove);
-    void EmitSpecific(Mips *mips);
+    void EmitSpecific(Target *target);
+    const char *GetOpName() { return "PopParams"; }
 };
 
 class LCall: public Instruction {
     const char *label;
     Location *dst;
+    void Format();
   public:
     LCall(const char *labe, Location *result);
-    void EmitSpecific(Mips *mips);
+    ~LCall();
+    void EmitSpecific(Target *target);
+    const char *GetOpName() { return "LCall"; }
+    Location *GetDst() { return dst; }
+    void SetDst(Location *d) { dst = d; Format(); }
+    const char *GetLabel() { return label; }
 };
 
 class ACall: public Instruction {
     Location *dst, *methodAddr;
+    void Format();
   public:
     ACall(Location *meth, Location *result);
-    void EmitSpecific(Mips *mips);
+    void EmitSpecific(Target *target);
+    const char *GetOpName() { return "ACall"; }
+    Location *GetDst() { return dst; }
+    void SetDst(Location *d) { dst = d; Format(); }
+    void GetSrcs(List<Location*> *srcs) { srcs->Append(methodAddr); }
+    void SetSrcs(List<Location*> *srcs);
 };
 
 class VTable: public Instruction {
@@ -238,8 +367,10 @@ class VTable: public Instruction {
     const char *label;
  public:
     VTable(const char *labelForTable, List<const char *> *methodLabels);
-    void Print();
-    void EmitSpecific(Mips *mips);
+    ~VTable();
+    void Print(FILE *out);
+    void EmitSpecific(Target *target);
+    const char *GetOpName() { return "VTable"; }
 };
 
 
@@ -0,0 +1,72 @@
+/* File: target.h
+ * --------------
+ * The Target class is the interface between the Tac instructions and
+ * whatever they are being translated into. Each instruction's Emit
+ * calls the one method here that corresponds to it, passing along its
+ * operands, and the target does the rest. The Mips class (which writes
+ * MIPS assembly), the X86 class (which writes x86-64 assembly, see
+ * x86.h) and the CSource class (which writes C, see csource.h) are
+ * targets; so is the Interpreter class (which decodes the
+ * instructions to run them in place, see interp.h).
+ *
+ * The instructions of a function are handed over in order, from its
+ * label and BeginFunc through to its EndFunc, and the Locations they
+ * refer to are only good for the duration of the call.
+ */
+
+#ifndef _H_target
+#define _H_target
+
+#include "tac.h"
+#include "list.h"
+class Location;
+
+         // The languages dcc can write the code in
+typedef enum { MipsArch, X86Arch, CArch } Arch;
+
+
+class Target {
+  public:
+    virtual ~Target() {}
+
+         // Called with the printed form of each instruction before it is
+         // emitted, targets that write out text can use it as a comment
+    virtual void EmitComment(const char *text) {}
+
+    virtual void EmitLoadConstant(Location *dst, int val) = 0;
+    virtual void EmitLoadStringConstant(Location *dst, const char *label,
+                                        const char *str) = 0;
+    virtual void EmitLoadLabel(Location *dst, const char *label) = 0;
+
+    virtual void EmitLoad(Location *dst, Location *reference, int offset) = 0;
+    virtual void EmitStore(Location *reference, Location *value, int offset) = 0;
+    virtual void EmitCopy(Location *dst, Location *src) = 0;
+
+    virtual void EmitBinaryOp(BinaryOp::OpCode code, Location *dst,
+                              Location *op1, Location *op2) = 0;
+
+    virtual void EmitLabel(const char *label) = 0;
+    virtual void EmitGoto(const char *label) = 0;
+    virtual void EmitIfZ(Location *test, const char *label) = 0;
+    virtual void EmitIfNZ(Location *test, const char *label) = 0;
+    virtual void EmitReturn(Location *returnVal) = 0;
+
+         // Called ahead of EmitBeginFunction with the variables worth
+         // keeping in registers the calls preserve, the most loaded and
+         // stored first, for a target that can
+    virtual void KeepAcrossCalls(List<Location*> *vars) {}
+
+    virtual void EmitBeginFunction(int frameSize) = 0;
+    virtual void EmitEndFunction() = 0;
+
+    virtual void EmitParam(Location *arg) = 0;
+    virtual void EmitLCall(Location *result, const char *label) = 0;
+    virtual void EmitACall(Location *result, Location *fnAddr) = 0;
+    virtual void EmitPopParams(int bytes) = 0;
+
+    virtual void EmitVTable(const char *label, List<const char*> *methodLabels) = 0;
+
+    virtual void EmitPreamble() {}
+};
+
+#endif
@@ -0,0 +1,140 @@
+/* File: threadpool.cc
+ * -------------------
+ * Implementation of the ThreadPool class.
+ */
+
+#include "threadpool.h"
+
+// Which pool (if any) the calling thread works for, and its queue there
+static thread_local ThreadPool *workerPool = NULL;
+static thread_local int workerIndex = -1;
+
+ThreadPool::ThreadPool(int numThreads) : numQueued(0), stopping(false) {
+    if (numThreads < 1)
+        numThreads = 1;
+    for (int i = 0; i <= numThreads; ++i)
+        queues.push_back(new Queue);
+    for (int i = 0; i < numThreads; ++i)
+        workers.push_back(std::thread(&ThreadPool::WorkerLoop, this, i));
+}
+
+ThreadPool::~ThreadPool() {
+    Wait();
+    {
+        std::lock_guard<std::mutex> guard(sleepLock);
+        stopping = true;
+    }
+    wakeUp.notify_all();
+    for (size_t i = 0; i < workers.size(); ++i)
+        workers[i].join();
+    for (size_t i = 0; i < queues.size(); ++i)
+        delete queues[i];
+}
+
+int ThreadPool::QueueForCaller() {
+    if (workerPool == this)
+        return workerIndex;
+    return queues.size() - 1;
+}
+
+void ThreadPool::Submit(Task t, Group *group) {
+    if (group != NULL)
+        group->numPending++;
+    all.numPending++;
+
+    Queue *q = queues[QueueForCaller()];
+    numQueued++;
+    {
+        std::lock_guard<std::mutex> guard(q->lock);
+        q->jobs.push_back((Job){t, group});
+    }
+    Notify();
+}
+
+void ThreadPool::Wait(Group *group) {
+    if (group == NULL)
+        group = &all;
+
+    while (group->numPending > 0) {
+        if (RunOneTask())
+            continue;
+
+        // Nothing left to run here, the rest of the group is in progress
+        // on other threads
+        std::unique_lock<std::mutex> guard(sleepLock);
+        while (group->numPending > 0 && numQueued == 0)
+            wakeUp.wait(guard);
+    }
+}
+
+int ThreadPool::DefaultNumThreads() {
+    int n = std::thread::hardware_concurrency();
+    return n > 0 ? n : 1;
+}
+
+/* Method: RunOneTask
+ * ------------------
+ * Takes the newest task from the caller's own queue or, failing that,
+ * steals the oldest task from one of the other queues, and runs it.
+ * Returns false if there was no task to be found.
+ */
+bool ThreadPool::RunOneTask() {
+    int self = QueueForCaller(), n = queues.size();
+    Job job;
+    bool found = false;
+
+    for (int i = 0; i < n && !found; ++i) {
+        Queue *q = queues[(self + i) % n];
+        std::lock_guard<std::mutex> guard(q->lock);
+        if (q->jobs.empty())
+            continue;
+        if (i == 0) {
+            job = q->jobs.back();
+            q->jobs.pop_back();
+        } else {
+            job = q->jobs.front();
+            q->jobs.pop_front();
+        }
+        found = true;
+    }
+    if (!found)
+        return false;
+
+    numQueued--;
+    job.task();
+    FinishTask(job.group);
+    return true;
+}
+
+void ThreadPool::FinishTask(Group *group) {
+    bool wake = (--all.numPending == 0);
+    if (group != NULL && --group->numPending == 0)
+        wake = true;
+    if (wake)
+        Notify();
+}
+
+void ThreadPool::Notify() {
+    // Taking the lock makes sure a thread that just found nothing to do
+    // is either already waiting, or will see the change before it waits
+    {
+        std::lock_guard<std::mutex> guard(sleepLock);
+    }
+    wakeUp.notify_all();
+}
+
+void ThreadPool::WorkerLoop(int index) {
+    workerPool = this;
+    workerIndex = index;
+
+    for (;;) {
+        if (RunOneTask())
+            continue;
+
+        std::unique_lock<std::mutex> guard(sleepLock);
+        while (numQueued == 0 && !stopping)
+            wakeUp.wait(guard);
+        if (stopping && numQueued == 0)
+            return;
+    }
+}
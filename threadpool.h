@@ -0,0 +1,97 @@
+/* File: threadpool.h
+ * ------------------
+ * A pool of worker threads for running independent tasks, such as
+ * compiling several files at once or translating the functions of one
+ * program in parallel.
+ *
+ * Each worker has its own queue of tasks: tasks submitted by a worker
+ * go on its own queue, which it works through newest first, and a
+ * worker that runs out of tasks steals the oldest task from another
+ * queue. Tasks submitted from outside the pool go on a shared queue
+ * that everyone steals from.
+ *
+ * A thread waiting for tasks to finish runs queued tasks in the
+ * meantime, so tasks can themselves submit more tasks and wait for
+ * them without tying up the pool.
+ *
+ * Sample usage:
+ *
+ *      ThreadPool pool(4);
+ *      ThreadPool::Group group;
+ *      for (int i = 0; i < n; i++)
+ *          pool.Submit([=]() { DoWork(i); }, &group);
+ *      pool.Wait(&group);
+ */
+
+#ifndef _H_threadpool
+#define _H_threadpool
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool
+{
+  public:
+    typedef std::function<void()> Task;
+
+         // A set of tasks that can be waited for together
+    class Group
+    {
+        friend class ThreadPool;
+        std::atomic<int> numPending;
+      public:
+        Group() : numPending(0) {}
+    };
+
+  private:
+    struct Job {
+        Task task;
+        Group *group;
+    };
+    struct Queue {
+        std::mutex lock;
+        std::deque<Job> jobs;
+    };
+
+    std::vector<std::thread> workers;
+    std::vector<Queue*> queues; // one per worker, then the shared one
+    std::mutex sleepLock;
+    std::condition_variable wakeUp;
+    std::atomic<int> numQueued;
+    Group all;
+    bool stopping;
+
+    int QueueForCaller();
+    bool RunOneTask();
+    void FinishTask(Group *group);
+    void Notify();
+    void WorkerLoop(int index);
+
+  public:
+         // Starts numThreads workers (at least one)
+    ThreadPool(int numThreads);
+
+         // Waits for all submitted tasks and stops the workers
+    ~ThreadPool();
+
+         // Queues a task to be run by one of the workers. If a group is
+         // given, the task is also counted as part of that group.
+    void Submit(Task t, Group *group = NULL);
+
+         // Blocks until every task of the group (or, with no group, every
+         // task submitted so far) has finished, running tasks meanwhile
+    void Wait(Group *group = NULL);
+
+         // Returns the number of workers
+    int NumThreads()                    { return workers.size(); }
+
+         // Returns a sensible default number of threads for this machine
+    static int DefaultNumThreads();
+};
+
+#endif
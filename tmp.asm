@@ -0,0 +1,123 @@
+	# standard Decaf preamble 
+	  .text
+	  .align 2
+	  .globl main
+  ____Recur:
+	# BeginFunc 44
+	  subu $sp, $sp, 8	# decrement sp to make space to save ra, fp
+	  sw $fp, 8($sp)	# save fp
+	  sw $ra, 4($sp)	# save ra
+	  addiu $fp, $sp, 8	# set up new fp
+	  subu $sp, $sp, 44	# decrement sp to make space for locals/temps
+	# _tmp0 = 0
+	  li $t0, 0		# load constant value 0 into $t0
+	# _tmp1 = depth < _tmp0
+	  slt $t1, $a0, $t0	
+	# IfZ _tmp1 Goto ____Recur._L0
+	# (save modified registers before flow of control change)
+	  sw $a0, 4($fp)	# spill depth from $a0 to $fp+4
+	  sw $t0, -16($fp)	# spill _tmp0 from $t0 to $fp-16
+	  sw $t1, -20($fp)	# spill _tmp1 from $t1 to $fp-20
+	  beqz $t1, ____Recur._L0	# branch if _tmp1 is zero 
+	# Return 
+	  move $sp, $fp		# pop callee frame off stack
+	  lw $ra, -4($fp)	# restore saved ra
+	  lw $fp, 0($fp)	# restore saved fp
+	  jr $ra		# return from function
+	# Goto ____Recur._L1
+	  b ____Recur._L1		# unconditional branch
+  ____Recur._L0:
+  ____Recur._L1:
+	# _tmp2 = 1000
+	  li $a0, 1000		# load constant value 1000 into $a0
+	# _tmp3 = depth % _tmp2
+	  lw $t0, 4($fp)	# load depth from $fp+4 into $t0
+	  li $v1, 274877907	# $t0 / 1000 by multiplying by its reciprocal
+	  mult $t0, $v1
+	  mfhi $v1
+	  sra $v1, $v1, 6
+	  srl $v0, $v1, 31	# round a negative quotient toward zero
+	  addu $v1, $v1, $v0
+	  mul $v1, $v1, $a0
+	  subu $t1, $t0, $v1	# $t0 % 1000
+	# _tmp4 = 0
+	  li $t2, 0		# load constant value 0 into $t2
+	# _tmp5 = _tmp3 == _tmp4
+	  seq $t3, $t1, $t2	
+	# IfZ _tmp5 Goto ____Recur._L2
+	# (save modified registers before flow of control change)
+	  sw $a0, -24($fp)	# spill _tmp2 from $a0 to $fp-24
+	  sw $t1, -28($fp)	# spill _tmp3 from $t1 to $fp-28
+	  sw $t2, -32($fp)	# spill _tmp4 from $t2 to $fp-32
+	  sw $t3, -36($fp)	# spill _tmp5 from $t3 to $fp-36
+	  beqz $t3, ____Recur._L2	# branch if _tmp5 is zero 
+	# PushParam depth
+	# LCall _PrintInt
+	  subu $sp, $sp, 4	# decrement sp to make space for params
+	  sw $t0, 4($sp)	# copy param value to stack
+	  jal _PrintInt      	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# _tmp6 = "\n"
+	  .data			# create string constant marked with label
+	  ____Recur._string1: .asciiz "\n"
+	  .text
+	  la $a0, ____Recur._string1	# load label
+	# PushParam _tmp6
+	# LCall _PrintString
+	# (save modified registers before flow of control change)
+	  sw $a0, -40($fp)	# spill _tmp6 from $a0 to $fp-40
+	  subu $sp, $sp, 4	# decrement sp to make space for params
+	  sw $a0, 4($sp)	# copy param value to stack
+	  jal _PrintString   	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# Goto ____Recur._L3
+	  b ____Recur._L3		# unconditional branch
+  ____Recur._L2:
+  ____Recur._L3:
+	# _tmp7 = 1
+	  li $a0, 1		# load constant value 1 into $a0
+	# _tmp8 = depth - _tmp7
+	  lw $t0, 4($fp)	# load depth from $fp+4 into $t0
+	  sub $t1, $t0, $a0	
+	# PushParam _tmp8
+	# LCall ____Recur
+	# (save modified registers before flow of control change)
+	  sw $a0, -44($fp)	# spill _tmp7 from $a0 to $fp-44
+	  sw $t1, -48($fp)	# spill _tmp8 from $t1 to $fp-48
+	  subu $sp, $sp, 4	# decrement sp to make space for params
+	  move $a0, $t1		# pass param in $a0
+	  jal ____Recur      	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# EndFunc
+	# (below handles reaching end of fn body with no explicit return)
+	  move $sp, $fp		# pop callee frame off stack
+	  lw $ra, -4($fp)	# restore saved ra
+	  lw $fp, 0($fp)	# restore saved fp
+	  jr $ra		# return from function
+  main:
+	# BeginFunc 4
+	  subu $sp, $sp, 8	# decrement sp to make space to save ra, fp
+	  sw $fp, 8($sp)	# save fp
+	  sw $ra, 4($sp)	# save ra
+	  addiu $fp, $sp, 8	# set up new fp
+	  subu $sp, $sp, 4	# decrement sp to make space for locals/temps
+	# _tmp0 = 20000
+	  li $t0, 20000		# load constant value 20000 into $t0
+	# PushParam _tmp0
+	# LCall ____Recur
+	# (save modified registers before flow of control change)
+	  sw $t0, -8($fp)	# spill _tmp0 from $t0 to $fp-8
+	  subu $sp, $sp, 4	# decrement sp to make space for params
+	  move $a0, $t0		# pass param in $a0
+	  jal ____Recur      	# jump to function
+	# PopParams 4
+	  add $sp, $sp, 4	# pop params off stack
+	# EndFunc
+	# (below handles reaching end of fn body with no explicit return)
+	  move $sp, $fp		# pop callee frame off stack
+	  lw $ra, -4($fp)	# restore saved ra
+	  lw $fp, 0($fp)	# restore saved fp
+	  jr $ra		# return from function
@@ -58,19 +58,14 @@ void PrintDebug(const char *key, const char *format, ...) {
   printf("+++ (%s): %s%s", key, buf, buf[strlen(buf)-1] != '\n'? "\n" : "");
 }
 
-void ParseCommandLine(int argc, char *argv[]) {
-  if (argc == 1)
-    return;
-  
-  if (strcmp(argv[1], "-d") != 0) { // first arg is not -d
-    printf("Incorrect Use:   ");
-    for (int i = 1; i < argc; i++) printf("%s ", argv[i]);
-    printf("\n");
-    printf("Correct Usage:   -d <debug-key-1> <debug-key-2> ... \n");
-    exit(2);
-  }
+int ParseCommandLine(int argc, char *argv[]) {
+  int d = 1;
+  while (d < argc && strcmp(argv[d], "-d") != 0)
+    d++;
 
-  for (int i = 2; i < argc; i++)
+  for (int i = d + 1; i < argc; i++)
     SetDebugForKey(argv[i], true);
+
+  return d;
 }
 
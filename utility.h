@@ -76,11 +76,12 @@ bool IsDebugOn(const char *key);
 /**
  * Function: ParseCommandLine
  * --------------------------
- * Turn on the debugging flags from the command line.  Verifies that
- * first argument is -d, and then interpret all the arguments that follow
- * as being flags to turn on.
+ * Turn on the debugging flags from the command line.  Looks for a -d
+ * argument, and then interprets all the arguments that follow as being
+ * flags to turn on. Returns the index of the -d (or argc if there is
+ * none), the arguments before it are left for the caller to interpret.
  */
 
-void ParseCommandLine(int argc, char *argv[]);
+int ParseCommandLine(int argc, char *argv[]);
      
 #endif
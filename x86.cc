@@ -0,0 +1,518 @@
+/* File: x86.cc
+ * ------------
+ * Implementation of the X86 class, which is responsible for TAC->x86-64
+ * translation, register allocation, etc. It follows the Mips class
+ * closely (see mips.cc), and uses the same simple strategy for the
+ * registers: a variable is slaved to a register on first use within a
+ * basic block, and everything is spilled at the end of the block.
+ */
+
+#include "x86.h"
+#include <stdarg.h>
+#include <string.h>
+#include "stats.h"
+
+// The runtime routines, which are C functions in runtime.c
+static const char * const builtinLabels[] =
+  {"_Alloc", "_ReadLine", "_ReadInteger", "_StringEqual",
+   "_PrintInt", "_PrintString", "_PrintBool", "_Halt", NULL};
+
+/* Method: GetRegister
+ * -------------------
+ * Given a location for a current var, a reason (ForRead or ForWrite)
+ * and up to two registers to avoid, assigns the var to a register the
+ * same way the Mips class does: the register it is already in, else an
+ * empty one, else a clean one, else a dirty one (which is spilled). If
+ * for read, the current value is loaded from memory into the register.
+ * If for write, the register is marked dirty.
+ */
+X86::Register X86::GetRegister(Location *var, Reason reason,
+			       Register avoid1, Register avoid2)
+{
+  Register reg;
+
+  if (!FindRegisterWithContents(var, reg)) {
+    if (!FindRegisterWithContents(NULL, reg)) {
+	reg = SelectRegisterToSpill(avoid1, avoid2);
+	SpillRegister(reg);
+    }
+    regs[reg].var = var;
+    if (reason == ForRead) {                 // load current value
+	Assert(var->GetOffset() % 4 == 0); // all variables are 4 bytes
+	Emit("movl %s, %s\t# load %s", AddressOf(var).c_str(),
+	     regs[reg].name32, var->GetName());
+	regs[reg].isDirty = false;
+    }
+  }
+  if (reason == ForWrite)
+    regs[reg].isDirty = true;
+  return reg;
+}
+
+X86::Register X86::GetRegister(Location *var, Register avoid1)
+{
+  return GetRegister(var, ForRead, avoid1, rsp);
+}
+
+X86::Register X86::GetRegisterForWrite(Location *var, Register avoid1,
+				       Register avoid2)
+{
+  return GetRegister(var, ForWrite, avoid1, avoid2);
+}
+
+
+// Helper to check if two variable locations are one and the same
+// (same name, segment, and offset)
+static bool LocationsAreSame(Location *var1, Location *var2)
+{
+   return (var1 == var2 ||
+	     (var1 && var2
+		&& !strcmp(var1->GetName(), var2->GetName())
+		&& var1->GetSegment()  == var2->GetSegment()
+		&& var1->GetOffset() == var2->GetOffset()));
+}
+
+bool X86::FindRegisterWithContents(Location *var, Register& reg)
+{
+  for (reg = rax; reg < NumRegs; reg = Register(reg+1))
+    if (regs[reg].isGeneralPurpose && LocationsAreSame(var, regs[reg].var))
+	return true;
+  return false;
+}
+
+/* Method: SelectRegisterToSpill
+ * -----------------------------
+ * Chooses an in-use register to replace with a new variable, preferring
+ * a clean one, and otherwise taking the dirty ones in turn. See the
+ * method of the same name in mips.cc.
+ */
+X86::Register X86::SelectRegisterToSpill(Register avoid1, Register avoid2)
+{
+  for (Register i = rax; i < NumRegs; i = (Register)(i+1)) {
+    if (i != avoid1 && i != avoid2 && regs[i].isGeneralPurpose &&
+	  !regs[i].isDirty)
+	return i;
+  }
+  do {
+    lastUsed = (Register)((lastUsed + 1) % NumRegs);
+  } while (lastUsed == avoid1 || lastUsed == avoid2 ||
+           !regs[lastUsed].isGeneralPurpose);
+  return lastUsed;
+}
+
+void X86::SpillRegister(Register reg)
+{
+  Location *var = regs[reg].var;
+  if (var && regs[reg].isDirty) {
+    Assert(var->GetOffset() % 4 == 0); // all variables are 4 bytes in size
+    Emit("movl %s, %s\t# spill %s", regs[reg].name32,
+	 AddressOf(var).c_str(), var->GetName());
+    Stats::Count(Stats::Spills);
+  }
+  regs[reg].var = NULL;
+}
+
+void X86::SpillAllDirtyRegisters()
+{
+  Register i;
+  for (i = rax; i < NumRegs; i = Register(i+1))
+    if (regs[i].var && regs[i].isDirty) break;
+  if (i != NumRegs) // none are dirty, don't print message to avoid confusion
+    Emit("# (save modified registers before flow of control change)");
+  for (i = rax; i < NumRegs; i = Register(i+1))
+    SpillRegister(i);
+}
+
+// Before a conditional branch: the registers are written back as above,
+// but kept for the code that falls through
+void X86::SaveDirtyRegisters()
+{
+  Register i;
+  for (i = rax; i < NumRegs; i = Register(i+1))
+    if (regs[i].var && regs[i].isDirty) break;
+  if (i != NumRegs)
+    Emit("# (save modified registers before flow of control change)");
+  for (i = rax; i < NumRegs; i = Register(i+1)) {
+    Location *var = regs[i].var;
+    if (var && regs[i].isDirty) {
+      SpillRegister(i);
+      regs[i].var = var;
+      regs[i].isDirty = false;
+    }
+  }
+}
+
+// At the end of a function only the globals need to be written back
+void X86::SpillForEndFunction()
+{
+  for (Register i = rax; i < NumRegs; i = Register(i+1)) {
+    if (regs[i].isGeneralPurpose && regs[i].var) {
+	if (regs[i].var->GetSegment() == gpRelative)
+	  SpillRegister(i);
+	else
+	  regs[i].var = NULL;
+    }
+  }
+}
+
+
+/* Method: AddressOf
+ * -----------------
+ * Returns the operand for the memory that holds var. Params are 12
+ * bytes further from %rbp than the CodeGenerator's offsets say (see
+ * x86.h), locals are where it says. Each global is a common symbol,
+ * which is declared the first time it is used.
+ */
+std::string X86::AddressOf(Location *var)
+{
+  char buf[64];
+  int offset = var->GetOffset();
+  if (var->GetSegment() == gpRelative) {
+    if (globalsDeclared.insert(offset).second)
+      Emit(".comm _global%d, 4, 4", offset);
+    sprintf(buf, "_global%d(%%rip)", offset);
+  } else {
+    sprintf(buf, "%d(%%rbp)", offset > 0 ? offset + 12 : offset);
+  }
+  return buf;
+}
+
+// The C runtime has the main function, so the Decaf one is renamed
+std::string X86::Symbol(const char *label)
+{
+  return strcmp(label, "main") == 0 ? "_Decaf_main" : label;
+}
+
+bool X86::IsBuiltIn(const char *label)
+{
+  for (int i = 0; builtinLabels[i] != NULL; i++)
+    if (strcmp(label, builtinLabels[i]) == 0)
+      return true;
+  return false;
+}
+
+
+/* Method: Emit
+ * ------------
+ * General purpose helper used to emit assembly instructions, formatted
+ * like the Mips class does.
+ */
+void X86::Emit(const char *fmt, ...)
+{
+  va_list args;
+  char buf[1024];
+
+  va_start(args, fmt);
+  vsprintf(buf, fmt, args);
+  va_end(args);
+  if (buf[strlen(buf) - 1] != ':') fprintf(out, "\t"); // don't tab in labels
+  if (buf[0] != '#') fprintf(out, "  ");   // outdent comments a little
+  fprintf(out, "%s", buf);
+  if (buf[strlen(buf)-1] != '\n') fprintf(out, "\n"); // end with a newline
+}
+
+void X86::EmitComment(const char *text)
+{
+  Emit("# %s", text);
+}
+
+
+void X86::EmitLoadConstant(Location *dst, int val)
+{
+  Register reg = GetRegisterForWrite(dst);
+  Emit("movl $%d, %s\t# load constant value %d", val, regs[reg].name32, val);
+}
+
+void X86::EmitLoadStringConstant(Location *dst, const char *label, const char *str)
+{
+  Emit(".data\t\t\t# create string constant marked with label");
+  Emit("%s: .asciz %s", label, str);
+  Emit(".text");
+  EmitLoadLabel(dst, label);
+}
+
+// The program is linked below 4GB, so an address fits in 32 bits
+void X86::EmitLoadLabel(Location *dst, const char *label)
+{
+  Register reg = GetRegisterForWrite(dst);
+  Emit("movl $%s, %s\t# load label", Symbol(label).c_str(), regs[reg].name32);
+}
+
+void X86::EmitCopy(Location *dst, Location *src)
+{
+  Register rSrc = GetRegister(src), rDst = GetRegisterForWrite(dst, rSrc);
+  Emit("movl %s, %s\t\t# copy value", regs[rSrc].name32, regs[rDst].name32);
+}
+
+void X86::EmitLoad(Location *dst, Location *reference, int offset)
+{
+  Register rSrc = GetRegister(reference), rDst = GetRegisterForWrite(dst, rSrc);
+  Emit("movl %d(%s), %s\t# load with offset", offset, regs[rSrc].name,
+       regs[rDst].name32);
+}
+
+void X86::EmitStore(Location *reference, Location *value, int offset)
+{
+  Register rVal = GetRegister(value), rRef = GetRegister(reference, rVal);
+  Emit("movl %s, %d(%s)\t# store with offset", regs[rVal].name32, offset,
+       regs[rRef].name);
+}
+
+
+/* Method: EmitBinaryOp
+ * --------------------
+ * Used to perform a binary operation on 2 operands and store result in
+ * dst. The x86 instructions take two operands, the second of which is
+ * also the destination, so the left operand is copied to dst first
+ * unless dst is in the same register as one of the operands. Division
+ * needs %eax and %edx, which are emptied and kept out of the way of the
+ * operands. idivl would kill the program with SIGFPE on a zero divisor,
+ * losing the output the runtime has buffered, so that goes to the
+ * runtime's error instead; a divisor of -1 is done without idivl, which
+ * also traps on INT_MIN / -1 (MIPS gives INT_MIN). The comparisons set
+ * the low byte of dst and widen it.
+ */
+void X86::EmitBinaryOp(BinaryOp::OpCode code, Location *dst,
+		       Location *op1, Location *op2)
+{
+  if (code == BinaryOp::Div || code == BinaryOp::Mod) {
+    SpillRegister(rax);
+    SpillRegister(rdx);
+    regs[rax].isGeneralPurpose = regs[rdx].isGeneralPurpose = false;
+    Register rLeft = GetRegister(op1), rRight = GetRegister(op2, rLeft);
+    regs[rax].isGeneralPurpose = regs[rdx].isGeneralPurpose = true;
+    const char *right = regs[rRight].name32;
+    Emit("movl %s, %%eax", regs[rLeft].name32);
+    Emit("testl %s, %s", right, right);
+    Emit("jz _DecafDivideByZero");
+    Emit("cmpl $-1, %s\t# idivl traps on INT_MIN / -1", right);
+    Emit("jne 1f");
+    Emit("negl %%eax\t\t# x / -1 is -x, wrapping as on MIPS");
+    Emit("xorl %%edx, %%edx\t# x %% -1 is 0");
+    Emit("jmp 2f");
+    Emit("1:");
+    Emit("cltd");
+    Emit("idivl %s", right);
+    Emit("2:");
+    Register rDst = GetRegisterForWrite(dst, rLeft, rRight);
+    Emit("movl %s, %s", code == BinaryOp::Div ? "%eax" : "%edx",
+	 regs[rDst].name32);
+    return;
+  }
+
+  Register rLeft = GetRegister(op1), rRight = GetRegister(op2, rLeft);
+  Register rDst = GetRegisterForWrite(dst, rLeft, rRight);
+  const char *left = regs[rLeft].name32, *right = regs[rRight].name32;
+  const char *d = regs[rDst].name32;
+
+  if (code == BinaryOp::Eq || code == BinaryOp::Less) {
+    Emit("cmpl %s, %s", right, left);
+    Emit("%s %s", code == BinaryOp::Eq ? "sete" : "setl", regs[rDst].name8);
+    Emit("movzbl %s, %s", regs[rDst].name8, d);
+    return;
+  }
+
+  static const char * const x86Name[BinaryOp::NumOps] =
+    {"addl", "subl", "imull", NULL, NULL, NULL, NULL, "andl", "orl"};
+  const char *name = x86Name[code];
+  Assert(name != NULL);
+  if (rDst == rRight && rDst != rLeft) {
+    if (code == BinaryOp::Sub) {            // d = -(right) + left
+      Emit("negl %s", d);
+      Emit("addl %s, %s", left, d);
+    } else {                                // the rest commute
+      Emit("%s %s, %s", name, left, d);
+    }
+    return;
+  }
+  if (rDst != rLeft)
+    Emit("movl %s, %s", left, d);
+  Emit("%s %s, %s", name, right, d);
+}
+
+
+void X86::EmitLabel(const char *label)
+{
+  SpillAllDirtyRegisters();
+  Emit("%s:", Symbol(label).c_str());
+}
+
+void X86::EmitGoto(const char *label)
+{
+  SpillAllDirtyRegisters();
+  Emit("jmp %s\t\t# unconditional branch", label);
+}
+
+void X86::EmitIfZ(Location *test, const char *label)
+{
+  Register testReg = GetRegister(test);
+  SaveDirtyRegisters();
+  Emit("testl %s, %s", regs[testReg].name32, regs[testReg].name32);
+  Emit("je %s\t# branch if %s is zero", label, test->GetName());
+}
+
+void X86::EmitIfNZ(Location *test, const char *label)
+{
+  Register testReg = GetRegister(test);
+  SaveDirtyRegisters();
+  Emit("testl %s, %s", regs[testReg].name32, regs[testReg].name32);
+  Emit("jne %s\t# branch if %s is not zero", label, test->GetName());
+}
+
+
+/* Method: EmitParam
+ * -----------------
+ * Pushes a parameter as a 4-byte word, as on MIPS, so that the params
+ * take the space the CodeGenerator expects.
+ */
+void X86::EmitParam(Location *arg)
+{
+  Register reg = GetRegister(arg);
+  Emit("subq $4, %%rsp\t# make space for param");
+  Emit("movl %s, (%%rsp)\t# copy param value to stack", regs[reg].name32);
+}
+
+
+/* Method: EmitCallInstr
+ * ---------------------
+ * Used to effect a function call, after spilling all registers. A call
+ * to one of the runtime routines (which are C functions) moves the
+ * first two params into %edi and %esi and aligns the stack to 16 bytes,
+ * keeping the old %rsp in %rbx, which the C code preserves. The result
+ * comes back in %eax.
+ */
+void X86::EmitCallInstr(Location *result, const char *fn, bool isLabel,
+			bool isBuiltIn)
+{
+  SpillAllDirtyRegisters();
+  if (isBuiltIn) {
+    Emit("movl (%%rsp), %%edi\t# pass params in registers");
+    Emit("movl 4(%%rsp), %%esi");
+    Emit("movq %%rsp, %%rbx\t# align stack for C");
+    Emit("andq $-16, %%rsp");
+    Emit("call %s", fn);
+    Emit("movq %%rbx, %%rsp");
+  } else {
+    Emit("call %s%-15s\t# jump to function", isLabel ? "" : "*", fn);
+  }
+  if (result != NULL) {
+    Register r1 = GetRegisterForWrite(result);
+    Emit("movl %%eax, %s\t\t# copy function return value from %%eax",
+	 regs[r1].name32);
+  }
+}
+
+void X86::EmitLCall(Location *dst, const char *label)
+{
+  EmitCallInstr(dst, Symbol(label).c_str(), true, IsBuiltIn(label));
+}
+
+void X86::EmitACall(Location *dst, Location *fn)
+{
+  EmitCallInstr(dst, regs[GetRegister(fn)].name, false, false);
+}
+
+void X86::EmitPopParams(int bytes)
+{
+  if (bytes != 0)
+    Emit("addq $%d, %%rsp\t# pop params off stack", bytes);
+}
+
+
+void X86::EmitReturn(Location *returnVal)
+{
+  // The value is moved to %eax after the spill, since %eax may be
+  // holding a global that has to be written back first
+  Register reg = (returnVal != NULL ? GetRegister(returnVal) : rsp);
+  SpillForEndFunction();
+  if (returnVal != NULL)
+    Emit("movl %s, %%eax\t\t# assign return value into %%eax",
+	 regs[reg].name32);
+  Emit("movq %%rbp, %%rsp\t\t# pop callee frame off stack");
+  Emit("popq %%rbp\t\t# restore saved fp");
+  Emit("ret\t\t\t# return from function");
+}
+
+// The locals start 8 bytes below %rbp, where MIPS saves fp and ra, and
+// only %rbp is saved there, so the frame is 8 bytes bigger than on MIPS
+void X86::EmitBeginFunction(int stackFrameSize)
+{
+  Assert(stackFrameSize >= 0);
+  Emit("pushq %%rbp\t\t# save fp");
+  Emit("movq %%rsp, %%rbp\t\t# set up new fp");
+  Emit("subq $%d, %%rsp\t# make space for locals/temps", stackFrameSize + 8);
+}
+
+void X86::EmitEndFunction()
+{
+  Emit("# (below handles reaching end of fn body with no explicit return)");
+  EmitReturn(NULL);
+}
+
+
+void X86::EmitVTable(const char *label, List<const char*> *methodLabels)
+{
+  Emit(".data");
+  Emit(".align 4");
+  Emit("%s:\t\t# label for class %s vtable", label, label);
+  for (int i = 0; i < methodLabels->NumElements(); i++)
+    Emit(".long %s\n", methodLabels->Nth(i));
+  Emit(".text");
+}
+
+
+/* Method: EmitPreamble
+ * --------------------
+ * Emits _DecafStart, which the runtime calls to run the program. The
+ * Decaf code doesn't preserve any registers, so the ones the C code
+ * expects to be preserved are saved around the call to main. Also
+ * emits _DecafDivideByZero, which a division by zero jumps to (see
+ * EmitBinaryOp); _DivideByZero doesn't return.
+ */
+void X86::EmitPreamble()
+{
+  Emit("# standard Decaf preamble ");
+  Emit(".text");
+  Emit(".globl _DecafStart");
+  Emit("_DecafStart:");
+  Emit("pushq %%rbx");
+  Emit("pushq %%rbp");
+  Emit("pushq %%r12");
+  Emit("pushq %%r13");
+  Emit("pushq %%r14");
+  Emit("pushq %%r15");
+  Emit("call _Decaf_main");
+  Emit("popq %%r15");
+  Emit("popq %%r14");
+  Emit("popq %%r13");
+  Emit("popq %%r12");
+  Emit("popq %%rbp");
+  Emit("popq %%rbx");
+  Emit("ret");
+  Emit("_DecafDivideByZero:");
+  Emit("andq $-16, %%rsp\t# align stack for C");
+  Emit("call _DivideByZero");
+}
+
+
+/* Constructor
+ * ----------
+ * Constructor sets up the register descriptors to the initial starting
+ * state. All of the assembly is written to out.
+ */
+X86::X86(FILE *o) {
+  static const char * const names[NumRegs][3] = {
+    {"%rax", "%eax", "%al"}, {"%rbx", "%ebx", "%bl"},
+    {"%rcx", "%ecx", "%cl"}, {"%rdx", "%edx", "%dl"},
+    {"%rsi", "%esi", "%sil"}, {"%rdi", "%edi", "%dil"},
+    {"%r8", "%r8d", "%r8b"}, {"%r9", "%r9d", "%r9b"},
+    {"%r10", "%r10d", "%r10b"}, {"%r11", "%r11d", "%r11b"},
+    {"%r12", "%r12d", "%r12b"}, {"%r13", "%r13d", "%r13b"},
+    {"%r14", "%r14d", "%r14b"}, {"%r15", "%r15d", "%r15b"},
+    {"%rsp", "%esp", "%spl"}, {"%rbp", "%ebp", "%bpl"}};
+  for (Register r = rax; r < NumRegs; r = Register(r+1))
+    regs[r] = (RegContents){false, NULL, names[r][0], names[r][1],
+                            names[r][2], r != rsp && r != rbp};
+  lastUsed = rax;
+  out = o;
+}
@@ -0,0 +1,125 @@
+/* File: x86.h
+ * -----------
+ * The X86 class is the x86-64 counterpart of the Mips class: it is a
+ * Target (see target.h) that translates each Tac instruction into
+ * x86-64 assembly, in the AT&T syntax of the GNU assembler, managing
+ * the use of the registers as it goes. dcc -target x86 uses it in place
+ * of the Mips class.
+ *
+ * The code keeps the data layout the rest of the compiler assumes:
+ * every variable, field, array element and vtable entry is a 32-bit
+ * word, and so are the addresses stored in them. This works because the
+ * program is linked at a fixed address below 4GB (gcc -no-pie), and the
+ * runtime keeps the heap there too, so all of the addresses a Decaf
+ * program can see fit in 32 bits. Registers are written through their
+ * 32-bit names, which zeroes the upper half, so a pointer in a register
+ * can be used as a 64-bit address as is.
+ *
+ * Frames are laid out so that the offsets the CodeGenerator assigns
+ * still hold, relative to %rbp: params are pushed as 4-byte words, as on
+ * MIPS, and a call pushes the return address and the callee pushes %rbp,
+ * so the params end up 12 bytes further from %rbp than from $fp on MIPS.
+ * Locals are where the CodeGenerator puts them. Globals each get their
+ * own common symbol, _global<offset>.
+ *
+ * Like the Mips class, it slaves variables to registers (any of the 14
+ * general purpose ones besides %rsp and %rbp) for the span of a basic
+ * block and spills them all at labels, branches and calls. The runtime
+ * routines (_Alloc, _PrintInt, etc.) are C functions in runtime.c, which
+ * are called with their arguments moved to registers and the stack
+ * aligned as the System V ABI requires. The runtime's main() enters the
+ * program through _DecafStart, which the preamble defines; the Decaf
+ * main function itself is labelled _Decaf_main.
+ *
+ * To build an executable:
+ *
+ *     dcc -target x86 < prog.decaf > prog.s
+ *     gcc -no-pie -o prog prog.s runtime.c
+ */
+
+#ifndef _H_x86
+#define _H_x86
+
+#include <stdio.h>
+#include <set>
+#include <string>
+#include "tac.h"
+#include "list.h"
+#include "target.h"
+class Location;
+
+
+class X86 : public Target {
+  private:
+    typedef enum { rax, rbx, rcx, rdx, rsi, rdi, r8, r9, r10, r11, r12,
+                   r13, r14, r15, rsp, rbp, NumRegs } Register;
+
+    struct RegContents {
+	bool isDirty;
+	Location *var;
+	const char *name;       // 64-bit name, for addressing
+	const char *name32;     // the 32-bit half, which holds the value
+	const char *name8;      // the low byte, for setcc
+	bool isGeneralPurpose;
+    } regs[NumRegs];
+
+    Register lastUsed;
+    FILE *out;
+    std::set<int> globalsDeclared;
+
+    typedef enum { ForRead, ForWrite } Reason;
+
+    Register GetRegister(Location *var, Reason reason, Register avoid1, Register avoid2);
+    Register GetRegister(Location *var, Register avoid1 = rsp);
+    Register GetRegisterForWrite(Location *var, Register avoid1 = rsp, Register avoid2 = rsp);
+    bool FindRegisterWithContents(Location *var, Register& reg);
+    Register SelectRegisterToSpill(Register avoid1, Register avoid2);
+    void SpillRegister(Register reg);
+    void SpillAllDirtyRegisters();
+    void SaveDirtyRegisters();
+    void SpillForEndFunction();
+
+    std::string AddressOf(Location *var);
+    static std::string Symbol(const char *label);
+    static bool IsBuiltIn(const char *label);
+    void EmitCallInstr(Location *dst, const char *fn, bool isLabel, bool isBuiltIn);
+
+ public:
+
+    X86(FILE *out);
+
+    void Emit(const char *fmt, ...);
+    void EmitComment(const char *text);
+
+    void EmitLoadConstant(Location *dst, int val);
+    void EmitLoadStringConstant(Location *dst, const char *label, const char *str);
+    void EmitLoadLabel(Location *dst, const char *label);
+
+    void EmitLoad(Location *dst, Location *reference, int offset);
+    void EmitStore(Location *reference, Location *value, int offset);
+    void EmitCopy(Location *dst, Location *src);
+
+    void EmitBinaryOp(BinaryOp::OpCode code, Location *dst,
+			    Location *op1, Location *op2);
+
+    void EmitLabel(const char *label);
+    void EmitGoto(const char *label);
+    void EmitIfZ(Location *test, const char*label);
+    void EmitIfNZ(Location *test, const char*label);
+    void EmitReturn(Location *returnVal);
+
+    void EmitBeginFunction(int frameSize);
+    void EmitEndFunction();
+
+    void EmitParam(Location *arg);
+    void EmitLCall(Location *result, const char* label);
+    void EmitACall(Location *result, Location *fnAddr);
+    void EmitPopParams(int bytes);
+
+    void EmitVTable(const char *label, List<const char*> *methodLabels);
+
+    void EmitPreamble();
+};
+
+
+#endif
@@ -0,0 +1,150 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_Y_TAB_H_INCLUDED
+# define YY_YY_Y_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 1
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    T_Void = 258,                  /* T_Void  */
+    T_Bool = 259,                  /* T_Bool  */
+    T_Int = 260,                   /* T_Int  */
+    T_Double = 261,                /* T_Double  */
+    T_String = 262,                /* T_String  */
+    T_Class = 263,                 /* T_Class  */
+    T_LessEqual = 264,             /* T_LessEqual  */
+    T_GreaterEqual = 265,          /* T_GreaterEqual  */
+    T_Equal = 266,                 /* T_Equal  */
+    T_NotEqual = 267,              /* T_NotEqual  */
+    T_Dims = 268,                  /* T_Dims  */
+    T_And = 269,                   /* T_And  */
+    T_Or = 270,                    /* T_Or  */
+    T_Null = 271,                  /* T_Null  */
+    T_Extends = 272,               /* T_Extends  */
+    T_This = 273,                  /* T_This  */
+    T_Interface = 274,             /* T_Interface  */
+    T_Implements = 275,            /* T_Implements  */
+    T_While = 276,                 /* T_While  */
+    T_For = 277,                   /* T_For  */
+    T_If = 278,                    /* T_If  */
+    T_Else = 279,                  /* T_Else  */
+    T_Return = 280,                /* T_Return  */
+    T_Break = 281,                 /* T_Break  */
+    T_New = 282,                   /* T_New  */
+    T_NewArray = 283,              /* T_NewArray  */
+    T_Print = 284,                 /* T_Print  */
+    T_ReadInteger = 285,           /* T_ReadInteger  */
+    T_ReadLine = 286,              /* T_ReadLine  */
+    T_Identifier = 287,            /* T_Identifier  */
+    T_StringConstant = 288,        /* T_StringConstant  */
+    T_IntConstant = 289,           /* T_IntConstant  */
+    T_DoubleConstant = 290,        /* T_DoubleConstant  */
+    T_BoolConstant = 291,          /* T_BoolConstant  */
+    T_UnaryMinus = 292,            /* T_UnaryMinus  */
+    T_Lower_Than_Else = 293        /* T_Lower_Than_Else  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 37 "parser.y"
+
+    int integerConstant;
+    bool boolConstant;
+    char *stringConstant;
+    double doubleConstant;
+    char identifier[MaxIdentLen+1]; // +1 for terminating null
+    Decl *decl;
+    List<Decl*> *declList;
+    Type *type;
+    NamedType *cType;
+    List<NamedType*> *cTypeList;
+    FnDecl *fDecl;
+    VarDecl *var;
+    List<VarDecl*> *varList;
+    Expr *expr;
+    List<Expr*> *exprList;
+    Stmt *stmt;
+    List<Stmt*> *stmtList;
+    LValue *lvalue;
+
+#line 123 "y.tab.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+/* Location type.  */
+#if ! defined YYLTYPE && ! defined YYLTYPE_IS_DECLARED
+typedef struct YYLTYPE YYLTYPE;
+struct YYLTYPE
+{
+  int first_line;
+  int first_column;
+  int last_line;
+  int last_column;
+};
+# define YYLTYPE_IS_DECLARED 1
+# define YYLTYPE_IS_TRIVIAL 1
+#endif
+
+
+
+
+int yyparse (void *scanner);
+
+
+#endif /* !YY_YY_Y_TAB_H_INCLUDED  */